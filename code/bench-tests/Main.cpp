@@ -1,7 +1,15 @@
 #include "nanobench.h"
 #include <set>
 
+#if defined(__linux__)
+#include <signal.h>
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 import Monitor.Host;
+import Monitor.Shared;
 import Opal;
 import Soup.Core;
 
@@ -649,4 +657,114 @@ int main()
 				recipeCache);
 		});
 	}
+
+#if defined(__linux__)
+	{
+		// Start a stopped traced child, it is a copy of this process so the path lives at the same address
+		auto path = std::string("/usr/lib/gcc/x86_64-linux-gnu/12/../../../../include/c++/12/bits/stl_algobase.h");
+		auto processId = fork();
+		if (processId == 0)
+		{
+			ptrace(PTRACE_TRACEME, 0, nullptr, nullptr);
+			raise(SIGSTOP);
+			_exit(0);
+		}
+
+		int status;
+		waitpid(processId, &status, 0);
+
+		auto memoryReader = Monitor::Linux::LinuxTraceeMemoryReader();
+		auto address = reinterpret_cast<long>(path.c_str());
+
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("LinuxTraceeMemoryReader Read Path PEEKDATA", [&]
+		{
+			auto actual = memoryReader.ReadNullTerminatedStringPeekData(processId, address);
+			ankerl::nanobench::doNotOptimizeAway(actual);
+		});
+
+		ankerl::nanobench::Bench().minEpochIterations(10000).run("LinuxTraceeMemoryReader Read Path process_vm_readv", [&]
+		{
+			auto actual = memoryReader.ReadNullTerminatedString(processId, address);
+			ankerl::nanobench::doNotOptimizeAway(actual);
+		});
+
+		kill(processId, SIGKILL);
+		waitpid(processId, &status, 0);
+	}
+
+	{
+		// The open events of a compile, every header is probed in each include directory until it is found
+		auto includeDirectories = std::vector<std::string>({
+			"/usr/include/c++/12/",
+			"/usr/include/x86_64-linux-gnu/c++/12/",
+			"/usr/include/c++/12/backward/",
+			"/usr/lib/gcc/x86_64-linux-gnu/12/include/",
+			"/usr/local/include/",
+			"/usr/include/x86_64-linux-gnu/",
+			"/usr/include/",
+		});
+		auto events = std::vector<std::pair<std::string, bool>>();
+		for (auto header = 0; header < 200; header++)
+		{
+			auto foundIndex = header % includeDirectories.size();
+			for (size_t directoryIndex = 0; directoryIndex <= foundIndex; directoryIndex++)
+			{
+				auto path = std::format("{}header{}.h", includeDirectories[directoryIndex], header);
+				events.emplace_back(std::move(path), directoryIndex == foundIndex);
+			}
+		}
+
+		// The common headers are included again by every translation unit in the operation
+		for (auto header = 0; header < 20; header++)
+			events.emplace_back(std::format("/usr/include/header{}.h", header), true);
+		events.emplace_back("/work/Source.cpp", true);
+
+		auto immutableReadDirectories = Monitor::Linux::ImmutableReadFilter::CombineDirectories(
+			Monitor::Linux::LinuxMonitorProcessManager::GetDefaultImmutableReadDirectories());
+		size_t reportedCount = 0;
+		ankerl::nanobench::Bench().minEpochIterations(100).run("ImmutableReadFilter Compile Events", [&]
+		{
+			auto filter = Monitor::Linux::ImmutableReadFilter();
+			filter.Initialize(immutableReadDirectories);
+			reportedCount = 0;
+			for (auto& [path, exists] : events)
+			{
+				if (!filter.CanSkipRead(path, exists))
+					reportedCount++;
+			}
+		});
+
+		std::cout << std::format("ImmutableReadFilter reported {} of {} events", reportedCount, events.size()) << std::endl;
+	}
+
+	for (auto residentMegabytes : { 0, 256, 1024 })
+	{
+		// Grow the resident set to the size of a build process that holds a large graph
+		auto residentMemory = std::vector<char>(static_cast<size_t>(residentMegabytes) * 1024 * 1024);
+		for (size_t i = 0; i < residentMemory.size(); i += 4096)
+			residentMemory[i] = 1;
+
+		ankerl::nanobench::Bench().minEpochIterations(50).run(std::format("Spawn fork {}MB Resident", residentMegabytes), [&]
+		{
+			auto processId = fork();
+			if (processId == 0)
+			{
+				execl("/bin/true", "true", nullptr);
+				_exit(1);
+			}
+
+			int status;
+			waitpid(processId, &status, 0);
+		});
+
+		ankerl::nanobench::Bench().minEpochIterations(50).run(std::format("Spawn LinuxMonitorProcess {}MB Resident", residentMegabytes), [&]
+		{
+			// Partial monitor ignores the file events, only the launch and trace setup are measured
+			auto process = Monitor::Linux::LinuxMonitorProcess(Path("/bin/true"), {}, Path("/tmp/"), nullptr, true, nullptr);
+			process.Start();
+			process.WaitForExit();
+			ankerl::nanobench::doNotOptimizeAway(process.GetExitCode());
+		});
+	}
+#endif
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <filesystem>
 #include <iostream>
@@ -31,6 +32,7 @@ using namespace Opal;
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <deque>
 #include <functional>
 #include <fstream>
 #include <filesystem>
@@ -42,8 +44,13 @@ using namespace Opal;
 #include <sstream>
 #include <string>
 
+#include <netdb.h>
+#include <poll.h>
 #include <spawn.h>
+#include <sys/inotify.h>
+#include <sys/socket.h>
 #include <sys/wait.h>
+#include <unistd.h>
 
 #include "utilities/Path.h"
 #include "utilities/SemanticVersion.h"
@@ -154,6 +154,20 @@ namespace Soup::Client
 		{
 			Log::Diag("Setup BuildOptions");
 			SetupShared(options);
+
+			#if defined(__linux__)
+				// Parallel operations need a tracer that can service more than one process at a time
+				if (options.NotifyMonitor)
+					Monitor::IMonitorProcessManager::Register(std::make_shared<Monitor::Linux::LinuxMonitorProcessManager>(
+						Monitor::Linux::LinuxMonitorBackend::Notify));
+				else if (options.PreloadMonitor)
+					Monitor::IMonitorProcessManager::Register(std::make_shared<Monitor::Linux::LinuxMonitorProcessManager>(
+						Monitor::Linux::LinuxMonitorBackend::Preload));
+				else if (options.Jobs > 1)
+					Monitor::IMonitorProcessManager::Register(std::make_shared<Monitor::Linux::LinuxMonitorProcessManager>(
+						Monitor::Linux::LinuxMonitorBackend::SharedTrace));
+			#endif
+
 			return std::make_shared<BuildCommand>(
 				std::move(options));
 		}
@@ -56,6 +56,11 @@ namespace Soup::Client
 			arguments.SkipEvaluate = _options.SkipEvaluate;
 			arguments.DisableMonitor = _options.DisableMonitor;
 			arguments.PartialMonitor = _options.PartialMonitor;
+			arguments.UseContentDigest = _options.ContentDigest;
+			arguments.UseBuildCache = _options.Cache;
+			arguments.RemoteBuildCacheUrl = _options.RemoteCache;
+			arguments.UseGenerateServer = _options.GenerateServer;
+			arguments.MaxJobs = _options.Jobs;
 
 			// Platform specific defaults
 			#if defined(_WIN32)
@@ -84,6 +89,27 @@ namespace Soup::Client
 
 			// Load user config state
 			auto userDataPath = Core::BuildEngine::GetSoupUserDataPath();
+
+			if (_options.Watch)
+			{
+				// Reload the package graph each time the watch reports that the recipes changed
+				while (true)
+				{
+					auto recipeCache = Core::RecipeCache();
+					auto packageProvider = Core::BuildEngine::LoadBuildGraph(
+						builtInPackageDirectory,
+						arguments.WorkingDirectory,
+						arguments.GlobalParameters,
+						userDataPath,
+						recipeCache);
+
+					Core::BuildEngine::Watch(
+						packageProvider,
+						arguments,
+						userDataPath,
+						recipeCache);
+				}
+			}
 			
 			auto recipeCache = Core::RecipeCache();
 
@@ -58,7 +58,26 @@ namespace Soup::Client
 				options->SkipEvaluate = IsFlagSet("skipEvaluate", unusedArgs);
 				options->DisableMonitor = IsFlagSet("disableMonitor", unusedArgs);
 				options->PartialMonitor = IsFlagSet("partialMonitor", unusedArgs);
+				options->NotifyMonitor = IsFlagSet("notifyMonitor", unusedArgs);
+				options->PreloadMonitor = IsFlagSet("preloadMonitor", unusedArgs);
+				options->GenerateServer = IsFlagSet("generateServer", unusedArgs);
 				options->Force = IsFlagSet("force", unusedArgs);
+				options->ContentDigest = IsFlagSet("contentDigest", unusedArgs);
+				options->Cache = IsFlagSet("cache", unusedArgs);
+				options->Watch = IsFlagSet("watch", unusedArgs);
+
+				auto jobsValue = std::string();
+				if (TryGetValueArgument("jobs", unusedArgs, jobsValue) ||
+					TryGetValueArgument("j", unusedArgs, jobsValue))
+				{
+					options->Jobs = ParseJobCount(jobsValue);
+				}
+
+				auto remoteCacheValue = std::string();
+				if (TryGetValueArgument("remoteCache", unusedArgs, remoteCacheValue))
+				{
+					options->RemoteCache = std::move(remoteCacheValue);
+				}
 
 				auto flavorValue = std::string();
 				if (TryGetValueArgument("flavor", unusedArgs, flavorValue))
@@ -367,6 +386,21 @@ namespace Soup::Client
 			}
 		}
 
+		static uint32_t ParseJobCount(const std::string& value)
+		{
+			auto result = 0ul;
+			auto parseResult = std::from_chars(value.data(), value.data() + value.size(), result);
+			if (parseResult.ec != std::errc() ||
+				parseResult.ptr != value.data() + value.size() ||
+				result == 0 ||
+				result > std::numeric_limits<uint32_t>::max())
+			{
+				throw std::runtime_error(std::format("Invalid jobs value: {}", value));
+			}
+
+			return static_cast<uint32_t>(result);
+		}
+
 		static TraceEventFlag CheckVerbosity(std::vector<std::string>& unusedArgs)
 		{
 			auto level = 
@@ -44,12 +44,60 @@ namespace Soup::Client
 		// [[Args::Option("partialMonitor", Default = false, HelpText = "Do not monitor usage for incremental builds.")]]
 		bool PartialMonitor;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to monitor with seccomp user notifications instead of ptrace
+		/// </summary>
+		// [[Args::Option("notifyMonitor", Default = false, HelpText = "Monitor with seccomp user notifications.")]]
+		bool NotifyMonitor;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to monitor with the preloaded monitor client instead of ptrace
+		/// </summary>
+		// [[Args::Option("preloadMonitor", Default = false, HelpText = "Monitor dynamically linked tools with a preloaded client.")]]
+		bool PreloadMonitor;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to run the generate phase in a persistent generate process
+		/// </summary>
+		// [[Args::Option("generateServer", Default = false, HelpText = "Run the generate phase of all packages in a persistent process.")]]
+		bool GenerateServer;
+
 		/// <summary>
 		/// Gets or sets a value indicating whether to force a build
 		/// </summary>
 		// [[Args::Option("force", Default = false, HelpText = "Force a rebuild.")]]
 		bool Force;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to use content digests for up to date checks
+		/// </summary>
+		// [[Args::Option("contentDigest", Default = false, HelpText = "Skip operations whose input content is unchanged.")]]
+		bool ContentDigest;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to use the local build cache
+		/// </summary>
+		// [[Args::Option("cache", Default = false, HelpText = "Restore operation outputs from the local build cache.")]]
+		bool Cache;
+
+		/// <summary>
+		/// Gets or sets the url of the remote build cache
+		/// </summary>
+		// [[Args::Option("remoteCache", Default = "", HelpText = "Share operation outputs through a remote build cache.")]]
+		std::string RemoteCache;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to keep watching for changes and build again
+		/// </summary>
+		// [[Args::Option("watch", Default = false, HelpText = "Build again each time a source file changes.")]]
+		bool Watch;
+
+		/// <summary>
+		/// Gets or sets the maximum number of operations to evaluate in parallel
+		/// </summary>
+		// [[Args::Option('j', "jobs", Default = 1, HelpText = "Maximum number of parallel operations.")]]
+		uint32_t Jobs = 1;
+
 		/// <summary>
 		/// Gets or sets a value indicating what flavor to use
 		/// </summary>
@@ -7,21 +7,30 @@ module;
 
 #include <any>
 #include <array>
+#include <charconv>
 #include <chrono>
 #include <codecvt>
+#include <condition_variable>
 #include <cstring>
 #include <ctime>
+#include <deque>
+#include <filesystem>
 #include <iomanip>
 #include <iostream>
 #include <locale>
 #include <map>
+#include <mutex>
 #include <regex>
 #include <optional>
+#include <queue>
+#include <random>
+#include <semaphore>
 #include <set>
 #include <sstream>
 #include <stack>
 #include <string>
 #include <fstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <variant>
@@ -41,8 +50,14 @@ module;
 
 #elif defined(__linux__)
 
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
 #include <spawn.h>
+#include <sys/inotify.h>
+#include <sys/socket.h>
 #include <sys/wait.h>
+#include <unistd.h>
 
 #endif
 
@@ -0,0 +1,52 @@
+﻿// <copyright file="AllowedAccess.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The access checks for the work that runs without the monitor, matching the allowed access of a monitored process
+	/// </summary>
+	class AllowedAccess
+	{
+	public:
+		/// <summary>
+		/// Check if the file is one of the allowed paths or inside one of the allowed directories
+		/// </summary>
+		static bool IsAllowed(const Path& file, const std::vector<Path>& allowedAccess)
+		{
+			auto fileSegments = GetSegments(file);
+			for (auto& allowed : allowedAccess)
+			{
+				// Compare whole segments so a sibling that only shares the name prefix is not allowed
+				auto allowedSegments = GetSegments(allowed);
+				if (allowedSegments.size() <= fileSegments.size() &&
+					std::equal(allowedSegments.begin(), allowedSegments.end(), fileSegments.begin()))
+				{
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+	private:
+		/// <summary>
+		/// Get the root, every directory and the file name of a path
+		/// </summary>
+		static std::vector<std::string> GetSegments(const Path& path)
+		{
+			auto result = std::vector<std::string>();
+			result.push_back(std::string(path.GetRoot()));
+			for (auto directory : path.DecomposeDirectories())
+				result.push_back(std::string(directory));
+
+			if (path.HasFileName())
+				result.push_back(std::string(path.GetFileName()));
+
+			return result;
+		}
+	};
+}
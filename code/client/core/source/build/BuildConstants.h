@@ -15,6 +15,12 @@ namespace Soup::Core
 	class BuildConstants
 	{
 	public:
+		static const Path& BuildCacheDirectory()
+		{
+			static const auto value = Path("./cache/");
+			return value;
+		}
+
 		static const Path& EvaluateGraphFileName()
 		{
 			static const auto value = Path("./Evaluate.bog");
@@ -27,6 +33,18 @@ namespace Soup::Core
 			return value;
 		}
 
+		static const Path& EvaluateResultsJournalFileName()
+		{
+			static const auto value = Path("./Evaluate.brj");
+			return value;
+		}
+
+		static const Path& FileSystemSnapshotFileName()
+		{
+			static const auto value = Path("./FileSystemSnapshot.bfs");
+			return value;
+		}
+
 		static const Path& GenerateInputFileName()
 		{
 			static const auto value = Path("./GenerateInput.bvt");
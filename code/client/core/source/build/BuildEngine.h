@@ -6,6 +6,9 @@
 #include "BuildRunner.h"
 #include "BuildEvaluateEngine.h"
 #include "BuildLoadEngine.h"
+#include "FileSystemSnapshotManager.h"
+#include "FileSystemWatcher.h"
+#include "HttpRemoteBuildCache.h"
 #include "local-user-config/LocalUserConfigExtensions.h"
 
 namespace Soup::Core
@@ -122,13 +125,19 @@ namespace Soup::Core
 		/// Preload the file system
 		/// </summary>
 		static FileSystemState PreloadFileSystemState(
-			PackageProvider& packageProvider)
+			PackageProvider& packageProvider,
+			const Path& fileSystemSnapshotFile)
 		{
 			auto startTime = std::chrono::high_resolution_clock::now();
 
 			// Initialize a shared File System State to cache file system access
 			auto fileSystemState = FileSystemState();
 
+			// Load the directory listings from the previous build to skip walking unchanged directories
+			auto directorySnapshots = std::map<std::string, DirectorySnapshot>();
+			FileSystemSnapshotManager::TryLoadState(fileSystemSnapshotFile, directorySnapshots);
+			fileSystemState.EnableDirectorySnapshots(std::move(directorySnapshots));
+
 			for (auto package : packageProvider.GetPackageLookup())
 			{
 				fileSystemState.PreloadDirectory(package.second.PackageRoot, true);
@@ -161,14 +170,20 @@ namespace Soup::Core
 			auto systemReadAccess = LoadHostSystemAccess();
 
 			// Load the file system state
-			auto fileSystemState = PreloadFileSystemState(packageProvider);
+			auto fileSystemSnapshotFile = userDataPath + BuildConstants::FileSystemSnapshotFileName();
+			auto fileSystemState = PreloadFileSystemState(packageProvider, fileSystemSnapshotFile);
 
 			// Initialize a shared Evaluate Engine
 			auto evaluateEngine = BuildEvaluateEngine(
 				arguments.ForceRebuild,
 				arguments.DisableMonitor,
 				arguments.PartialMonitor,
-				fileSystemState);
+				arguments.UseContentDigest,
+				arguments.MaxJobs,
+				fileSystemState,
+				CreateBuildCache(arguments, userDataPath, fileSystemState),
+				CreateGenerateServerPool(arguments),
+				LoadBuiltInToolExecutables(packageProvider));
 
 			// Initialize the build runner that will perform the generate and evaluate phase
 			// for each individual package
@@ -183,12 +198,130 @@ namespace Soup::Core
 				locationManager);
 			buildRunner.Execute();
 
+			// Save the directory listings for the next build
+			SaveFileSystemSnapshot(userDataPath, fileSystemSnapshotFile, fileSystemState);
+
 			auto endTime = std::chrono::high_resolution_clock::now();
 			auto duration = std::chrono::duration_cast<std::chrono::duration<double>>(endTime - startTime);
 
 			// Log::Info("BuildRunner: {} seconds", duration.count());
 		}
 
+		/// <summary>
+		/// Keep the build state in memory and build again each time a preloaded file changes.
+		/// Returns when the package graph itself may have changed and must be reloaded.
+		/// </summary>
+		static void Watch(
+			PackageProvider& packageProvider,
+			const RecipeBuildArguments& arguments,
+			const Path& userDataPath,
+			RecipeCache& recipeCache)
+		{
+			// Initialize shared location manager
+			auto knownLanguages = GetKnownLanguages();
+			auto locationManager = RecipeBuildLocationManager(knownLanguages);
+
+			// Load the system specific state
+			auto systemReadAccess = LoadHostSystemAccess();
+
+			// Load the file system state that is kept up to date for all builds
+			auto fileSystemSnapshotFile = userDataPath + BuildConstants::FileSystemSnapshotFileName();
+			auto fileSystemState = PreloadFileSystemState(packageProvider, fileSystemSnapshotFile);
+
+			// Initialize a shared Evaluate Engine
+			auto evaluateEngine = BuildEvaluateEngine(
+				arguments.ForceRebuild,
+				arguments.DisableMonitor,
+				arguments.PartialMonitor,
+				arguments.UseContentDigest,
+				arguments.MaxJobs,
+				fileSystemState,
+				CreateBuildCache(arguments, userDataPath, fileSystemState),
+				CreateGenerateServerPool(arguments),
+				LoadBuiltInToolExecutables(packageProvider));
+
+			auto watcher = FileSystemWatcher();
+			while (true)
+			{
+				// A failed build is reported and the next change will try again
+				try
+				{
+					auto buildRunner = BuildRunner(
+						arguments,
+						userDataPath,
+						systemReadAccess,
+						recipeCache,
+						packageProvider,
+						evaluateEngine,
+						fileSystemState,
+						locationManager);
+					buildRunner.Execute();
+				}
+				catch (const BuildFailedException&)
+				{
+					Log::Error("Build failed");
+				}
+				catch (const std::exception& ex)
+				{
+					// An unexpected error, such as a recipe or graph that failed to load, must not stop the watch
+					Log::Error("Build failed: {}", ex.what());
+				}
+
+				SaveFileSystemSnapshot(userDataPath, fileSystemSnapshotFile, fileSystemState);
+
+				// The changes made by the build itself only need to be applied to the file system state.
+				// A file that was edited after the build observed it must be built again right away.
+				auto changedDuringBuild = false;
+				for (auto& file : watcher.DrainChanges())
+				{
+					if (IsPackageGraphFile(file))
+					{
+						Log::HighPriority("Recipe changed: {}", file.ToString());
+						return;
+					}
+
+					if (fileSystemState.HasObservedFileChanged(file))
+					{
+						Log::HighPriority("File changed during build: {}", file.ToString());
+						changedDuringBuild = true;
+					}
+
+					fileSystemState.NotifyFileChanged(file);
+				}
+
+				if (changedDuringBuild)
+				{
+					continue;
+				}
+
+				// Watch every known directory, including any that were created since the last build
+				for (auto& directory : fileSystemState.GetPreloadedDirectories())
+				{
+					watcher.Watch(directory);
+				}
+
+				Log::HighPriority("Watching for changes...");
+				auto changes = watcher.WaitForChanges();
+
+				if (watcher.HasOverflowed())
+				{
+					Log::Warning("File system changes were dropped, reloading the build state");
+					return;
+				}
+
+				for (auto& file : changes)
+				{
+					if (IsPackageGraphFile(file))
+					{
+						Log::HighPriority("Recipe changed: {}", file.ToString());
+						return;
+					}
+
+					fileSystemState.NotifyFileChanged(file);
+				}
+			}
+		}
+
 		static Path GetSoupUserDataPath()
 		{
 			auto result = System::IFileSystem::Current().GetUserProfileDirectory() +
@@ -197,6 +330,126 @@ namespace Soup::Core
 		}
 
 	private:
+		static void SaveFileSystemSnapshot(
+			const Path& userDataPath,
+			const Path& fileSystemSnapshotFile,
+			const FileSystemState& fileSystemState)
+		{
+			if (!System::IFileSystem::Current().Exists(userDataPath))
+			{
+				System::IFileSystem::Current().CreateDirectory(userDataPath);
+			}
+
+			FileSystemSnapshotManager::SaveState(fileSystemSnapshotFile, fileSystemState.GetDirectorySnapshots());
+		}
+
+		static std::shared_ptr<LocalBuildCache> CreateBuildCache(
+			const RecipeBuildArguments& arguments,
+			const Path& userDataPath,
+			FileSystemState& fileSystemState)
+		{
+			// The remote cache is always accessed through the local cache
+			if (!arguments.UseBuildCache && arguments.RemoteBuildCacheUrl.empty())
+				return nullptr;
+
+			std::shared_ptr<IRemoteBuildCache> remoteCache = nullptr;
+			if (!arguments.RemoteBuildCacheUrl.empty())
+			{
+				Log::Diag("Using remote build cache: {}", arguments.RemoteBuildCacheUrl);
+				remoteCache = std::make_shared<HttpRemoteBuildCache>(arguments.RemoteBuildCacheUrl);
+			}
+
+			auto buildCacheDirectory = userDataPath + BuildConstants::BuildCacheDirectory();
+			Log::Diag("Using build cache: {}", buildCacheDirectory.ToString());
+			return std::make_shared<LocalBuildCache>(buildCacheDirectory, fileSystemState, std::move(remoteCache));
+		}
+
+		static std::shared_ptr<GenerateServerPool> CreateGenerateServerPool(const RecipeBuildArguments& arguments)
+		{
+			if (!arguments.UseGenerateServer)
+				return nullptr;
+
+			#if defined(__linux__)
+			// The server runs the same generate executable as the generate operations
+			auto moduleName = System::IProcessManager::Current().GetCurrentProcessFileName();
+			auto generateExecutable = moduleName.GetParent() + Path("./generate");
+			Log::Diag("Using generate server: {}", generateExecutable.ToString());
+			return std::make_shared<GenerateServerPool>(std::move(generateExecutable));
+			#else
+			Log::Warning("The generate server is not supported on this platform");
+			return nullptr;
+			#endif
+		}
+
+		/// <summary>
+		/// Resolve the executables of the prebuilt built-in tools that the evaluate engine runs in process
+		/// </summary>
+		static std::map<std::string, Path> LoadBuiltInToolExecutables(PackageProvider& packageProvider)
+		{
+			auto toolNames = std::map<PackageName, std::string>(
+			{
+				{ PackageName("mwasplund", "copy"), "copy" },
+				{ PackageName("mwasplund", "mkdir"), "mkdir" },
+			});
+
+			auto result = std::map<std::string, Path>();
+			for (auto& [packageId, packageInfo] : packageProvider.GetPackageLookup())
+			{
+				auto findToolName = toolNames.find(packageInfo.Name);
+				if (!packageInfo.IsPrebuilt || findToolName == toolNames.end())
+					continue;
+
+				auto sharedStateFile = packageInfo.TargetDirectory +
+					BuildConstants::SoupTargetDirectory() +
+					BuildConstants::GenerateSharedStateFileName();
+				auto sharedStateTable = ValueTable();
+				if (!ValueTableManager::TryLoadState(sharedStateFile, sharedStateTable))
+				{
+					Log::Diag("Built-in tool shared state missing: {}", sharedStateFile.ToString());
+					continue;
+				}
+
+				auto findBuild = sharedStateTable.find("Build");
+				if (findBuild == sharedStateTable.end() || !findBuild->second.IsTable())
+					continue;
+
+				auto& buildTable = findBuild->second.AsTable();
+				auto findRunExecutable = buildTable.find("RunExecutable");
+				if (findRunExecutable == buildTable.end() || !findRunExecutable->second.IsString())
+					continue;
+
+				// The prebuilt package refers to its own target directory with the same macro the build runner uses
+				auto macros = std::map<std::string, std::string>(
+				{
+					{
+						std::format("/(TARGET_{})/", packageInfo.Name.ToString()),
+						packageInfo.TargetDirectory.ToString(),
+					},
+				});
+				auto macroManager = MacroManager(macros);
+				auto runExecutable = Path(macroManager.ResolveMacros(findRunExecutable->second.AsString()));
+
+				Log::Diag("Built-in tool {}: {}", findToolName->second, runExecutable.ToString());
+				result.insert_or_assign(findToolName->second, std::move(runExecutable));
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Check if the file contributes to the loaded package graph
+		/// </summary>
+		static bool IsPackageGraphFile(const Path& file)
+		{
+			if (!file.HasFileName())
+				return false;
+
+			auto fileName = file.GetFileName();
+			return fileName == BuildConstants::RecipeFileName().GetFileName() ||
+				fileName == BuildConstants::PackageLockFileName().GetFileName() ||
+				fileName == "RootRecipe.sml";
+		}
+
 		static ValueTable LoadHostSystemState()
 		{
 			auto hostGlobalParameters = ValueTable();
@@ -6,7 +6,11 @@
 #include "IEvaluateEngine.h"
 #include "BuildFailedException.h"
 #include "BuildHistoryChecker.h"
+#include "BuildStateLock.h"
 #include "FileSystemState.h"
+#include "GenerateServer.h"
+#include "LocalBuildCache.h"
+#include "OperationOutputLogger.h"
 #include "operation-graph/OperationGraph.h"
 #include "SystemAccessTracker.h"
 
@@ -127,11 +131,28 @@ namespace Soup::Core
 		bool _forceRebuild;
 		bool _disableMonitor;
 		bool _partialMonitor;
+		bool _useContentDigest;
+		uint32_t _maxJobs;
 
 		// Shared Runtime State
 		FileSystemState& _fileSystemState;
 		BuildHistoryChecker _stateChecker;
 
+		// The optional shared store of operation outputs
+		std::shared_ptr<LocalBuildCache> _buildCache;
+
+		// The optional pool of persistent generate processes
+		std::shared_ptr<GenerateServerPool> _generateServerPool;
+
+		// The resolved executables of the built-in tools that are run in process, keyed by tool name
+		std::map<std::string, Path> _builtInToolExecutables;
+
+		// Process creation is not safe to run concurrently (the Linux ptrace monitor waits on any child inside Start)
+		std::mutex _processStartMutex;
+
+		// The job slots shared by all concurrent evaluations to bound the total number of running processes
+		std::counting_semaphore<> _jobSlots;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
@@ -141,11 +162,104 @@ namespace Soup::Core
 			bool disableMonitor,
 			bool partialMonitor,
 			FileSystemState& fileSystemState) :
+			BuildEvaluateEngine(forceRebuild, disableMonitor, partialMonitor, false, 1, fileSystemState)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
+		/// </summary>
+		BuildEvaluateEngine(
+			bool forceRebuild,
+			bool disableMonitor,
+			bool partialMonitor,
+			bool useContentDigest,
+			uint32_t maxJobs,
+			FileSystemState& fileSystemState) :
+			BuildEvaluateEngine(
+				forceRebuild,
+				disableMonitor,
+				partialMonitor,
+				useContentDigest,
+				maxJobs,
+				fileSystemState,
+				nullptr)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
+		/// </summary>
+		BuildEvaluateEngine(
+			bool forceRebuild,
+			bool disableMonitor,
+			bool partialMonitor,
+			bool useContentDigest,
+			uint32_t maxJobs,
+			FileSystemState& fileSystemState,
+			std::shared_ptr<LocalBuildCache> buildCache) :
+			BuildEvaluateEngine(
+				forceRebuild,
+				disableMonitor,
+				partialMonitor,
+				useContentDigest,
+				maxJobs,
+				fileSystemState,
+				std::move(buildCache),
+				nullptr)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
+		/// </summary>
+		BuildEvaluateEngine(
+			bool forceRebuild,
+			bool disableMonitor,
+			bool partialMonitor,
+			bool useContentDigest,
+			uint32_t maxJobs,
+			FileSystemState& fileSystemState,
+			std::shared_ptr<LocalBuildCache> buildCache,
+			std::shared_ptr<GenerateServerPool> generateServerPool) :
+			BuildEvaluateEngine(
+				forceRebuild,
+				disableMonitor,
+				partialMonitor,
+				useContentDigest,
+				maxJobs,
+				fileSystemState,
+				std::move(buildCache),
+				std::move(generateServerPool),
+				{})
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="BuildEvaluateEngine"/> class.
+		/// </summary>
+		BuildEvaluateEngine(
+			bool forceRebuild,
+			bool disableMonitor,
+			bool partialMonitor,
+			bool useContentDigest,
+			uint32_t maxJobs,
+			FileSystemState& fileSystemState,
+			std::shared_ptr<LocalBuildCache> buildCache,
+			std::shared_ptr<GenerateServerPool> generateServerPool,
+			std::map<std::string, Path> builtInToolExecutables) :
 			_forceRebuild(forceRebuild),
 			_disableMonitor(disableMonitor),
 			_partialMonitor(partialMonitor),
+			_useContentDigest(useContentDigest),
+			_maxJobs(maxJobs),
 			_fileSystemState(fileSystemState),
-			_stateChecker(fileSystemState)
+			_stateChecker(fileSystemState),
+			_buildCache(std::move(buildCache)),
+			_generateServerPool(std::move(generateServerPool)),
+			_builtInToolExecutables(std::move(builtInToolExecutables)),
+			_processStartMutex(),
+			_jobSlots(std::max<uint32_t>(maxJobs, 1))
 		{
 		}
 
@@ -168,15 +282,48 @@ namespace Soup::Core
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
 
-			auto result = CheckExecuteOperations(
-				evaluateState,
-				operationGraph.GetRootOperationIds());
+			bool result;
+			if (_maxJobs > 1)
+			{
+				result = ParallelExecuteOperations(evaluateState);
+			}
+			else
+			{
+				result = CheckExecuteOperations(
+					evaluateState,
+					operationGraph.GetRootOperationIds());
+			}
+
 			Log::Diag("Build evaluation end");
 
 			return result;
 		}
 
 	private:
+		/// <summary>
+		/// The in flight state for a single external operation
+		/// </summary>
+		struct OperationExecution
+		{
+			std::shared_ptr<SystemAccessTracker> Monitor;
+			std::shared_ptr<System::IProcess> Process;
+
+			// The logger that streams the process output while it runs, if any
+			std::shared_ptr<OperationOutputLogger> OutputLogger;
+
+			// The time before the process was started, an input written after this time was not seen by the run
+			std::chrono::time_point<std::chrono::file_clock> StartTime;
+		};
+
+		/// <summary>
+		/// A completed notification from a parallel operation worker
+		/// </summary>
+		struct CompletedOperation
+		{
+			OperationId Id;
+			std::exception_ptr Exception;
+		};
+
 		/// <summary>
 		/// Execute the collection of build operations
 		/// </summary>
@@ -187,25 +334,9 @@ namespace Soup::Core
 			bool didAnyEvaluate = false;
 			for (auto operationId : operations)
 			{
-				// Check if the operation was already a child from a different path
 				// Only run the operation when all of its dependencies have completed
 				auto& operationInfo = evaluateState.OperationGraph.GetOperationInfo(operationId);
-				auto currentOperationSearch = evaluateState.RemainingDependencyCounts.find(operationId);
-				int32_t remainingCount = -1;
-				if (currentOperationSearch != evaluateState.RemainingDependencyCounts.end())
-				{
-					remainingCount = --currentOperationSearch->second;
-				}
-				else
-				{
-					// Get the cached total count and store the active count in the lookup
-					remainingCount = operationInfo.DependencyCount - 1;
-					auto insertResult = evaluateState.RemainingDependencyCounts.emplace(operationId, remainingCount);
-					if (!insertResult.second)
-						throw std::runtime_error("The operation id already existed in the remaining count lookup");
-				}
-
-				if (remainingCount == 0)
+				if (ReleaseOperation(evaluateState, operationInfo))
 				{
 					// Run the single operation
 					didAnyEvaluate |= CheckExecuteOperation(
@@ -217,25 +348,259 @@ namespace Soup::Core
 						evaluateState,
 						operationInfo.Children);
 				}
-				else if (remainingCount < 0)
+			}
+
+			return didAnyEvaluate;
+		}
+
+		/// <summary>
+		/// Execute the operation graph with up to the max jobs count of external operations running at the same time.
+		/// All incremental checks, observed state verification and result updates stay on the calling thread,
+		/// the worker threads only run the external processes.
+		/// </summary>
+		bool ParallelExecuteOperations(BuildEvaluateState& evaluateState)
+		{
+			bool didAnyEvaluate = false;
+			auto readyOperations = std::queue<OperationId>();
+			ReleaseOperations(evaluateState, evaluateState.OperationGraph.GetRootOperationIds(), readyOperations);
+
+			auto activeOperations = std::map<OperationId, std::pair<OperationExecution, std::thread>>();
+			auto completedMutex = std::mutex();
+			auto completedCondition = std::condition_variable();
+			auto completedOperations = std::queue<CompletedOperation>();
+
+			// On failure stop scheduling new operations and drain the active set so that
+			// every operation that did complete successfully has its result saved
+			std::exception_ptr failure = nullptr;
+			while (true)
+			{
+				while (failure == nullptr && !readyOperations.empty() && activeOperations.size() < _maxJobs)
+				{
+					auto operationId = readyOperations.front();
+					readyOperations.pop();
+
+					try
+					{
+						auto& operationInfo = evaluateState.OperationGraph.GetOperationInfo(operationId);
+						if (!IsBuildRequired(evaluateState, operationInfo))
+						{
+							Log::Info(operationInfo.Title);
+							ReleaseOperations(evaluateState, operationInfo.Children, readyOperations);
+							continue;
+						}
+
+						didAnyEvaluate = true;
+						LogExecuteOperation(operationInfo);
+
+						// In-process operations are cheap, run them inline
+						auto inProcessResult = OperationResult();
+						if (TryExecuteInProcessOperation(
+							evaluateState.GlobalAllowedReadAccess,
+							evaluateState.GlobalAllowedWriteAccess,
+							operationInfo,
+							inProcessResult))
+						{
+							CompleteOperation(evaluateState, operationInfo, std::move(inProcessResult), false);
+							ReleaseOperations(evaluateState, operationInfo.Children, readyOperations);
+							continue;
+						}
+
+						auto restoredResult = OperationResult();
+						if (TryRestoreOperation(operationInfo, restoredResult))
+						{
+							CompleteOperation(evaluateState, operationInfo, std::move(restoredResult), false);
+							ReleaseOperations(evaluateState, operationInfo.Children, readyOperations);
+							continue;
+						}
+
+						auto execution = CreateOperationExecution(
+							evaluateState.TemporaryDirectory,
+							evaluateState.GlobalAllowedReadAccess,
+							evaluateState.GlobalAllowedWriteAccess,
+							operationInfo);
+
+						auto worker = std::thread(
+							[this, operationId, process = execution.Process, &completedMutex, &completedCondition, &completedOperations]()
+							{
+								std::exception_ptr exception = nullptr;
+								try
+								{
+									RunProcess(*process, nullptr);
+								}
+								catch (...)
+								{
+									exception = std::current_exception();
+								}
+
+								{
+									auto lock = std::lock_guard<std::mutex>(completedMutex);
+									completedOperations.push(CompletedOperation({ operationId, exception }));
+								}
+
+								completedCondition.notify_one();
+							});
+
+						activeOperations.emplace(
+							operationId,
+							std::make_pair(std::move(execution), std::move(worker)));
+					}
+					catch (...)
+					{
+						failure = std::current_exception();
+					}
+				}
+
+				if (activeOperations.empty())
+					break;
+
+				// Wait for the next active operation to finish
+				auto completed = CompletedOperation();
 				{
-					throw std::runtime_error("Remaining dependency count less than zero");
+					auto release = BuildStateLock::ScopedRelease();
+					auto lock = std::unique_lock<std::mutex>(completedMutex);
+					completedCondition.wait(lock, [&completedOperations]() { return !completedOperations.empty(); });
+					completed = completedOperations.front();
+					completedOperations.pop();
 				}
-				else
+
+				auto findActive = activeOperations.find(completed.Id);
+				if (findActive == activeOperations.end())
+					throw std::runtime_error("Completed operation was not active");
+
+				findActive->second.second.join();
+				auto execution = std::move(findActive->second.first);
+				activeOperations.erase(findActive);
+
+				try
 				{
-					// This operation will be executed from a different path
+					if (completed.Exception != nullptr)
+					{
+						execution.Monitor->LogPendingMessages();
+						std::rethrow_exception(completed.Exception);
+					}
+
+					auto& operationInfo = evaluateState.OperationGraph.GetOperationInfo(completed.Id);
+					auto operationResult = OperationResult();
+					CompleteOperationExecution(
+						execution,
+						operationInfo,
+						operationResult);
+					CompleteOperation(evaluateState, operationInfo, std::move(operationResult), true);
+
+					if (failure == nullptr)
+						ReleaseOperations(evaluateState, operationInfo.Children, readyOperations);
+				}
+				catch (...)
+				{
+					if (failure == nullptr)
+						failure = std::current_exception();
 				}
 			}
 
+			if (failure != nullptr)
+				std::rethrow_exception(failure);
+
 			return didAnyEvaluate;
 		}
 
+		/// <summary>
+		/// Release each of the operations and queue the ones that have no remaining dependencies
+		/// </summary>
+		void ReleaseOperations(
+			BuildEvaluateState& evaluateState,
+			const std::vector<OperationId>& operations,
+			std::queue<OperationId>& readyOperations)
+		{
+			for (auto operationId : operations)
+			{
+				auto& operationInfo = evaluateState.OperationGraph.GetOperationInfo(operationId);
+				if (ReleaseOperation(evaluateState, operationInfo))
+				{
+					readyOperations.push(operationId);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Mark a single dependency of the operation as completed and check if it is ready to run
+		/// </summary>
+		bool ReleaseOperation(
+			BuildEvaluateState& evaluateState,
+			const OperationInfo& operationInfo)
+		{
+			// Check if the operation was already a child from a different path
+			auto currentOperationSearch = evaluateState.RemainingDependencyCounts.find(operationInfo.Id);
+			int32_t remainingCount = -1;
+			if (currentOperationSearch != evaluateState.RemainingDependencyCounts.end())
+			{
+				remainingCount = --currentOperationSearch->second;
+			}
+			else
+			{
+				// Get the cached total count and store the active count in the lookup
+				remainingCount = operationInfo.DependencyCount - 1;
+				auto insertResult = evaluateState.RemainingDependencyCounts.emplace(operationInfo.Id, remainingCount);
+				if (!insertResult.second)
+					throw std::runtime_error("The operation id already existed in the remaining count lookup");
+			}
+
+			if (remainingCount < 0)
+			{
+				throw std::runtime_error("Remaining dependency count less than zero");
+			}
+
+			// Otherwise this operation will be executed from a different path
+			return remainingCount == 0;
+		}
+
 		/// <summary>
 		/// Check if an individual operation has been run and execute if required
 		/// </summary>
 		bool CheckExecuteOperation(
 			BuildEvaluateState& evaluateState,
 			const OperationInfo& operationInfo)
+		{
+			auto buildRequired = IsBuildRequired(evaluateState, operationInfo);
+			if (buildRequired)
+			{
+				LogExecuteOperation(operationInfo);
+
+				auto operationResult = OperationResult();
+				bool wasExecuted = false;
+
+				// Check for special in-process operations before the cache
+				if (!TryExecuteInProcessOperation(
+						evaluateState.GlobalAllowedReadAccess,
+						evaluateState.GlobalAllowedWriteAccess,
+						operationInfo,
+						operationResult) &&
+					!TryRestoreOperation(operationInfo, operationResult))
+				{
+					ExecuteOperation(
+						evaluateState.TemporaryDirectory,
+						evaluateState.GlobalAllowedReadAccess,
+						evaluateState.GlobalAllowedWriteAccess,
+						operationInfo,
+						operationResult);
+					wasExecuted = true;
+				}
+
+				CompleteOperation(evaluateState, operationInfo, std::move(operationResult), wasExecuted);
+			}
+			else
+			{
+				Log::Info(operationInfo.Title);
+			}
+
+			return buildRequired;
+		}
+
+		/// <summary>
+		/// Check if an individual operation is out of date with respect to its previous invocation
+		/// </summary>
+		bool IsBuildRequired(
+			BuildEvaluateState& evaluateState,
+			const OperationInfo& operationInfo)
 		{
 			// Check if each source file is out of date and requires a rebuild
 			Log::Diag("Check for previous operation invocation");
@@ -263,9 +628,28 @@ namespace Soup::Core
 
 				// Perform the incremental build checks
 				if (executableOutOfDate ||
-					_stateChecker.IsOutdated(previousResult->ObservedOutput, previousResult->ObservedInput))
+					_stateChecker.IsOutdated(previousResult->EvaluateTime, previousResult->ObservedOutput, previousResult->ObservedInput))
 				{
-					buildRequired = true;
+					// Allow an early cutoff when the file timestamps changed but the content did not
+					if (_useContentDigest &&
+						!executableOutOfDate &&
+						!_forceRebuild &&
+						_stateChecker.HasMatchingContent(previousResult->ObservedInput, previousResult->ObservedInputDigests) &&
+						_stateChecker.HasMatchingContent(previousResult->ObservedOutput, previousResult->ObservedOutputDigests))
+					{
+						Log::Info("Up to date: Content unchanged");
+
+						// Save the new evaluate time so the touched files pass the timestamp check next time
+						auto refreshedResult = *previousResult;
+						refreshedResult.EvaluateTime = System::ISystem::Current().GetCurrentTime();
+						evaluateState.OperationResults.AddOrUpdateOperationResult(
+							operationInfo.Id,
+							std::move(refreshedResult));
+					}
+					else
+					{
+						buildRequired = true;
+					}
 				}
 				else
 				{
@@ -287,49 +671,268 @@ namespace Soup::Core
 				buildRequired = true;
 			}
 
-			if (buildRequired)
+			return buildRequired;
+		}
+
+		/// <summary>
+		/// Hash the current content of each file, missing files are recorded with an empty digest
+		/// </summary>
+		std::vector<std::string> GetContentDigests(const std::vector<FileId>& files)
+		{
+			auto result = std::vector<std::string>();
+			result.reserve(files.size());
+			for (auto file : files)
 			{
-				Log::HighPriority(operationInfo.Title);
-				auto messageBuilder = std::stringstream();
-				messageBuilder << "Execute: [" << operationInfo.Command.WorkingDirectory.ToString() << "] ";
-				messageBuilder << operationInfo.Command.Executable.ToString();
-				for (auto& argument : operationInfo.Command.Arguments)
-					messageBuilder << " " << argument;
+				auto contentDigest = _fileSystemState.GetContentDigest(file);
+				result.push_back(contentDigest.has_value() ? std::move(contentDigest.value()) : std::string());
+			}
 
-				Log::Diag(messageBuilder.str());
+			return result;
+		}
 
-				auto operationResult = OperationResult();
+		void LogExecuteOperation(const OperationInfo& operationInfo)
+		{
+			Log::HighPriority(operationInfo.Title);
+			auto messageBuilder = std::stringstream();
+			messageBuilder << "Execute: [" << operationInfo.Command.WorkingDirectory.ToString() << "] ";
+			messageBuilder << operationInfo.Command.Executable.ToString();
+			for (auto& argument : operationInfo.Command.Arguments)
+				messageBuilder << " " << argument;
 
-				// Check for special in-process write operations
-				if (operationInfo.Command.Executable == Path("./writefile.exe"))
+			Log::Diag(messageBuilder.str());
+		}
+
+		/// <summary>
+		/// Restore the operation outputs from the build cache instead of running the operation
+		/// </summary>
+		bool TryRestoreOperation(
+			const OperationInfo& operationInfo,
+			OperationResult& operationResult)
+		{
+			// A forced build always runs the operation
+			if (_buildCache == nullptr || _forceRebuild)
+				return false;
+
+			return _buildCache->TryRestore(operationInfo, operationResult);
+		}
+
+		/// <summary>
+		/// Verify and save the result of a successful operation
+		/// </summary>
+		void CompleteOperation(
+			BuildEvaluateState& evaluateState,
+			const OperationInfo& operationInfo,
+			OperationResult operationResult,
+			bool storeInCache)
+		{
+			// Ensure there are no new dependencies
+			VerifyObservedState(evaluateState, operationInfo, operationResult);
+
+			if (_useContentDigest)
+			{
+				operationResult.ObservedInputDigests = GetContentDigests(operationResult.ObservedInput);
+				operationResult.ObservedOutputDigests = GetContentDigests(operationResult.ObservedOutput);
+			}
+
+			auto& result = evaluateState.OperationResults.AddOrUpdateOperationResult(
+				operationInfo.Id,
+				std::move(operationResult));
+
+			// A failure to update the cache must never fail the build
+			if (storeInCache && _buildCache != nullptr)
+			{
+				try
 				{
-					ExecuteWriteFileOperation(
-						operationInfo,
-						operationResult);
+					_buildCache->Store(operationInfo, result);
 				}
-				else
+				catch (const std::exception& ex)
 				{
-					ExecuteOperation(
-						evaluateState.TemporaryDirectory,
-						evaluateState.GlobalAllowedReadAccess,
-						evaluateState.GlobalAllowedWriteAccess,
-						operationInfo,
-						operationResult);
+					Log::Warning("Failed to store build cache entry: {}", ex.what());
 				}
+			}
+		}
 
-				// Ensure there are no new dependencies
-				VerifyObservedState(evaluateState, operationInfo, operationResult);
+		/// <summary>
+		/// Run the operations that do not need a monitored process, returns false for any other operation
+		/// </summary>
+		bool TryExecuteInProcessOperation(
+			const std::vector<Path>& globalAllowedReadAccess,
+			const std::vector<Path>& globalAllowedWriteAccess,
+			const OperationInfo& operationInfo,
+			OperationResult& operationResult)
+		{
+			auto& executable = operationInfo.Command.Executable;
+			auto argumentCount = operationInfo.Command.Arguments.size();
+			if (executable == Path("./writefile.exe"))
+			{
+				ExecuteWriteFileOperation(operationInfo, operationResult);
+			}
+			else if (argumentCount == 2 && IsBuiltInTool(executable, "copy"))
+			{
+				ExecuteCopyOperation(globalAllowedReadAccess, globalAllowedWriteAccess, operationInfo, operationResult);
+			}
+			else if (argumentCount == 1 && IsBuiltInTool(executable, "mkdir"))
+			{
+				ExecuteMakeDirectoryOperation(globalAllowedWriteAccess, operationInfo, operationResult);
+			}
+			else
+			{
+				return false;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Check if the executable is the resolved built-in tool with the provided name, any other tool of the same
+		/// name is not guaranteed to behave the same and still runs as a process
+		/// </summary>
+		bool IsBuiltInTool(const Path& executable, const std::string& name) const
+		{
+			auto findTool = _builtInToolExecutables.find(name);
+			return findTool != _builtInToolExecutables.end() && findTool->second == executable;
+		}
+
+		/// <summary>
+		/// Execute a copy operation in process, the same as the built-in copy tool
+		/// </summary>
+		void ExecuteCopyOperation(
+			const std::vector<Path>& globalAllowedReadAccess,
+			const std::vector<Path>& globalAllowedWriteAccess,
+			const OperationInfo& operationInfo,
+			OperationResult& operationResult)
+		{
+			auto& workingDirectory = operationInfo.Command.WorkingDirectory;
+			auto source = Path::Parse(operationInfo.Command.Arguments[0]);
+			auto destination = Path::Parse(operationInfo.Command.Arguments[1]);
+			auto sourcePath = source.HasRoot() ? source : workingDirectory + source;
+			auto destinationPath = destination.HasRoot() ? destination : workingDirectory + destination;
+
+			Log::Diag("Execute InProcess Copy: {} -> {}", sourcePath.ToString(), destinationPath.ToString());
+			auto startTime = System::ISystem::Current().GetCurrentTime();
+
+			// Apply the same access checks the monitor applies to the copy tool
+			EnsureAccessAllowed(sourcePath, GetAllowedAccess(operationInfo.ReadAccess, globalAllowedReadAccess), "read");
+			EnsureAccessAllowed(destinationPath, GetAllowedAccess(operationInfo.WriteAccess, globalAllowedWriteAccess), "write");
 
-				evaluateState.OperationResults.AddOrUpdateOperationResult(
-					operationInfo.Id,
-					std::move(operationResult));
+			auto sourceFile = _fileSystemState.ToFileId(sourcePath, workingDirectory);
+			auto destinationFile = _fileSystemState.ToFileId(destinationPath, workingDirectory);
+			operationResult.ObservedInput = { sourceFile, };
+			operationResult.ObservedOutput = { destinationFile, };
+
+			// Leave an identical destination untouched so everything that reads it stays up to date
+			if (HasIdenticalContent(sourcePath, sourceFile, destinationPath, destinationFile))
+			{
+				Log::Diag("Copy skipped, destination is identical");
 			}
 			else
 			{
-				Log::Info(operationInfo.Title);
+				try
+				{
+					// Keep the file permissions, a copied executable must still be executable
+					std::filesystem::copy_file(
+						sourcePath.ToString(),
+						destinationPath.ToString(),
+						std::filesystem::copy_options::overwrite_existing);
+				}
+				catch (const std::exception& ex)
+				{
+					Log::Error("Copy failed: {}", ex.what());
+					throw BuildFailedException();
+				}
+
+				// Ensure the File System State is notified of any output files that have changed
+				_fileSystemState.InvalidateFileWriteTimes(operationResult.ObservedOutput);
 			}
 
-			return buildRequired;
+			// Mark this operation as successful to enable future incremental builds
+			operationResult.WasSuccessfulRun = true;
+			operationResult.EvaluateTime = startTime;
+		}
+
+		/// <summary>
+		/// Check if the destination of a copy already has the same size and content digest as the source
+		/// </summary>
+		bool HasIdenticalContent(
+			const Path& sourcePath,
+			FileId sourceFile,
+			const Path& destinationPath,
+			FileId destinationFile)
+		{
+			auto errorCode = std::error_code();
+			auto sourceSize = std::filesystem::file_size(sourcePath.ToString(), errorCode);
+			if (errorCode)
+				return false;
+			auto destinationSize = std::filesystem::file_size(destinationPath.ToString(), errorCode);
+			if (errorCode || sourceSize != destinationSize)
+				return false;
+
+			auto sourceDigest = _fileSystemState.GetContentDigest(sourceFile);
+			auto destinationDigest = _fileSystemState.GetContentDigest(destinationFile);
+			return sourceDigest.has_value() && sourceDigest == destinationDigest;
+		}
+
+		/// <summary>
+		/// Execute a make directory operation in process, the same as the built-in mkdir tool
+		/// </summary>
+		void ExecuteMakeDirectoryOperation(
+			const std::vector<Path>& globalAllowedWriteAccess,
+			const OperationInfo& operationInfo,
+			OperationResult& operationResult)
+		{
+			auto& workingDirectory = operationInfo.Command.WorkingDirectory;
+			auto directory = Path::Parse(operationInfo.Command.Arguments[0]);
+			auto directoryPath = directory.HasRoot() ? directory : workingDirectory + directory;
+
+			Log::Diag("Execute InProcess Mkdir: {}", directoryPath.ToString());
+
+			// Apply the same access checks the monitor applies to the mkdir tool
+			EnsureAccessAllowed(directoryPath, GetAllowedAccess(operationInfo.WriteAccess, globalAllowedWriteAccess), "write");
+
+			// Leave an existing directory untouched, touching it would only make every operation
+			// that reads the directory look outdated
+			auto& fileSystem = System::IFileSystem::Current();
+			if (!fileSystem.Exists(directoryPath))
+			{
+				fileSystem.CreateDirectory(directoryPath);
+			}
+
+			operationResult.ObservedInput = {};
+			operationResult.ObservedOutput = {
+				_fileSystemState.ToFileId(directoryPath, workingDirectory),
+			};
+
+			// Mark this operation as successful to enable future incremental builds
+			operationResult.WasSuccessfulRun = true;
+			operationResult.EvaluateTime = System::ISystem::Current().GetCurrentTime();
+
+			// Ensure the File System State is notified of any output files that have changed
+			_fileSystemState.InvalidateFileWriteTimes(operationResult.ObservedOutput);
+		}
+
+		/// <summary>
+		/// Get the paths an operation is allowed to access, the declared access and the global overrides
+		/// </summary>
+		std::vector<Path> GetAllowedAccess(
+			const std::vector<FileId>& access,
+			const std::vector<Path>& globalAllowedAccess)
+		{
+			auto result = _fileSystemState.GetFilePaths(access);
+			std::copy(globalAllowedAccess.begin(), globalAllowedAccess.end(), std::back_inserter(result));
+			return result;
+		}
+
+		/// <summary>
+		/// Fail the operation if the file is outside of the allowed access, unchecked the same as a process when
+		/// the monitor is disabled
+		/// </summary>
+		void EnsureAccessAllowed(const Path& file, const std::vector<Path>& allowedAccess, std::string_view accessType)
+		{
+			if (!_disableMonitor && !AllowedAccess::IsAllowed(file, allowedAccess))
+			{
+				Log::Error("File {} access denied: {}", accessType, file.ToString());
+				throw BuildFailedException();
+			}
 		}
 
 		/// <summary>
@@ -381,6 +984,38 @@ namespace Soup::Core
 			const OperationInfo& operationInfo,
 			OperationResult& operationResult)
 		{
+			auto execution = CreateOperationExecution(
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess,
+				operationInfo);
+
+			try
+			{
+				RunProcess(*execution.Process, execution.OutputLogger.get());
+			}
+			catch (...)
+			{
+				execution.Monitor->LogPendingMessages();
+				throw;
+			}
+
+			CompleteOperationExecution(
+				execution,
+				operationInfo,
+				operationResult);
+		}
+
+		/// <summary>
+		/// Setup the monitored process for a single build operation
+		/// </summary>
+		OperationExecution CreateOperationExecution(
+			const Path& temporaryDirectory,
+			const std::vector<Path>& globalAllowedReadAccess,
+			const std::vector<Path>& globalAllowedWriteAccess,
+			const OperationInfo& operationInfo)
+		{
+			auto startTime = System::ISystem::Current().GetCurrentTime();
 			auto monitor = std::make_shared<SystemAccessTracker>();
 
 			// Add the temp folder to the environment
@@ -409,7 +1044,25 @@ namespace Soup::Core
 			for (auto& file : allowedWriteAccess)
 				Log::Diag(file.ToString());
 
+			// Stream the output while the process runs when it is the only work in progress,
+			// parallel operations keep collecting the output so each one is logged as a single block
+			std::shared_ptr<OperationOutputLogger> outputLogger = nullptr;
 			std::shared_ptr<System::IProcess> process = nullptr;
+#if defined(__linux__)
+			if (_generateServerPool != nullptr && _generateServerPool->IsServerExecutable(operationInfo.Command.Executable))
+			{
+				// The generate server reports the files it accessed instead of being monitored
+				process = std::make_shared<GenerateServerProcess>(
+					_generateServerPool,
+					operationInfo.Command.Arguments,
+					monitor,
+					std::move(allowedReadAccess),
+					std::move(allowedWriteAccess));
+
+				return OperationExecution({ std::move(monitor), std::move(process), std::move(outputLogger), startTime });
+			}
+#endif
+
 			if (_disableMonitor)
 			{
 				process = System::IProcessManager::Current().CreateProcess(
@@ -420,6 +1073,9 @@ namespace Soup::Core
 			}
 			else
 			{
+				if (_maxJobs <= 1)
+					outputLogger = std::make_shared<OperationOutputLogger>();
+
 				process = Monitor::IMonitorProcessManager::Current().CreateMonitorProcess(
 					operationInfo.Command.Executable,
 					operationInfo.Command.Arguments,
@@ -429,18 +1085,95 @@ namespace Soup::Core
 					enableAccessChecks,
 					_partialMonitor,
 					std::move(allowedReadAccess),
-					std::move(allowedWriteAccess));
+					std::move(allowedWriteAccess),
+					outputLogger);
+			}
+
+			return OperationExecution({ std::move(monitor), std::move(process), std::move(outputLogger), startTime });
+		}
+
+		/// <summary>
+		/// Run the process to completion, safe to call from a worker thread.
+		/// The streamed output is logged by this thread while it waits, the process is waited on by a helper thread.
+		/// </summary>
+		void RunProcess(System::IProcess& process, OperationOutputLogger* outputLogger)
+		{
+			// Allow other package builds to make progress while blocked on the external process
+			auto release = BuildStateLock::ScopedRelease();
+
+			_jobSlots.acquire();
+			try
+			{
+				{
+					auto lock = std::lock_guard<std::mutex>(_processStartMutex);
+					process.Start();
+				}
+
+				if (outputLogger != nullptr)
+				{
+					auto waitException = std::exception_ptr();
+					auto waiter = std::thread(
+						[&process, outputLogger, &waitException]()
+						{
+							try
+							{
+								process.WaitForExit();
+							}
+							catch (...)
+							{
+								waitException = std::current_exception();
+							}
+
+							outputLogger->Complete();
+						});
+
+					outputLogger->LogUntilComplete();
+					waiter.join();
+
+					if (waitException != nullptr)
+						std::rethrow_exception(waitException);
+				}
+				else
+				{
+					process.WaitForExit();
+				}
+			}
+			catch (...)
+			{
+				_jobSlots.release();
+				throw;
 			}
 
-			process->Start();
-			process->WaitForExit();
+			_jobSlots.release();
+		}
+
+		/// <summary>
+		/// Process the result of a finished operation process
+		/// </summary>
+		void CompleteOperationExecution(
+			OperationExecution& execution,
+			const OperationInfo& operationInfo,
+			OperationResult& operationResult)
+		{
+			auto& process = *execution.Process;
+			auto& monitor = *execution.Monitor;
+
+			auto stdOut = process.GetStandardOutput();
+			auto stdErr = process.GetStandardError();
+			auto exitCode = process.GetExitCode();
+
+			if (execution.OutputLogger != nullptr)
+			{
+				execution.OutputLogger->Flush();
 
-			auto stdOut = process->GetStandardOutput();
-			auto stdErr = process->GetStandardError();
-			auto exitCode = process->GetExitCode();
+				// The streamed output was logged before the exit code was known, repeat it so a failure is upgraded below
+				if (exitCode != 0)
+					stdOut = execution.OutputLogger->TakeStandardOutput();
+			}
 
 			// Check the result of the monitor
-			monitor->VerifyResult();
+			monitor.LogPendingMessages();
+			monitor.VerifyResult();
 
 			if (!stdOut.empty())
 			{
@@ -461,36 +1194,16 @@ namespace Soup::Core
 			if (exitCode == 0)
 			{
 				// Save off the build graph for future builds
-				auto input = std::vector<Path>();
-				for (auto& value : monitor->GetInput())
-				{
-					auto path = Path::Parse(value);
-					#ifdef TRACE_FILE_SYSTEM_STATE
-						Log::Diag("ObservedInput: {}", path.ToString());
-					#endif
-					input.push_back(std::move(path));
-				}
-
-				auto output = std::vector<Path>();
-				for (auto& value : monitor->GetOutput())
-				{
-					auto path = Path::Parse(value);
-					#ifdef TRACE_FILE_SYSTEM_STATE
-						Log::Diag("ObservedOutput: {}", path.ToString());
-					#endif
-					output.push_back(std::move(path));
-				}
-
-				operationResult.ObservedInput = _fileSystemState.ToFileIds(
-					input,
+				operationResult.ObservedInput = monitor.GetInput(
+					_fileSystemState,
 					operationInfo.Command.WorkingDirectory);
-				operationResult.ObservedOutput = _fileSystemState.ToFileIds(
-					output,
+				operationResult.ObservedOutput = monitor.GetOutput(
+					_fileSystemState,
 					operationInfo.Command.WorkingDirectory);
 
 				// Mark this operation as successful to enable future incremental builds
 				operationResult.WasSuccessfulRun = true;
-				operationResult.EvaluateTime = System::ISystem::Current().GetCurrentTime();
+				operationResult.EvaluateTime = execution.StartTime;
 
 				// Ensure the File System State is notified of any output files that have changed
 				_fileSystemState.InvalidateFileWriteTimes(operationResult.ObservedOutput);
@@ -61,6 +61,25 @@ namespace Soup::Core
 		bool IsOutdated(
 			const std::vector<FileId>& targetFiles,
 			const std::vector<FileId>& inputFiles)
+		{
+			return IsOutdated(
+				std::chrono::time_point<std::chrono::file_clock>::min(),
+				targetFiles,
+				inputFiles);
+		}
+
+		/// <summary>
+		/// Perform a check if the requested target is outdated with
+		/// respect to the input files, an input that was already seen by the
+		/// last evaluate is never outdated even when it is newer than the target.
+		/// This allows an evaluate to leave an identical target untouched.
+		/// The last evaluate time must be taken before the operation started so
+		/// an input that changed while it ran is still outdated.
+		/// </summary>
+		bool IsOutdated(
+			std::chrono::time_point<std::chrono::file_clock> lastEvaluateTime,
+			const std::vector<FileId>& targetFiles,
+			const std::vector<FileId>& inputFiles)
 		{
 			// If there are no input files then the output can never be outdated
 			if (inputFiles.empty())
@@ -68,7 +87,7 @@ namespace Soup::Core
 
 			for (auto& targetFile : targetFiles)
 			{
-				if (IsOutdated(targetFile, inputFiles))
+				if (IsOutdated(targetFile, inputFiles, lastEvaluateTime))
 				{
 					return true;
 				}
@@ -77,6 +96,32 @@ namespace Soup::Core
 			return false;
 		}
 
+		/// <summary>
+		/// Perform a check if the current content of every file matches the
+		/// digests recorded during the last evaluate
+		/// </summary>
+		bool HasMatchingContent(
+			const std::vector<FileId>& files,
+			const std::vector<std::string>& contentDigests)
+		{
+			// Results without recorded digests can never be verified by content
+			if (files.size() != contentDigests.size())
+				return false;
+
+			for (auto i = 0u; i < files.size(); i++)
+			{
+				auto contentDigest = _fileSystemState.GetContentDigest(files[i]);
+				if (!contentDigest.has_value() || contentDigest.value() != contentDigests[i])
+				{
+					auto filePath = _fileSystemState.GetFilePath(files[i]);
+					Log::Info("Content altered [{}]", filePath.ToString());
+					return false;
+				}
+			}
+
+			return true;
+		}
+
 	private:
 		/// <summary>
 		/// Perform a check if the requested target is outdated with
@@ -84,7 +129,8 @@ namespace Soup::Core
 		/// </summary>
 		bool IsOutdated(
 			FileId targetFile,
-			const std::vector<FileId>& inputFiles)
+			const std::vector<FileId>& inputFiles,
+			std::chrono::time_point<std::chrono::file_clock> lastEvaluateTime)
 		{
 			// Get the output file last write time
 			auto targetFileLastWriteTime = _fileSystemState.GetLastWriteTime(targetFile);
@@ -100,7 +146,7 @@ namespace Soup::Core
 			for (auto& inputFile : inputFiles)
 			{
 				// If the file is relative then combine it with the root path
-				if (IsOutdated(inputFile, targetFile, targetFileLastWriteTime.value()))
+				if (IsOutdated(inputFile, targetFile, std::max(targetFileLastWriteTime.value(), lastEvaluateTime)))
 				{
 					return true;
 				}
@@ -8,12 +8,14 @@
 #include "IEvaluateEngine.h"
 #include "BuildConstants.h"
 #include "BuildFailedException.h"
+#include "BuildStateLock.h"
 #include "PackageProvider.h"
 #include "RecipeBuildArguments.h"
 #include "RecipeBuildLocationManager.h"
 #include "FileSystemState.h"
 #include "local-user-config/LocalUserConfig.h"
 #include "operation-graph/OperationGraphManager.h"
+#include "operation-graph/OperationResultsJournal.h"
 #include "operation-graph/OperationResultsManager.h"
 #include "utilities/HandledException.h"
 #include "value-table/ValueTableManager.h"
@@ -21,6 +23,17 @@
 
 namespace Soup::Core
 {
+	/// <summary>
+	/// A single package in the parallel package build graph
+	/// </summary>
+	struct PackageBuildNode
+	{
+		const PackageGraph* Graph;
+		const PackageInfo* Info;
+		std::set<PackageId> Dependents;
+		uint32_t RemainingDependencyCount;
+	};
+
 	/// <summary>
 	/// The build runner that knows how to perform the correct build for a recipe
 	/// and all of its development and runtime dependencies
@@ -89,7 +102,14 @@ namespace Soup::Core
 				// Enable log event ids to track individual builds
 				auto& packageGraph = _packageProvider.GetRootPackageGraph();
 				auto& packageInfo = _packageProvider.GetPackageInfo(packageGraph.RootPackageId);
-				BuildPackageAndDependencies(packageGraph, packageInfo);
+				if (_arguments.MaxJobs > 1)
+				{
+					ParallelBuildPackageAndDependencies(packageGraph, packageInfo);
+				}
+				else
+				{
+					BuildPackageAndDependencies(packageGraph, packageInfo);
+				}
 
 				Log::EnsureListener().SetShowEventId(false);
 			}
@@ -158,6 +178,169 @@ namespace Soup::Core
 			}
 		}
 
+		/// <summary>
+		/// Build the package and its dependencies, running independent packages at the same time.
+		/// A package is only blocked on the build cache entries of its own dependencies.
+		/// </summary>
+		void ParallelBuildPackageAndDependencies(const PackageGraph& packageGraph, const PackageInfo& packageInfo)
+		{
+			auto packageNodes = std::map<PackageId, PackageBuildNode>();
+			LoadPackageBuildNodes(packageGraph, packageInfo, packageNodes);
+
+			auto readyPackages = std::queue<PackageId>();
+			for (auto& [packageId, packageNode] : packageNodes)
+			{
+				if (packageNode.RemainingDependencyCount == 0)
+					readyPackages.push(packageId);
+			}
+
+			// All shared runtime state is serialized through the build state lock,
+			// which a package only releases while it waits on external processes
+			auto buildStateMutex = std::mutex();
+			auto activePackages = std::map<PackageId, std::thread>();
+			auto completedMutex = std::mutex();
+			auto completedCondition = std::condition_variable();
+			auto completedPackages = std::queue<std::pair<PackageId, std::exception_ptr>>();
+
+			// On failure stop scheduling new packages and let the active builds finish
+			std::exception_ptr failure = nullptr;
+			while (true)
+			{
+				while (failure == nullptr && !readyPackages.empty() && activePackages.size() < _arguments.MaxJobs)
+				{
+					auto packageId = readyPackages.front();
+					readyPackages.pop();
+					auto& packageNode = packageNodes.at(packageId);
+
+					try
+					{
+						auto worker = std::thread(
+							[this, packageId, &packageNode, &buildStateMutex, &completedMutex, &completedCondition, &completedPackages]()
+							{
+								std::exception_ptr exception = nullptr;
+								try
+								{
+									auto hold = BuildStateLock::ScopedHold(buildStateMutex, packageId);
+									CheckBuildPackage(*packageNode.Graph, *packageNode.Info);
+								}
+								catch (...)
+								{
+									exception = std::current_exception();
+								}
+
+								{
+									auto lock = std::lock_guard<std::mutex>(completedMutex);
+									completedPackages.push(std::make_pair(packageId, exception));
+								}
+
+								completedCondition.notify_one();
+							});
+
+						activePackages.emplace(packageId, std::move(worker));
+					}
+					catch (...)
+					{
+						failure = std::current_exception();
+					}
+				}
+
+				if (activePackages.empty())
+					break;
+
+				// Wait for the next active package to finish
+				auto completed = std::pair<PackageId, std::exception_ptr>();
+				{
+					auto lock = std::unique_lock<std::mutex>(completedMutex);
+					completedCondition.wait(lock, [&completedPackages]() { return !completedPackages.empty(); });
+					completed = completedPackages.front();
+					completedPackages.pop();
+				}
+
+				auto findActive = activePackages.find(completed.first);
+				if (findActive == activePackages.end())
+					throw std::runtime_error("Completed package was not active");
+
+				findActive->second.join();
+				activePackages.erase(findActive);
+
+				if (completed.second != nullptr)
+				{
+					if (failure == nullptr)
+						failure = completed.second;
+				}
+				else
+				{
+					// Release the packages that were waiting on this build
+					for (auto dependentId : packageNodes.at(completed.first).Dependents)
+					{
+						auto& dependentNode = packageNodes.at(dependentId);
+						if (--dependentNode.RemainingDependencyCount == 0)
+							readyPackages.push(dependentId);
+					}
+				}
+			}
+
+			if (failure != nullptr)
+				std::rethrow_exception(failure);
+		}
+
+		/// <summary>
+		/// Load the graph of packages that must be built, using the same resolution as the serial build.
+		/// Prebuilt packages are resolved immediately.
+		/// </summary>
+		void LoadPackageBuildNodes(
+			const PackageGraph& packageGraph,
+			const PackageInfo& packageInfo,
+			std::map<PackageId, PackageBuildNode>& packageNodes)
+		{
+			if (packageNodes.contains(packageInfo.Id))
+				return;
+
+			if (packageInfo.IsPrebuilt)
+			{
+				BuildPackageAndDependencies(packageGraph, packageInfo);
+				return;
+			}
+
+			auto dependencyIds = std::set<PackageId>();
+			for (auto& [dependencyType, dependencyTypeSet] : packageInfo.Dependencies)
+			{
+				for (auto& dependency : dependencyTypeSet)
+				{
+					const PackageGraph* dependencyPackageGraph = &packageGraph;
+					auto dependencyPackageId = dependency.PackageId;
+					if (dependency.IsSubGraph)
+					{
+						dependencyPackageGraph = &_packageProvider.GetPackageGraph(dependency.PackageGraphId);
+						dependencyPackageId = dependencyPackageGraph->RootPackageId;
+					}
+
+					auto& dependencyPackageInfo = _packageProvider.GetPackageInfo(dependencyPackageId);
+					LoadPackageBuildNodes(*dependencyPackageGraph, dependencyPackageInfo, packageNodes);
+
+					// Prebuilt packages are already complete
+					if (packageNodes.contains(dependencyPackageInfo.Id))
+						dependencyIds.insert(dependencyPackageInfo.Id);
+				}
+			}
+
+			auto [insertIterator, wasInserted] = packageNodes.emplace(
+				packageInfo.Id,
+				PackageBuildNode({
+					&packageGraph,
+					&packageInfo,
+					{},
+					static_cast<uint32_t>(dependencyIds.size()),
+				}));
+			if (!wasInserted)
+				throw std::runtime_error("The package build node already exists");
+
+			for (auto dependencyId : dependencyIds)
+			{
+				packageNodes.at(dependencyId).Dependents.insert(packageInfo.Id);
+			}
+		}
+
 		/// <summary>
 		/// The core build that will either invoke the recipe builder directly
 		/// or load a previous state
@@ -236,6 +419,7 @@ namespace Soup::Core
 				evaluateGraph,
 				_fileSystemState);
 			
+			auto hasJournalResults = false;
 			if (hasExistingGraph)
 			{
 				Log::Info("Previous graph found");
@@ -254,6 +438,28 @@ namespace Soup::Core
 				{
 					Log::Info("No previous results found");
 				}
+
+				// Recover any results that completed after the results were last saved
+				auto evaluateResultsJournalFile = soupTargetDirectory + BuildConstants::EvaluateResultsJournalFileName();
+				auto isJournalCorrupted = false;
+				auto journalResultCount = OperationResultsJournal::Replay(
+					evaluateResultsJournalFile,
+					evaluateResults,
+					_fileSystemState,
+					isJournalCorrupted);
+				if (journalResultCount > 0)
+				{
+					Log::Info("Recovered {} results from journal", journalResultCount);
+					hasJournalResults = true;
+				}
+
+				// Save the results and reset a journal that could not be fully replayed, otherwise it is only reset once
+				// an operation completes and the same corrupted data is replayed again on every build
+				if (isJournalCorrupted)
+				{
+					Log::Warning("Resetting corrupted results journal");
+					hasJournalResults = true;
+				}
 			}
 			else
 			{
@@ -319,7 +525,8 @@ namespace Soup::Core
 					evaluateGraph,
 					evaluateResults,
 					realTargetDirectory,
-					soupTargetDirectory);
+					soupTargetDirectory,
+					hasJournalResults);
 			}
 
 			// Cache the build state for upstream dependencies
@@ -547,7 +754,8 @@ namespace Soup::Core
 			const OperationGraph& evaluateGraph,
 			OperationResults& evaluateResults,
 			const Path& realTargetDirectory,
-			const Path& soupTargetDirectory)
+			const Path& soupTargetDirectory,
+			bool hasJournalResults)
 		{
 			// Set the temporary folder under the target folder
 			auto temporaryDirectory = realTargetDirectory + BuildConstants::TemporaryFolderName();
@@ -573,6 +781,31 @@ namespace Soup::Core
 				System::IFileSystem::Current().CreateDirectory(temporaryDirectory);
 			}
 
+			auto evaluateResultsFile = soupTargetDirectory + BuildConstants::EvaluateResultsFileName();
+			auto evaluateResultsJournal = OperationResultsJournal(
+				soupTargetDirectory + BuildConstants::EvaluateResultsJournalFileName(),
+				_fileSystemState,
+				hasJournalResults);
+
+			// Journal each result as soon as the operation completes so an interrupted build keeps the finished work.
+			// Recovered journal results are compacted into the results file before the journal is restarted.
+			auto hasUnsavedResults = hasJournalResults;
+			auto resultUpdatedCallback = OperationResults::ScopedResultUpdatedCallback(
+				evaluateResults,
+				[&](OperationId operationId, const OperationResult& result)
+				{
+					if (hasUnsavedResults)
+					{
+						OperationResultsManager::SaveState(evaluateResultsFile, evaluateResults, _fileSystemState);
+						evaluateResultsJournal.Clear();
+						hasUnsavedResults = false;
+					}
+					else
+					{
+						evaluateResultsJournal.Append(operationId, result);
+					}
+				});
+
 			try
 			{
 				// Evaluate the build
@@ -583,18 +816,25 @@ namespace Soup::Core
 					allowedReadAccess,
 					allowedWriteAccess);
 
-				if (ranEvaluate)
+				resultUpdatedCallback.Reset();
+				if (ranEvaluate || hasUnsavedResults)
 				{
 					Log::Info("Saving updated build state");
-					auto evaluateResultsFile = soupTargetDirectory + BuildConstants::EvaluateResultsFileName();
 					OperationResultsManager::SaveState(evaluateResultsFile, evaluateResults, _fileSystemState);
+					evaluateResultsJournal.Clear();
 				}
 			}
 			catch(const BuildFailedException&)
 			{
-				Log::Info("Saving partial build state");
-				auto evaluateResultsFile = soupTargetDirectory + BuildConstants::EvaluateResultsFileName();
-				OperationResultsManager::SaveState(evaluateResultsFile, evaluateResults, _fileSystemState);
+				// The journal already holds every result that completed since the last save
+				resultUpdatedCallback.Reset();
+				if (hasUnsavedResults)
+				{
+					Log::Info("Saving partial build state");
+					OperationResultsManager::SaveState(evaluateResultsFile, evaluateResults, _fileSystemState);
+					evaluateResultsJournal.Clear();
+				}
+
 				throw;
 			}
 
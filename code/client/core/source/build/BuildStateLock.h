@@ -0,0 +1,173 @@
+﻿// <copyright file="BuildStateLock.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The lock that serializes access to the shared build runtime state (file system state, recipe cache,
+	/// build cache and logging) when multiple packages are built in parallel.
+	/// A package build thread holds the lock for its entire build and only releases it while it is blocked
+	/// waiting on external processes, so the shared state is only ever touched by one thread at a time.
+	/// Work that runs on other threads on behalf of a package (operation workers, monitor callbacks and
+	/// streamed output) captures the package's <see cref="Owner"/> and borrows the lock to log.
+	/// </summary>
+	class BuildStateLock
+	{
+	public:
+		class ScopedHold;
+
+	private:
+		// The lock held by the active thread, if any
+		static thread_local ScopedHold* _current;
+
+		// Serializes the logging of callbacks when no package lock exists
+		static std::mutex _logMutex;
+
+	public:
+		/// <summary>
+		/// Acquire the shared lock for the active thread for the lifetime of this object
+		/// </summary>
+		class ScopedHold
+		{
+		private:
+			std::unique_lock<std::mutex> _lock;
+			uint32_t _activeId;
+			ScopedHold* _previous;
+
+		public:
+			ScopedHold(std::mutex& mutex, uint32_t activeId) :
+				_lock(mutex),
+				_activeId(activeId),
+				_previous(_current)
+			{
+				_current = this;
+			}
+
+			ScopedHold(const ScopedHold&) = delete;
+			ScopedHold& operator=(const ScopedHold&) = delete;
+
+			~ScopedHold()
+			{
+				_current = _previous;
+			}
+
+			void Release()
+			{
+				_lock.unlock();
+			}
+
+			std::mutex* GetMutex() const
+			{
+				return _lock.mutex();
+			}
+
+			uint32_t GetActiveId() const
+			{
+				return _activeId;
+			}
+
+			bool IsHolding(const std::mutex* mutex) const
+			{
+				return _lock.owns_lock() && _lock.mutex() == mutex;
+			}
+
+			void Acquire()
+			{
+				_lock.lock();
+
+				// Another package may have changed the active log id while the lock was released
+				Log::SetActiveId(_activeId);
+			}
+		};
+
+		/// <summary>
+		/// Release the lock held by the active thread, if any, for the lifetime of this object
+		/// </summary>
+		class ScopedRelease
+		{
+		private:
+			ScopedHold* _hold;
+
+		public:
+			ScopedRelease() :
+				_hold(_current)
+			{
+				if (_hold != nullptr)
+					_hold->Release();
+			}
+
+			ScopedRelease(const ScopedRelease&) = delete;
+			ScopedRelease& operator=(const ScopedRelease&) = delete;
+
+			~ScopedRelease()
+			{
+				if (_hold != nullptr)
+					_hold->Acquire();
+			}
+		};
+
+		/// <summary>
+		/// The lock of the active thread captured so that it can be borrowed from other threads
+		/// </summary>
+		class Owner
+		{
+		private:
+			std::mutex* _mutex;
+			uint32_t _activeId;
+
+		public:
+			Owner() :
+				_mutex(_current != nullptr ? _current->GetMutex() : &_logMutex),
+				_activeId(_current != nullptr ? _current->GetActiveId() : 0)
+			{
+			}
+
+			std::mutex* GetMutex() const
+			{
+				return _mutex;
+			}
+
+			uint32_t GetActiveId() const
+			{
+				return _activeId;
+			}
+
+			bool IsPackageLock() const
+			{
+				return _mutex != &_logMutex;
+			}
+		};
+
+		/// <summary>
+		/// Hold the lock of an owner for the lifetime of this object, unless the active thread already holds it
+		/// </summary>
+		class ScopedBorrow
+		{
+		private:
+			std::unique_lock<std::mutex> _lock;
+
+		public:
+			ScopedBorrow(const Owner& owner) :
+				_lock()
+			{
+				if (_current != nullptr && _current->IsHolding(owner.GetMutex()))
+					return;
+
+				_lock = std::unique_lock<std::mutex>(*owner.GetMutex());
+				if (owner.IsPackageLock())
+					Log::SetActiveId(owner.GetActiveId());
+			}
+
+			ScopedBorrow(const ScopedBorrow&) = delete;
+			ScopedBorrow& operator=(const ScopedBorrow&) = delete;
+		};
+	};
+
+#ifdef CLIENT_CORE_IMPLEMENTATION
+	thread_local BuildStateLock::ScopedHold* BuildStateLock::_current = nullptr;
+	std::mutex BuildStateLock::_logMutex;
+#endif
+}
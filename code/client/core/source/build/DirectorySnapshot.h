@@ -0,0 +1,56 @@
+﻿// <copyright file="DirectorySnapshot.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The listing for a single directory captured during a previous build
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct DirectorySnapshot
+	{
+	public:
+		// The snapshot file stores the last write time with a resolution of 100 nanoseconds
+		using TimePrecision = std::chrono::duration<long long, std::ratio<1, 10'000'000>>;
+
+		/// <summary>
+		/// Truncate a live write time to the precision that is stored in the snapshot
+		/// </summary>
+		static std::chrono::time_point<std::chrono::file_clock> ToSnapshotTime(
+			std::chrono::time_point<std::chrono::file_clock> lastWriteTime)
+		{
+			return std::chrono::floor<TimePrecision>(lastWriteTime);
+		}
+
+		DirectorySnapshot() :
+			LastWriteTime(std::chrono::time_point<std::chrono::file_clock>::min()),
+			Entries()
+		{
+		}
+
+		DirectorySnapshot(
+			std::chrono::time_point<std::chrono::file_clock> lastWriteTime,
+			std::vector<std::string> entries) :
+			LastWriteTime(ToSnapshotTime(lastWriteTime)),
+			Entries(std::move(entries))
+		{
+		}
+
+		bool operator ==(const DirectorySnapshot& rhs) const
+		{
+			return LastWriteTime == rhs.LastWriteTime &&
+				Entries == rhs.Entries;
+		}
+
+		// The last write time of the directory itself when the listing was captured
+		std::chrono::time_point<std::chrono::file_clock> LastWriteTime;
+
+		// The child files and directories
+		std::vector<std::string> Entries;
+	};
+}
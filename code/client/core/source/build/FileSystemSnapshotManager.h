@@ -0,0 +1,67 @@
+﻿// <copyright file="FileSystemSnapshotManager.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "FileSystemSnapshotReader.h"
+#include "FileSystemSnapshotWriter.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system snapshot manager
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class FileSystemSnapshotManager
+	{
+	public:
+		/// <summary>
+		/// Load the directory listings from the provided file
+		/// </summary>
+		static bool TryLoadState(
+			const Path& fileSystemSnapshotFile,
+			std::map<std::string, DirectorySnapshot>& result)
+		{
+			// Open the file to read from
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(fileSystemSnapshotFile, true, file))
+			{
+				Log::Info("File system snapshot file does not exist");
+				return false;
+			}
+
+			// Read the contents of the snapshot file
+			try
+			{
+				result = FileSystemSnapshotReader::Deserialize(file->GetInStream());
+				return true;
+			}
+			catch(std::runtime_error& ex)
+			{
+				Log::Error(ex.what());
+				return false;
+			}
+			catch(...)
+			{
+				Log::Error("Failed to parse file system snapshot");
+				return false;
+			}
+		}
+
+		/// <summary>
+		/// Save the directory listings to the provided file
+		/// </summary>
+		static void SaveState(
+			const Path& fileSystemSnapshotFile,
+			const std::map<std::string, DirectorySnapshot>& directories)
+		{
+			// Open the file to write to
+			auto file = System::IFileSystem::Current().OpenWrite(fileSystemSnapshotFile, true);
+
+			// Write the snapshot to the file stream
+			FileSystemSnapshotWriter::Serialize(directories, file->GetOutStream());
+		}
+	};
+}
@@ -0,0 +1,152 @@
+﻿// <copyright file="FileSystemSnapshotReader.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "DirectorySnapshot.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system snapshot reader
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class FileSystemSnapshotReader
+	{
+	private:
+		// Binary File System Snapshot file format
+		static constexpr uint32_t FileVersion = 1;
+
+		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
+		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
+		using ContentTimePeriod = std::ratio<1, 10'000'000>;
+		using ContentDuration = std::chrono::duration<long long, ContentTimePeriod>;
+
+	public:
+		static std::map<std::string, DirectorySnapshot> Deserialize(std::istream& stream)
+		{
+			// Read the entire file for fastest read operation
+			stream.seekg(0, std::ios_base::end);
+			auto size = stream.tellg();
+			stream.seekg(0, std::ios_base::beg);
+
+			auto contentBuffer = std::vector<char>(size);
+			stream.read(contentBuffer.data(), size);
+			auto data = contentBuffer.data();
+			size_t offset = 0;
+
+			auto result = Deserialize(data, size, offset);
+
+			if (offset != contentBuffer.size())
+			{
+				throw std::runtime_error("File system snapshot file corrupted - Did not read the entire file");
+			}
+
+			return result;
+		}
+
+	private:
+		static std::map<std::string, DirectorySnapshot> Deserialize(
+			char* data,
+			size_t size,
+			size_t& offset)
+		{
+			// Read the File Header with version
+			auto headerBuffer = std::array<char, 4>();
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'B' ||
+				headerBuffer[1] != 'F' ||
+				headerBuffer[2] != 'S' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system snapshot file header");
+			}
+
+			auto fileVersion = ReadUInt32(data, size, offset);
+			if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("File system snapshot file version does not match expected");
+			}
+
+			// Read the set of directories
+			Read(data, size, offset, headerBuffer.data(), 4);
+			if (headerBuffer[0] != 'D' ||
+				headerBuffer[1] != 'I' ||
+				headerBuffer[2] != 'R' ||
+				headerBuffer[3] != '\0')
+			{
+				throw std::runtime_error("Invalid file system snapshot directories header");
+			}
+
+			auto result = std::map<std::string, DirectorySnapshot>();
+			auto directoryCount = ReadUInt32(data, size, offset);
+			for (auto i = 0u; i < directoryCount; i++)
+			{
+				auto directory = ReadString(data, size, offset);
+
+				// Read the tick offset of the system clock since its epoch
+				auto lastWriteTimeTicks = ReadInt64(data, size, offset);
+				auto lastWriteTimeDuration = ContentDuration(lastWriteTimeTicks);
+
+				// Use system clock with a known epoch
+				auto lastWriteTimeSystem = std::chrono::time_point<std::chrono::system_clock>(lastWriteTimeDuration);
+				#ifdef _WIN32
+				auto lastWriteTimeFile = std::chrono::clock_cast<std::chrono::file_clock>(lastWriteTimeSystem);
+				#else
+				auto lastWriteTimeFile = std::chrono::file_clock::from_sys(lastWriteTimeSystem);
+				#endif
+
+				// Read the child entries
+				auto entryCount = ReadUInt32(data, size, offset);
+				auto entries = std::vector<std::string>(entryCount);
+				for (auto j = 0u; j < entryCount; j++)
+				{
+					entries[j] = ReadString(data, size, offset);
+				}
+
+				auto insertResult = result.emplace(
+					std::move(directory),
+					DirectorySnapshot(lastWriteTimeFile, std::move(entries)));
+				if (!insertResult.second)
+					throw std::runtime_error("The directory was not unique in the file system snapshot");
+			}
+
+			return result;
+		}
+
+		static uint32_t ReadUInt32(char* data, size_t size, size_t& offset)
+		{
+			uint32_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(uint32_t));
+
+			return result;
+		}
+
+		static int64_t ReadInt64(char* data, size_t size, size_t& offset)
+		{
+			int64_t result = 0;
+			Read(data, size, offset, reinterpret_cast<char*>(&result), sizeof(int64_t));
+
+			return result;
+		}
+
+		static std::string ReadString(char* data, size_t size, size_t& offset)
+		{
+			auto stringLength = ReadUInt32(data, size, offset);
+			auto result = std::string(stringLength, '\0');
+			Read(data, size, offset, result.data(), stringLength);
+
+			return result;
+		}
+
+		static void Read(char* data, size_t size, size_t& offset, char* buffer, size_t count)
+		{
+			if (offset + count > size)
+				throw std::runtime_error("Tried to read past end of data");
+			memcpy(buffer, data + offset, count);
+			offset += count;
+		}
+	};
+}
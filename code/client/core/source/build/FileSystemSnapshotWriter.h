@@ -0,0 +1,87 @@
+﻿// <copyright file="FileSystemSnapshotWriter.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "DirectorySnapshot.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The file system snapshot writer
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class FileSystemSnapshotWriter
+	{
+	private:
+		// Binary File System Snapshot file format
+		static constexpr uint32_t FileVersion = 1;
+
+		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
+		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
+		using ContentTimePeriod = std::ratio<1, 10'000'000>;
+		using ContentDuration = std::chrono::duration<long long, ContentTimePeriod>;
+
+	public:
+		static void Serialize(
+			const std::map<std::string, DirectorySnapshot>& directories,
+			std::ostream& stream)
+		{
+			// Write the File Header with version
+			stream.write("BFS\0", 4);
+			WriteValue(stream, FileVersion);
+
+			// Write out the set of directories
+			stream.write("DIR\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(directories.size()));
+			for (const auto& [key, value] : directories)
+			{
+				WriteDirectory(stream, key, value);
+			}
+		}
+
+	private:
+		static void WriteDirectory(std::ostream& stream, std::string_view directory, const DirectorySnapshot& snapshot)
+		{
+			// Write out the directory path
+			WriteValue(stream, directory);
+
+			// Use system clock with a known epoch
+			#ifdef _WIN32
+			auto lastWriteTimeSystem = std::chrono::clock_cast<std::chrono::system_clock>(snapshot.LastWriteTime);
+			#else
+			auto lastWriteTimeSystem = std::chrono::file_clock::to_sys(snapshot.LastWriteTime);
+			#endif
+
+			// Write the tick offset of the system clock since its epoch
+			auto lastWriteTimeDuration = std::chrono::duration_cast<ContentDuration>(lastWriteTimeSystem.time_since_epoch());
+			int64_t lastWriteTimeCount = lastWriteTimeDuration.count();
+			WriteValue(stream, lastWriteTimeCount);
+
+			// Write out the child entries
+			WriteValue(stream, static_cast<uint32_t>(snapshot.Entries.size()));
+			for (auto& entry : snapshot.Entries)
+			{
+				WriteValue(stream, entry);
+			}
+		}
+
+		static void WriteValue(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, int64_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(int64_t));
+		}
+
+		static void WriteValue(std::ostream& stream, std::string_view value)
+		{
+			WriteValue(stream, static_cast<uint32_t>(value.size()));
+			stream.write(value.data(), value.size());
+		}
+	};
+}
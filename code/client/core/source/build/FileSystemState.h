@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "DirectorySnapshot.h"
 
 #ifdef SOUP_BUILD
 export
@@ -32,6 +33,16 @@ namespace Soup::Core
 	/// </summary>
 	class FileSystemState
 	{
+	private:
+		// The state tracked for each known file id
+		struct FileEntry
+		{
+			Path File;
+			bool IsKnown = false;
+			bool HasLastWriteTime = false;
+			std::optional<std::chrono::time_point<std::chrono::file_clock>> LastWriteTime;
+		};
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="FileSystemState"/> class.
@@ -41,7 +52,11 @@ namespace Soup::Core
 			_files(),
 			_fileLookup(),
 			_directoryLookup(),
-			_writeCache()
+			_contentDigestCache(),
+			_useDirectorySnapshots(false),
+			_previousDirectorySnapshots(),
+			_directorySnapshots(),
+			_preloadedDirectories()
 		{
 		}
 
@@ -64,26 +79,68 @@ namespace Soup::Core
 			std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>> directoryLookup,
 			std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>> writeCache) :
 			_maxFileId(maxFileId),
-			_files(std::move(files)),
+			_files(),
 			_fileLookup(),
 			_directoryLookup(std::move(directoryLookup)),
-			_writeCache(std::move(writeCache))
+			_contentDigestCache(),
+			_useDirectorySnapshots(false),
+			_previousDirectorySnapshots(),
+			_directorySnapshots(),
+			_preloadedDirectories()
 		{
-			// Build up the reverse lookup for new files
-			for (const auto& [key, value] : _files)
+			for (auto& [key, value] : files)
+			{
+				auto& entry = EnsureFileEntry(key);
+				entry.File = std::move(value);
+				entry.IsKnown = true;
+			}
+
+			for (const auto& [key, value] : writeCache)
 			{
-				auto insertResult = _fileLookup.emplace(value.ToString(), key);
-				if (!insertResult.second)
-					throw std::runtime_error("The file was not unique in the provided set.");
+				SetLastWriteTime(key, value);
 			}
+
+			// Build up the reverse lookup for new files
+			BuildFileLookup();
+		}
+
+		/// <summary>
+		/// The file lookup references the path strings owned by the file entries
+		/// so the state is moved by rebuilding the lookup and is never copied
+		/// </summary>
+		FileSystemState(const FileSystemState&) = delete;
+		FileSystemState& operator=(const FileSystemState&) = delete;
+
+		FileSystemState(FileSystemState&& other) :
+			_maxFileId(other._maxFileId),
+			_files(std::move(other._files)),
+			_fileLookup(),
+			_directoryLookup(std::move(other._directoryLookup)),
+			_contentDigestCache(std::move(other._contentDigestCache)),
+			_useDirectorySnapshots(other._useDirectorySnapshots),
+			_previousDirectorySnapshots(std::move(other._previousDirectorySnapshots)),
+			_directorySnapshots(std::move(other._directorySnapshots)),
+			_preloadedDirectories(std::move(other._preloadedDirectories))
+		{
+			other._files.clear();
+			other._fileLookup.clear();
+			BuildFileLookup();
 		}
 
 		/// <summary>
 		/// Get Files
 		/// </summary>
-		const std::unordered_map<FileId, Path>& GetFiles() const
+		std::unordered_map<FileId, Path> GetFiles() const
 		{
-			return _files;
+			auto result = std::unordered_map<FileId, Path>();
+			for (FileId fileId = 0; fileId < _files.size(); fileId++)
+			{
+				auto& entry = _files[fileId];
+				if (entry.IsKnown)
+					result.emplace(fileId, entry.File);
+			}
+
+			return result;
 		}
 
 		/// <summary>
@@ -110,10 +167,9 @@ namespace Soup::Core
 		/// </summary>
 		std::optional<std::chrono::time_point<std::chrono::file_clock>> GetLastWriteTime(FileId file)
 		{
-			auto findResult = _writeCache.find(file);
-			if (findResult != _writeCache.end())
+			if (file < _files.size() && _files[file].HasLastWriteTime)
 			{
-				return findResult->second;
+				return _files[file].LastWriteTime;
 			}
 			else
 			{
@@ -121,6 +177,22 @@ namespace Soup::Core
 			}
 		}
 
+		/// <summary>
+		/// Find the content digest for a given file id
+		/// </summary>
+		std::optional<std::string> GetContentDigest(FileId file)
+		{
+			auto findResult = _contentDigestCache.find(file);
+			if (findResult != _contentDigestCache.end())
+			{
+				return findResult->second;
+			}
+			else
+			{
+				return CheckFileContentDigest(file);
+			}
+		}
+
 		/// <summary>
 		/// Convert a set of file paths to file ids
 		/// </summary>
@@ -155,11 +227,14 @@ namespace Soup::Core
 			{
 				// Insert the new file
 				result = ++_maxFileId;
-				auto insertResult = _files.emplace(result, file);
-				if (!insertResult.second)
+				auto& entry = EnsureFileEntry(result);
+				if (entry.IsKnown)
 					throw std::runtime_error("The provided file id already exists in the file system state");
 
-				auto insertLookupResult = _fileLookup.emplace(file.ToString(), result);
+				entry.File = file;
+				entry.IsKnown = true;
+
+				auto insertLookupResult = _fileLookup.emplace(entry.File.ToString(), result);
 				if (!insertLookupResult.second)
 					throw std::runtime_error("The file was not unique even though we just failed to find it");
 			}
@@ -172,7 +247,15 @@ namespace Soup::Core
 		/// </summary>
 		bool TryFindFileId(const Path& file, FileId& fileId) const
 		{
-			auto findResult = _fileLookup.find(file.ToString());
+			return TryFindFileId(std::string_view(file.ToString()), fileId);
+		}
+
+		/// <summary>
+		/// Find an file id from the absolute path string without allocating a new path
+		/// </summary>
+		bool TryFindFileId(std::string_view file, FileId& fileId) const
+		{
+			auto findResult = _fileLookup.find(file);
 			if (findResult != _fileLookup.end())
 			{
 				fileId = findResult->second;
@@ -203,10 +286,9 @@ namespace Soup::Core
 		/// </summary>
 		const Path& GetFilePath(FileId fileId) const
 		{
-			auto findResult = _files.find(fileId);
-			if (findResult != _files.end())
+			if (fileId < _files.size() && _files[fileId].IsKnown)
 			{
-				return findResult->second;
+				return _files[fileId].File;
 			}
 			else
 			{
@@ -214,54 +296,120 @@ namespace Soup::Core
 			}
 		}
 
-		void PreloadDirectory(const Path& directory, bool trackDirectories)
+		/// <summary>
+		/// Enable capturing directory listings and reuse the listings from a previous build
+		/// for any directory that has not been modified since
+		/// </summary>
+		void EnableDirectorySnapshots(std::map<std::string, DirectorySnapshot> previousDirectorySnapshots)
 		{
-			#ifdef TRACE_FILE_SYSTEM_STATE
-			std::cout << "PreloadDirectory: " << directory.ToString() << std::endl;
-			#endif
+			_useDirectorySnapshots = true;
+			_previousDirectorySnapshots = std::move(previousDirectorySnapshots);
+		}
+
+		/// <summary>
+		/// Get the directory listings captured during this build
+		/// </summary>
+		const std::map<std::string, DirectorySnapshot>& GetDirectorySnapshots() const
+		{
+			return _directorySnapshots;
+		}
+
+		/// <summary>
+		/// Get the set of directories that have been preloaded
+		/// </summary>
+		const std::vector<Path>& GetPreloadedDirectories() const
+		{
+			return _preloadedDirectories;
+		}
+
+		/// <summary>
+		/// Check if a file that the build already observed no longer matches its recorded write time.
+		/// Files that were never observed or were invalidated after being written are not reported.
+		/// </summary>
+		bool HasObservedFileChanged(const Path& file)
+		{
+			FileId fileId;
+			if (!file.HasFileName() ||
+				!TryFindFileId(file, fileId) ||
+				fileId >= _files.size() ||
+				!_files[fileId].HasLastWriteTime)
+			{
+				return false;
+			}
+
+			std::optional<std::chrono::time_point<std::chrono::file_clock>> currentWriteTime = std::nullopt;
+			std::chrono::time_point<std::chrono::file_clock> lastWriteTimeValue;
+			if (System::IFileSystem::Current().TryGetLastWriteTime(file, lastWriteTimeValue))
+			{
+				currentWriteTime = lastWriteTimeValue;
+			}
+
+			return currentWriteTime != _files[fileId].LastWriteTime;
+		}
+
+		/// <summary>
+		/// Apply an external change to a single file or directory
+		/// </summary>
+		void NotifyFileChanged(const Path& file)
+		{
+			auto parentDirectory = TryGetDirectoryState(file.GetParent());
+
+			// Load any new directory so its children are known as well
+			FileId fileId;
+			if (!file.HasFileName() && !TryFindFileId(file, fileId))
+			{
+				PreloadDirectory(file, parentDirectory != nullptr);
+
+				// Check the directory itself since preloading only records the write times for the children
+				fileId = ToFileId(file);
+				InvalidateFileWriteTime(fileId);
+				if (parentDirectory != nullptr && GetLastWriteTime(fileId).has_value())
+				{
+					UpdateDirectoryLookup(file);
+				}
+
+				return;
+			}
+
+			fileId = ToFileId(file);
+			InvalidateFileWriteTime(fileId);
+
+			// Keep the tracked directory structure in sync with created and deleted files
+			if (parentDirectory != nullptr)
+			{
+				auto exists = GetLastWriteTime(fileId).has_value();
+				if (file.HasFileName())
+				{
+					if (exists)
+						parentDirectory->Files.insert(std::string(file.GetFileName()));
+					else
+						parentDirectory->Files.erase(std::string(file.GetFileName()));
+				}
+				else
+				{
+					if (exists)
+						UpdateDirectoryLookup(file);
+					else
+						parentDirectory->ChildDirectories.erase(std::string(file.DecomposeDirectories().back()));
+				}
+			}
+		}
 
+		void PreloadDirectory(const Path& directory, bool trackDirectories)
+		{
 			FileId directoryId;
 			if (!TryFindFileId(directory, directoryId))
 			{
-				directoryId = ToFileId(directory);
-				
-				// Add the requested file as null
-				// This will be replaced if the file exists with the find all callback
-				auto insertResult = _writeCache.insert_or_assign(directoryId, std::nullopt);
-
-				std::function<void(const Path& file, std::chrono::time_point<std::chrono::file_clock>)> callback =
-					[&](const Path& file, std::chrono::time_point<std::chrono::file_clock> lastWriteTime)
-					{
-						auto& absolutePath = file.HasRoot() ? file : directory + file;
-
-						#ifdef TRACE_FILE_SYSTEM_STATE
-						std::cout << "PreloadDirectory: File " << file.ToString() << std::endl;
-						#endif
-
-						// Recursively load child directories
-						if (!file.IsEmpty() && !absolutePath.HasFileName())
-						{
-							PreloadDirectory(absolutePath, trackDirectories);
-						}
-
-						if (trackDirectories)
-						{
-							UpdateDirectoryLookup(absolutePath);
-						}
-
-						FileId fileId = ToFileId(absolutePath);
-						auto insertResult = _writeCache.insert_or_assign(fileId, lastWriteTime);
-					};
-
-				// Load the write times for all files in the directory
-				// This optimization assumes that most files in a directory are relevant to the build
-				// and on windows it is a lot faster to iterate over the files instead of making individual calls
-				if (!System::IFileSystem::Current().TryGetDirectoryFilesLastWriteTime(
-					directory,
-					callback))
+				// Check the directory itself to allow reusing the previous listing
+				std::optional<std::chrono::time_point<std::chrono::file_clock>> directoryLastWriteTime = std::nullopt;
+				std::chrono::time_point<std::chrono::file_clock> directoryLastWriteTimeValue;
+				if (_useDirectorySnapshots &&
+					System::IFileSystem::Current().TryGetLastWriteTime(directory, directoryLastWriteTimeValue))
 				{
-					Log::Info("Preload Directory Missing: {}", directory.ToString());
+					directoryLastWriteTime = directoryLastWriteTimeValue;
 				}
+
+				PreloadDirectory(directory, directoryLastWriteTime, trackDirectories);
 			}
 		}
 
@@ -278,6 +426,138 @@ namespace Soup::Core
 		}
 
 	private:
+		void PreloadDirectory(
+			const Path& directory,
+			std::optional<std::chrono::time_point<std::chrono::file_clock>> directoryLastWriteTime,
+			bool trackDirectories)
+		{
+			#ifdef TRACE_FILE_SYSTEM_STATE
+			std::cout << "PreloadDirectory: " << directory.ToString() << std::endl;
+			#endif
+
+			auto directoryId = ToFileId(directory);
+			_preloadedDirectories.push_back(directory);
+
+			// Add the requested file with the known write time or null
+			// This will be replaced if the file exists with the find all callback
+			SetLastWriteTime(directoryId, directoryLastWriteTime);
+
+			// Reuse the previous listing if the directory has not changed
+			// Note: The individual file write times are left to be checked on demand
+			if (directoryLastWriteTime.has_value() &&
+				TryRestoreDirectory(directory, directoryLastWriteTime.value(), trackDirectories))
+			{
+				return;
+			}
+
+			auto entries = std::vector<std::string>();
+			std::function<void(const Path& file, std::chrono::time_point<std::chrono::file_clock>)> callback =
+				[&](const Path& file, std::chrono::time_point<std::chrono::file_clock> lastWriteTime)
+				{
+					auto& absolutePath = file.HasRoot() ? file : directory + file;
+
+					#ifdef TRACE_FILE_SYSTEM_STATE
+					std::cout << "PreloadDirectory: File " << file.ToString() << std::endl;
+					#endif
+
+					// Recursively load child directories
+					FileId childDirectoryId;
+					if (!file.IsEmpty() && !absolutePath.HasFileName() && !TryFindFileId(absolutePath, childDirectoryId))
+					{
+						PreloadDirectory(absolutePath, lastWriteTime, trackDirectories);
+					}
+
+					if (trackDirectories)
+					{
+						UpdateDirectoryLookup(absolutePath);
+					}
+
+					FileId fileId = ToFileId(absolutePath);
+					SetLastWriteTime(fileId, lastWriteTime);
+
+					if (_useDirectorySnapshots)
+					{
+						entries.push_back(file.ToString());
+					}
+				};
+
+			// Load the write times for all files in the directory
+			// This optimization assumes that most files in a directory are relevant to the build
+			// and on windows it is a lot faster to iterate over the files instead of making individual calls
+			if (!System::IFileSystem::Current().TryGetDirectoryFilesLastWriteTime(
+				directory,
+				callback))
+			{
+				Log::Info("Preload Directory Missing: {}", directory.ToString());
+			}
+			else if (_useDirectorySnapshots && directoryLastWriteTime.has_value())
+			{
+				_directorySnapshots.insert_or_assign(
+					directory.ToString(),
+					DirectorySnapshot(directoryLastWriteTime.value(), std::move(entries)));
+			}
+		}
+
+		bool TryRestoreDirectory(
+			const Path& directory,
+			std::chrono::time_point<std::chrono::file_clock> directoryLastWriteTime,
+			bool trackDirectories)
+		{
+			auto findResult = _previousDirectorySnapshots.find(directory.ToString());
+			if (findResult == _previousDirectorySnapshots.end() ||
+				findResult->second.LastWriteTime != DirectorySnapshot::ToSnapshotTime(directoryLastWriteTime))
+			{
+				return false;
+			}
+
+			#ifdef TRACE_FILE_SYSTEM_STATE
+			std::cout << "PreloadDirectory: Restore " << directory.ToString() << std::endl;
+			#endif
+
+			auto& snapshot = findResult->second;
+			for (auto& entry : snapshot.Entries)
+			{
+				auto file = Path(entry);
+				auto absolutePath = file.HasRoot() ? file : directory + file;
+
+				// Recursively check child directories, each of which may have changed on its own
+				if (!file.IsEmpty() && !absolutePath.HasFileName())
+				{
+					PreloadDirectory(absolutePath, trackDirectories);
+				}
+
+				if (trackDirectories)
+				{
+					UpdateDirectoryLookup(absolutePath);
+				}
+
+				ToFileId(absolutePath);
+			}
+
+			_directorySnapshots.insert_or_assign(findResult->first, snapshot);
+			return true;
+		}
+
+		DirectoryState* TryGetDirectoryState(const Path& directory)
+		{
+			auto findResult = _directoryLookup.find(directory.GetRoot());
+			if (findResult == _directoryLookup.end())
+				return nullptr;
+
+			auto activeDirectory = &findResult->second;
+			const auto directories = directory.DecomposeDirectories();
+			for (auto currentDirectory : directories)
+			{
+				auto findChildResult = activeDirectory->ChildDirectories.find(currentDirectory);
+				if (findChildResult == activeDirectory->ChildDirectories.end())
+					return nullptr;
+
+				activeDirectory = &findChildResult->second;
+			}
+
+			return activeDirectory;
+		}
+
 		DirectoryState* GetDirectoryState(
 			std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>>& activeDirectory,
 			const std::string_view name)
@@ -331,7 +611,13 @@ namespace Soup::Core
 		/// </summary>
 		void InvalidateFileWriteTime(FileId fileId)
 		{
-			_writeCache.erase(fileId);
+			if (fileId < _files.size())
+			{
+				_files[fileId].HasLastWriteTime = false;
+				_files[fileId].LastWriteTime = std::nullopt;
+			}
+
+			_contentDigestCache.erase(fileId);
 		}
 
 		std::string format(std::chrono::time_point<std::chrono::file_clock> time)
@@ -372,20 +658,81 @@ namespace Soup::Core
 				std::cout << "CheckFileWriteTime: " << filePath.ToString() << " NONE" << std::endl;
 #endif
 
-			auto insertResult = _writeCache.insert_or_assign(fileId, lastWriteTime);
+			SetLastWriteTime(fileId, lastWriteTime);
 			return lastWriteTime;
 		}
 
+		/// <summary>
+		/// Hash the current content for the provided file
+		/// </summary>
+		std::optional<std::string> CheckFileContentDigest(FileId fileId)
+		{
+			auto& filePath = GetFilePath(fileId);
+
+			std::optional<std::string> contentDigest = std::nullopt;
+			std::shared_ptr<System::IInputFile> file;
+			if (System::IFileSystem::Current().TryOpenRead(filePath, true, file))
+			{
+				auto content = std::string(
+					std::istreambuf_iterator<char>(file->GetInStream()),
+					std::istreambuf_iterator<char>());
+				contentDigest = CryptoPP::Sha1::HashBase64(content);
+			}
+
+			auto insertResult = _contentDigestCache.insert_or_assign(fileId, contentDigest);
+			return contentDigest;
+		}
+
+		FileEntry& EnsureFileEntry(FileId fileId)
+		{
+			if (fileId >= _files.size())
+				_files.resize(static_cast<size_t>(fileId) + 1);
+
+			return _files[fileId];
+		}
+
+		void SetLastWriteTime(FileId fileId, std::optional<std::chrono::time_point<std::chrono::file_clock>> lastWriteTime)
+		{
+			auto& entry = EnsureFileEntry(fileId);
+			entry.HasLastWriteTime = true;
+			entry.LastWriteTime = lastWriteTime;
+		}
+
+		void BuildFileLookup()
+		{
+			_fileLookup.reserve(_files.size());
+			for (FileId fileId = 0; fileId < _files.size(); fileId++)
+			{
+				auto& entry = _files[fileId];
+				if (entry.IsKnown)
+				{
+					auto insertResult = _fileLookup.emplace(entry.File.ToString(), fileId);
+					if (!insertResult.second)
+						throw std::runtime_error("The file was not unique in the provided set.");
+				}
+			}
+		}
+
 	private:
 		// The maximum id that has been used for files
 		// Used to ensure unique ids are generated across the entire system
 		FileId _maxFileId;
 
-		std::unordered_map<FileId, Path> _files;
-		std::unordered_map<std::string, FileId> _fileLookup;
+		// The known files and their cached write times indexed directly by file id
+		// Note: A deque keeps the entries in place as it grows so the lookup can reference the path strings
+		std::deque<FileEntry> _files;
+		std::unordered_map<std::string_view, FileId, string_hash, std::equal_to<>> _fileLookup;
 		
 		std::unordered_map<std::string, DirectoryState, string_hash, std::equal_to<>> _directoryLookup;
 
-		std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>> _writeCache;
+		std::unordered_map<FileId, std::optional<std::string>> _contentDigestCache;
+
+		// The directory listings from the previous build and the listings captured during this build
+		bool _useDirectorySnapshots;
+		std::map<std::string, DirectorySnapshot> _previousDirectorySnapshots;
+		std::map<std::string, DirectorySnapshot> _directorySnapshots;
+
+		// The directories that have been preloaded in the order they were loaded
+		std::vector<Path> _preloadedDirectories;
 	};
 }
@@ -0,0 +1,191 @@
+﻿// <copyright file="FileSystemWatcher.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// Watches a set of directories for changes to their immediate children
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class FileSystemWatcher
+	{
+	private:
+		// The time to wait for more changes to arrive before reporting a batch
+		static constexpr int SettleTimeMilliseconds = 100;
+
+#if defined(__linux__)
+		int _handle;
+		std::unordered_map<int, Path> _watches;
+		std::unordered_set<std::string> _watchedDirectories;
+		bool _hasOverflowed;
+#endif
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="FileSystemWatcher"/> class.
+		/// </summary>
+		FileSystemWatcher()
+#if defined(__linux__)
+			:
+			_handle(inotify_init1(IN_CLOEXEC)),
+			_watches(),
+			_watchedDirectories(),
+			_hasOverflowed(false)
+		{
+			if (_handle < 0)
+				throw std::runtime_error("Failed to initialize the file system watcher");
+		}
+#else
+		{
+			throw std::runtime_error("Watching the file system is not supported on this platform");
+		}
+#endif
+
+		FileSystemWatcher(const FileSystemWatcher&) = delete;
+		FileSystemWatcher& operator=(const FileSystemWatcher&) = delete;
+
+		~FileSystemWatcher()
+		{
+#if defined(__linux__)
+			close(_handle);
+#endif
+		}
+
+		/// <summary>
+		/// Get a value indicating whether changes were dropped and the known state can no longer be trusted
+		/// </summary>
+		bool HasOverflowed() const
+		{
+#if defined(__linux__)
+			return _hasOverflowed;
+#else
+			return false;
+#endif
+		}
+
+		/// <summary>
+		/// Start watching a single directory, ignored if the directory is already watched
+		/// </summary>
+		void Watch(const Path& directory)
+		{
+#if defined(__linux__)
+			auto directoryValue = directory.ToString();
+			if (_watchedDirectories.contains(directoryValue))
+				return;
+
+			auto watch = inotify_add_watch(
+				_handle,
+				directoryValue.c_str(),
+				IN_CREATE | IN_DELETE | IN_CLOSE_WRITE | IN_MODIFY | IN_ATTRIB |
+				IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR);
+			if (watch < 0)
+			{
+				Log::Warning("Failed to watch directory: {}", directoryValue);
+				return;
+			}
+
+			_watches.insert_or_assign(watch, directory);
+			_watchedDirectories.insert(std::move(directoryValue));
+#endif
+		}
+
+		/// <summary>
+		/// Block until at least one change is observed and the changes have settled
+		/// </summary>
+		std::vector<Path> WaitForChanges()
+		{
+			auto result = std::vector<Path>();
+			ReadChanges(-1, result);
+			while (ReadChanges(SettleTimeMilliseconds, result))
+			{
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Collect all changes that are already pending without blocking
+		/// </summary>
+		std::vector<Path> DrainChanges()
+		{
+			auto result = std::vector<Path>();
+			while (ReadChanges(0, result))
+			{
+			}
+
+			return result;
+		}
+
+	private:
+		bool ReadChanges(int timeoutMilliseconds, std::vector<Path>& changes)
+		{
+#if defined(__linux__)
+			auto pollHandle = pollfd();
+			pollHandle.fd = _handle;
+			pollHandle.events = POLLIN;
+			auto pollResult = poll(&pollHandle, 1, timeoutMilliseconds);
+			if (pollResult < 0)
+			{
+				if (errno == EINTR)
+					return false;
+				throw std::runtime_error("Failed to wait for file system changes");
+			}
+			else if (pollResult == 0)
+			{
+				return false;
+			}
+
+			alignas(inotify_event) char buffer[4096];
+			auto length = read(_handle, buffer, sizeof(buffer));
+			if (length <= 0)
+				return false;
+
+			for (ssize_t offset = 0; offset < length;)
+			{
+				auto event = reinterpret_cast<const inotify_event*>(buffer + offset);
+				offset += sizeof(inotify_event) + event->len;
+
+				if ((event->mask & IN_Q_OVERFLOW) != 0)
+				{
+					_hasOverflowed = true;
+					continue;
+				}
+
+				auto findResult = _watches.find(event->wd);
+				if (findResult == _watches.end())
+					continue;
+
+				if ((event->mask & IN_IGNORED) != 0)
+				{
+					// The directory is no longer watched, allow it to be watched again if it is recreated
+					_watchedDirectories.erase(findResult->second.ToString());
+					_watches.erase(findResult);
+					continue;
+				}
+
+				if ((event->mask & IN_DELETE_SELF) != 0)
+				{
+					changes.push_back(findResult->second);
+				}
+				else if (event->len > 0)
+				{
+					auto name = std::string(event->name);
+					if ((event->mask & IN_ISDIR) != 0)
+						changes.push_back(findResult->second + Path(std::format("./{}/", name)));
+					else
+						changes.push_back(findResult->second + Path(std::format("./{}", name)));
+				}
+			}
+
+			return true;
+#else
+			return false;
+#endif
+		}
+	};
+}
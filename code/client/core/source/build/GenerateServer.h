@@ -0,0 +1,542 @@
+// <copyright file="GenerateServer.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "AllowedAccess.h"
+#include "BuildStateLock.h"
+
+namespace Soup::Core
+{
+#if defined(__linux__)
+	/// <summary>
+	/// A long lived generate process that runs the generate requests of a build one at a time.
+	/// The request is written to the standard input and the process writes the response with the files it accessed
+	/// to a separate response pipe once all of its log output has been flushed.
+	/// The process is started through an intermediate child that exits right away, so the server is never a child of
+	/// this process and a monitor that waits on any child (the ptrace backend) can never reap it. The server exits on
+	/// its own once the request channel is closed.
+	/// </summary>
+	class GenerateServer
+	{
+	private:
+		// The handle the generate process writes the responses to
+		static constexpr int ResponseHandle = 3;
+
+		int _requestHandle;
+		int _responseHandle;
+		int _stdOutHandle;
+		int _stdErrHandle;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="GenerateServer"/> class and starts the process
+		/// </summary>
+		GenerateServer(const Path& executable) :
+			_requestHandle(-1),
+			_responseHandle(-1),
+			_stdOutHandle(-1),
+			_stdErrHandle(-1)
+		{
+			// The request channel is a socket so a write to a server that has died fails instead of raising SIGPIPE
+			int requestSockets[2];
+			if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, requestSockets) < 0)
+				throw std::runtime_error(std::format("Failed to create generate request socket {}", errno));
+
+			// Note: Only the read ends are non blocking, the server must be able to block on a full pipe
+			// The start pipe is closed by the exec of the server or receives the error when it fails
+			int responsePipe[2];
+			int stdOutPipe[2];
+			int stdErrPipe[2];
+			int startPipe[2];
+			if (pipe2(responsePipe, O_CLOEXEC) < 0 ||
+				pipe2(stdOutPipe, O_CLOEXEC) < 0 ||
+				pipe2(stdErrPipe, O_CLOEXEC) < 0 ||
+				pipe2(startPipe, O_CLOEXEC) < 0)
+			{
+				throw std::runtime_error(std::format("Failed to create generate server pipes {}", errno));
+			}
+
+			// The response handle must be moved by dup2 to clear the close on exec flag, it cannot already be in place
+			if (responsePipe[1] == ResponseHandle)
+			{
+				auto handle = fcntl(responsePipe[1], F_DUPFD_CLOEXEC, ResponseHandle + 1);
+				close(responsePipe[1]);
+				responsePipe[1] = handle;
+			}
+
+			auto executableValue = executable.ToString();
+			auto responseHandleValue = std::to_string(ResponseHandle);
+			auto arguments = std::array<char*, 4>({
+				executableValue.data(),
+				const_cast<char*>("-server"),
+				responseHandleValue.data(),
+				nullptr,
+			});
+
+			// Note: Only async signal safe calls are allowed in the children of a multi threaded process
+			auto intermediateProcessId = fork();
+			if (intermediateProcessId == 0)
+			{
+				if (fork() == 0)
+				{
+					if (dup2(requestSockets[1], STDIN_FILENO) >= 0 &&
+						dup2(stdOutPipe[1], STDOUT_FILENO) >= 0 &&
+						dup2(stdErrPipe[1], STDERR_FILENO) >= 0 &&
+						dup2(responsePipe[1], ResponseHandle) >= 0)
+					{
+						execve(executableValue.c_str(), arguments.data(), environ);
+					}
+
+					int error = errno;
+					[[maybe_unused]] auto writeCount = write(startPipe[1], &error, sizeof(error));
+					_exit(127);
+				}
+
+				_exit(0);
+			}
+
+			// Close our handles on the child ends
+			close(requestSockets[1]);
+			close(responsePipe[1]);
+			close(stdOutPipe[1]);
+			close(stdErrPipe[1]);
+			close(startPipe[1]);
+
+			int result = 0;
+			if (intermediateProcessId < 0)
+			{
+				result = errno;
+			}
+			else
+			{
+				int status;
+				while (waitpid(intermediateProcessId, &status, 0) < 0 && errno == EINTR)
+				{
+				}
+
+				// Wait for the exec, the start pipe is closed without any data once it succeeds
+				int error = 0;
+				ssize_t readCount;
+				while ((readCount = read(startPipe[0], &error, sizeof(error))) < 0 && errno == EINTR)
+				{
+				}
+
+				if (readCount > 0)
+					result = error;
+			}
+
+			close(startPipe[0]);
+
+			_requestHandle = requestSockets[0];
+			_responseHandle = responsePipe[0];
+			_stdOutHandle = stdOutPipe[0];
+			_stdErrHandle = stdErrPipe[0];
+
+			if (result != 0)
+			{
+				CloseHandles();
+				throw std::runtime_error(std::format("Failed to start generate server {}", result));
+			}
+
+			for (auto handle : { _responseHandle, _stdOutHandle, _stdErrHandle })
+				fcntl(handle, F_SETFL, O_NONBLOCK);
+		}
+
+		GenerateServer(const GenerateServer&) = delete;
+		GenerateServer& operator=(const GenerateServer&) = delete;
+
+		~GenerateServer()
+		{
+			// Closing the request channel ends the server
+			CloseHandles();
+		}
+
+		/// <summary>
+		/// Check if the server is still waiting for requests, a server that exited has closed the response pipe
+		/// </summary>
+		bool IsRunning()
+		{
+			auto pollHandle = pollfd { _responseHandle, POLLIN, 0 };
+			while (poll(&pollHandle, 1, 0) < 0)
+			{
+				if (errno != EINTR)
+					return false;
+			}
+
+			// An idle server never writes a response, any event is the end of the pipe
+			return pollHandle.revents == 0;
+		}
+
+		/// <summary>
+		/// Send a single generate request, returns false if the server is no longer running
+		/// </summary>
+		bool TrySendRequest(const Path& soupTargetDirectory)
+		{
+			auto request = soupTargetDirectory.ToString() + "\n";
+			auto data = std::string_view(request);
+			while (!data.empty())
+			{
+				auto sent = send(_requestHandle, data.data(), data.size(), MSG_NOSIGNAL);
+				if (sent < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					return false;
+				}
+
+				data.remove_prefix(static_cast<size_t>(sent));
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Wait for the response to the current request while collecting the log output of the server,
+		/// returns false if the server exited before it responded
+		/// </summary>
+		bool TryReadResponse(std::string& response, std::string& stdOut, std::string& stdErr)
+		{
+			enum PollIndex { Response = 0, StdOut = 1, StdErr = 2 };
+			auto pollHandles = std::array<pollfd, 3>({
+				pollfd { _responseHandle, POLLIN, 0 },
+				pollfd { _stdOutHandle, POLLIN, 0 },
+				pollfd { _stdErrHandle, POLLIN, 0 },
+			});
+
+			// Keep the output pipes drained so the server never blocks on a full buffer
+			while (!IsResponseComplete(response))
+			{
+				if (poll(pollHandles.data(), pollHandles.size(), -1) < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					throw std::runtime_error(std::format("poll failed {}", errno));
+				}
+
+				if (pollHandles[StdOut].revents != 0)
+					ReadAvailable(_stdOutHandle, stdOut);
+				if (pollHandles[StdErr].revents != 0)
+					ReadAvailable(_stdErrHandle, stdErr);
+
+				if (pollHandles[Response].revents != 0 && !ReadAvailable(_responseHandle, response))
+					return false;
+			}
+
+			// The output was flushed before the response was written
+			ReadAvailable(_stdOutHandle, stdOut);
+			ReadAvailable(_stdErrHandle, stdErr);
+
+			return true;
+		}
+
+	private:
+		static bool IsResponseComplete(std::string_view response)
+		{
+			return response == "End\n" || response.ends_with("\nEnd\n");
+		}
+
+		/// <summary>
+		/// Read everything that is available on a non blocking handle, returns false once the handle is closed
+		/// </summary>
+		static bool ReadAvailable(int handle, std::string& result)
+		{
+			auto buffer = std::array<char, 64 * 1024>();
+			while (true)
+			{
+				auto readCount = read(handle, buffer.data(), buffer.size());
+				if (readCount < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					if (errno == EAGAIN)
+						return true;
+
+					throw std::runtime_error(std::format("Failed to read from generate server {}", errno));
+				}
+
+				if (readCount == 0)
+					return false;
+
+				result.append(buffer.data(), static_cast<size_t>(readCount));
+			}
+		}
+
+		void CloseHandles()
+		{
+			for (auto handle : { &_requestHandle, &_responseHandle, &_stdOutHandle, &_stdErrHandle })
+			{
+				if (*handle >= 0)
+					close(*handle);
+				*handle = -1;
+			}
+		}
+	};
+
+	/// <summary>
+	/// The set of idle generate servers that are shared by every package in a build
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class GenerateServerPool
+	{
+	private:
+		Path _executable;
+		std::mutex _mutex;
+		std::vector<std::unique_ptr<GenerateServer>> _idleServers;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="GenerateServerPool"/> class.
+		/// </summary>
+		GenerateServerPool(Path executable) :
+			_executable(std::move(executable)),
+			_mutex(),
+			_idleServers()
+		{
+		}
+
+		/// <summary>
+		/// Get a value indicating whether the operation runs the executable that is served by the pool
+		/// </summary>
+		bool IsServerExecutable(const Path& executable) const
+		{
+			return executable.ToString() == _executable.ToString();
+		}
+
+		/// <summary>
+		/// Take an idle server, returns null when all of them are busy
+		/// </summary>
+		std::unique_ptr<GenerateServer> TryTakeIdleServer()
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			if (_idleServers.empty())
+				return nullptr;
+
+			auto server = std::move(_idleServers.back());
+			_idleServers.pop_back();
+			return server;
+		}
+
+		/// <summary>
+		/// Start a new server
+		/// </summary>
+		std::unique_ptr<GenerateServer> StartServer()
+		{
+			return std::make_unique<GenerateServer>(_executable);
+		}
+
+		/// <summary>
+		/// Return a server that finished its request
+		/// </summary>
+		void Release(std::unique_ptr<GenerateServer> server)
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_idleServers.push_back(std::move(server));
+		}
+	};
+
+	/// <summary>
+	/// Runs a single generate operation on a pooled generate server.
+	/// The server is not monitored, it reports the files that the request read and wrote and they are passed along to the
+	/// monitor of the operation after the same read and write access checks that the monitor applies.
+	/// </summary>
+	class GenerateServerProcess : public System::IProcess
+	{
+	private:
+		// Input
+		std::shared_ptr<GenerateServerPool> _pool;
+		Path _soupTargetDirectory;
+		std::shared_ptr<Monitor::ISystemAccessMonitor> _monitor;
+		std::vector<Path> _allowedReadAccess;
+		std::vector<Path> _allowedWriteAccess;
+
+		// Runtime
+		BuildStateLock::Owner _owner;
+		std::unique_ptr<GenerateServer> _server;
+
+		// Result
+		bool _isFinished;
+		std::string _stdOut;
+		std::string _stdErr;
+		int _exitCode;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="GenerateServerProcess"/> class.
+		/// </summary>
+		GenerateServerProcess(
+			std::shared_ptr<GenerateServerPool> pool,
+			const std::vector<std::string>& arguments,
+			std::shared_ptr<Monitor::ISystemAccessMonitor> monitor,
+			std::vector<Path> allowedReadAccess,
+			std::vector<Path> allowedWriteAccess) :
+			_pool(std::move(pool)),
+			_soupTargetDirectory(),
+			_monitor(std::move(monitor)),
+			_allowedReadAccess(std::move(allowedReadAccess)),
+			_allowedWriteAccess(std::move(allowedWriteAccess)),
+			_owner(),
+			_server(),
+			_isFinished(false),
+			_stdOut(),
+			_stdErr(),
+			_exitCode(-1)
+		{
+			if (arguments.size() != 1)
+				throw std::runtime_error("The generate server expects a single soup target directory");
+
+			_soupTargetDirectory = Path(arguments[0]);
+		}
+
+		/// <summary>
+		/// Send the request to an idle server.
+		/// Note: A new server is only started here, process creation is serialized with the monitored processes.
+		/// </summary>
+		void Start() override final
+		{
+			// An idle server can exit before the next request, only a request that was never sent moves to another server
+			while ((_server = _pool->TryTakeIdleServer()) != nullptr)
+			{
+				if (_server->IsRunning() && _server->TrySendRequest(_soupTargetDirectory))
+					return;
+
+				auto borrow = BuildStateLock::ScopedBorrow(_owner);
+				Log::Warning("Idle generate server exited unexpectedly");
+			}
+
+			SendToNewServer();
+		}
+
+		/// <summary>
+		/// Wait for the server to respond
+		/// </summary>
+		void WaitForExit() override final
+		{
+			// The request may have run in part, it is never run again on another server
+			auto response = std::string();
+			if (!_server->TryReadResponse(response, _stdOut, _stdErr))
+			{
+				// Drop the server, the next request starts a new one
+				_server = nullptr;
+				_stdErr.append("Generate server exited unexpectedly\n");
+				_exitCode = -1;
+				_isFinished = true;
+				return;
+			}
+
+			_pool->Release(std::move(_server));
+			ParseResponse(response);
+			_isFinished = true;
+		}
+
+		/// <summary>
+		/// Get the exit code
+		/// </summary>
+		int GetExitCode() override final
+		{
+			if (!_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return _exitCode;
+		}
+
+		/// <summary>
+		/// Get the standard output
+		/// </summary>
+		std::string GetStandardOutput() override final
+		{
+			if (!_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return _stdOut;
+		}
+
+		/// <summary>
+		/// Get the standard error output
+		/// </summary>
+		std::string GetStandardError() override final
+		{
+			if (!_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return _stdErr;
+		}
+
+	private:
+		void SendToNewServer()
+		{
+			{
+				auto borrow = BuildStateLock::ScopedBorrow(_owner);
+				Log::Diag("Start generate server");
+			}
+
+			_server = _pool->StartServer();
+			if (!_server->TrySendRequest(_soupTargetDirectory))
+				throw std::runtime_error("Failed to send the generate request");
+		}
+
+		void ParseResponse(const std::string& response)
+		{
+			auto stream = std::istringstream(response);
+			auto line = std::string();
+			while (std::getline(stream, line))
+			{
+				auto separator = line.find(": ");
+				if (separator == std::string::npos)
+					continue;
+
+				auto type = std::string_view(line).substr(0, separator);
+				auto value = std::string_view(line).substr(separator + 2);
+				if (type == "Exit")
+					_exitCode = std::stoi(std::string(value));
+				else if (type == "Input")
+					TouchFileRead(value, true);
+				else if (type == "MissingInput")
+					TouchFileRead(value, false);
+				else if (type == "Output")
+					TouchFileWrite(value);
+				else
+					throw std::runtime_error(std::format("Unknown generate server response: {}", line));
+			}
+		}
+
+		/// <summary>
+		/// The server already accessed the file, an access outside of the allowed set fails the request
+		/// </summary>
+		void TouchFileRead(std::string_view file, bool exists)
+		{
+			auto isAllowed = AllowedAccess::IsAllowed(Path(file), _allowedReadAccess);
+			_monitor->TouchFileRead(file, exists, !isAllowed);
+			if (!isAllowed)
+				FailAccess(std::format("File read access denied: {}", file));
+		}
+
+		void TouchFileWrite(std::string_view file)
+		{
+			auto isAllowed = AllowedAccess::IsAllowed(Path(file), _allowedWriteAccess);
+			_monitor->TouchFileWrite(file, !isAllowed);
+			if (!isAllowed)
+				FailAccess(std::format("File write access denied: {}", file));
+		}
+
+		void FailAccess(std::string_view message)
+		{
+			_stdErr.append(message);
+			_stdErr.append("\n");
+			if (_exitCode == 0)
+				_exitCode = -1;
+		}
+	};
+#else
+	/// <summary>
+	/// The generate server is only supported on Linux
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class GenerateServerPool
+	{
+	};
+#endif
+}
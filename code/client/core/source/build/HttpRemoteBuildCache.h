@@ -0,0 +1,284 @@
+﻿// <copyright file="HttpRemoteBuildCache.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "IRemoteBuildCache.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A remote build cache that talks to a simple HTTP/1.1 server.
+	/// Each entry maps directly to a resource under the base url:
+	///   HEAD [url]/[name] checks for an entry, 200 when it exists and 404 when it does not
+	///   GET [url]/[name] downloads an entry, 200 with the content as the body or 404 when missing
+	///   PUT [url]/[name] uploads an entry, any 2xx status is success
+	/// Every request uses its own connection so there is no shared state between operations.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class HttpRemoteBuildCache : public IRemoteBuildCache
+	{
+	private:
+		// The time to wait for the server before the request is abandoned
+		static constexpr int TimeoutSeconds = 30;
+
+		struct HttpResponse
+		{
+			int StatusCode;
+			std::string Body;
+		};
+
+		std::string _host;
+		std::string _port;
+		std::string _basePath;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="HttpRemoteBuildCache"/> class.
+		/// The url must be in the form http://host[:port][/path]
+		/// </summary>
+		HttpRemoteBuildCache(std::string_view url) :
+			_host(),
+			_port("80"),
+			_basePath("/")
+		{
+			constexpr auto scheme = std::string_view("http://");
+			if (!url.starts_with(scheme))
+				throw std::runtime_error(std::format("Remote build cache url must start with {}: {}", scheme, url));
+
+			auto authority = url.substr(scheme.size());
+			auto pathStart = authority.find('/');
+			if (pathStart != std::string_view::npos)
+			{
+				_basePath = std::string(authority.substr(pathStart));
+				authority = authority.substr(0, pathStart);
+				if (!_basePath.ends_with('/'))
+					_basePath.push_back('/');
+			}
+
+			auto portStart = authority.rfind(':');
+			if (portStart != std::string_view::npos)
+			{
+				_port = std::string(authority.substr(portStart + 1));
+				authority = authority.substr(0, portStart);
+			}
+
+			_host = std::string(authority);
+			if (_host.empty() || _port.empty())
+				throw std::runtime_error(std::format("Invalid remote build cache url: {}", url));
+		}
+
+		bool Exists(std::string_view name) override final
+		{
+			auto response = SendRequest("HEAD", name, {});
+			return CheckFound(response, name);
+		}
+
+		bool TryGet(std::string_view name, std::string& content) override final
+		{
+			auto response = SendRequest("GET", name, {});
+			if (!CheckFound(response, name))
+				return false;
+
+			content = std::move(response.Body);
+			return true;
+		}
+
+		void Put(std::string_view name, std::string_view content) override final
+		{
+			auto response = SendRequest("PUT", name, content);
+			if (response.StatusCode < 200 || response.StatusCode >= 300)
+				throw std::runtime_error(std::format("Remote build cache PUT {} failed: {}", name, response.StatusCode));
+		}
+
+	private:
+		static bool CheckFound(const HttpResponse& response, std::string_view name)
+		{
+			if (response.StatusCode == 200)
+				return true;
+			else if (response.StatusCode == 404)
+				return false;
+			else
+				throw std::runtime_error(std::format("Remote build cache request {} failed: {}", name, response.StatusCode));
+		}
+
+		HttpResponse SendRequest(std::string_view method, std::string_view name, std::string_view body)
+		{
+#if defined(__linux__)
+			auto request = std::stringstream();
+			request << method << " " << _basePath << name << " HTTP/1.1\r\n";
+			request << "Host: " << _host << ":" << _port << "\r\n";
+			request << "Connection: close\r\n";
+			request << "Content-Length: " << body.size() << "\r\n";
+			request << "\r\n";
+			request << body;
+
+			auto socketHandle = Connect();
+			try
+			{
+				SendAll(socketHandle, request.str());
+				auto response = ReadResponse(socketHandle, method == "HEAD");
+				close(socketHandle);
+				return response;
+			}
+			catch (...)
+			{
+				close(socketHandle);
+				throw;
+			}
+#else
+			throw std::runtime_error("The remote build cache is not supported on this platform");
+#endif
+		}
+
+#if defined(__linux__)
+		int Connect()
+		{
+			addrinfo hints = {};
+			hints.ai_family = AF_UNSPEC;
+			hints.ai_socktype = SOCK_STREAM;
+
+			addrinfo* addresses = nullptr;
+			auto result = getaddrinfo(_host.c_str(), _port.c_str(), &hints, &addresses);
+			if (result != 0)
+				throw std::runtime_error(std::format("Failed to resolve remote build cache host {}: {}", _host, gai_strerror(result)));
+
+			int socketHandle = -1;
+			for (auto address = addresses; address != nullptr; address = address->ai_next)
+			{
+				socketHandle = socket(address->ai_family, address->ai_socktype | SOCK_CLOEXEC, address->ai_protocol);
+				if (socketHandle < 0)
+					continue;
+
+				timeval timeout = { TimeoutSeconds, 0 };
+				setsockopt(socketHandle, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+				setsockopt(socketHandle, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+				if (connect(socketHandle, address->ai_addr, address->ai_addrlen) == 0)
+					break;
+
+				close(socketHandle);
+				socketHandle = -1;
+			}
+
+			freeaddrinfo(addresses);
+
+			if (socketHandle < 0)
+				throw std::runtime_error(std::format("Failed to connect to remote build cache {}:{}", _host, _port));
+
+			return socketHandle;
+		}
+
+		static void SendAll(int socketHandle, std::string_view data)
+		{
+			while (!data.empty())
+			{
+				auto sent = send(socketHandle, data.data(), data.size(), MSG_NOSIGNAL);
+				if (sent < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					throw std::runtime_error("Failed to send remote build cache request");
+				}
+
+				data.remove_prefix(static_cast<size_t>(sent));
+			}
+		}
+
+		static HttpResponse ReadResponse(int socketHandle, bool isHeadRequest)
+		{
+			// The connection is closed by the server after the response
+			auto data = std::string();
+			auto buffer = std::array<char, 64 * 1024>();
+			while (true)
+			{
+				auto received = recv(socketHandle, buffer.data(), buffer.size(), 0);
+				if (received < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					throw std::runtime_error("Failed to read remote build cache response");
+				}
+				else if (received == 0)
+				{
+					break;
+				}
+
+				data.append(buffer.data(), static_cast<size_t>(received));
+			}
+
+			auto headerEnd = data.find("\r\n\r\n");
+			if (headerEnd == std::string::npos || !data.starts_with("HTTP/1."))
+				throw std::runtime_error("Invalid remote build cache response");
+
+			// Parse the status code from the status line "HTTP/1.1 200 OK"
+			auto response = HttpResponse();
+			auto statusStart = data.find(' ');
+			if (statusStart == std::string::npos || statusStart > headerEnd ||
+				std::from_chars(data.data() + statusStart + 1, data.data() + headerEnd, response.StatusCode).ec != std::errc())
+			{
+				throw std::runtime_error("Invalid remote build cache response status");
+			}
+
+			auto bodyStart = headerEnd + 4;
+			auto contentLength = GetContentLength(std::string_view(data).substr(0, headerEnd));
+			if (isHeadRequest)
+			{
+				// The content length describes the entry, there is no body
+			}
+			else if (contentLength.has_value())
+			{
+				if (data.size() - bodyStart < contentLength.value())
+					throw std::runtime_error("Remote build cache response was truncated");
+
+				response.Body = data.substr(bodyStart, contentLength.value());
+			}
+			else
+			{
+				response.Body = data.substr(bodyStart);
+			}
+
+			return response;
+		}
+
+		static std::optional<size_t> GetContentLength(std::string_view headers)
+		{
+			constexpr auto headerName = std::string_view("content-length:");
+			size_t lineStart = 0;
+			while (lineStart < headers.size())
+			{
+				auto lineEnd = headers.find("\r\n", lineStart);
+				if (lineEnd == std::string_view::npos)
+					lineEnd = headers.size();
+
+				auto line = headers.substr(lineStart, lineEnd - lineStart);
+				if (line.size() > headerName.size() &&
+					std::equal(
+						headerName.begin(),
+						headerName.end(),
+						line.begin(),
+						[](char lhs, char rhs) { return lhs == std::tolower(static_cast<unsigned char>(rhs)); }))
+				{
+					auto value = line.substr(headerName.size());
+					while (!value.empty() && value.front() == ' ')
+						value.remove_prefix(1);
+
+					size_t result = 0;
+					if (std::from_chars(value.data(), value.data() + value.size(), result).ec != std::errc())
+						throw std::runtime_error("Invalid remote build cache response content length");
+
+					return result;
+				}
+
+				lineStart = lineEnd + 2;
+			}
+
+			return std::nullopt;
+		}
+#endif
+	};
+}
@@ -0,0 +1,37 @@
+﻿// <copyright file="IRemoteBuildCache.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The remote store that shares build cache entries between machines.
+	/// Entries are addressed by their relative name in the cache, either "operations/[key].bcm" for an
+	/// operation manifest or "content/[digest]" for the content of a single output file.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class IRemoteBuildCache
+	{
+	public:
+		virtual ~IRemoteBuildCache() {}
+
+		/// <summary>
+		/// Check if the remote cache has an entry
+		/// </summary>
+		virtual bool Exists(std::string_view name) = 0;
+
+		/// <summary>
+		/// Download the content of an entry if it exists
+		/// </summary>
+		virtual bool TryGet(std::string_view name, std::string& content) = 0;
+
+		/// <summary>
+		/// Upload the content of an entry
+		/// </summary>
+		virtual void Put(std::string_view name, std::string_view content) = 0;
+	};
+}
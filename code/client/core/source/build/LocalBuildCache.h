@@ -0,0 +1,578 @@
+﻿// <copyright file="LocalBuildCache.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "FileSystemState.h"
+#include "IRemoteBuildCache.h"
+#include "utilities/CacheName.h"
+#include "operation-graph/OperationInfo.h"
+#include "operation-graph/OperationResult.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A content addressed store of operation outputs that is shared by every build on the machine.
+	/// An entry is keyed by the operation command and the content of its declared inputs. The entry records the
+	/// content of every observed input, which must still match, and the content of each output file.
+	/// Paths under the operation working directory are stored relative to it so that entries can be restored
+	/// into a different checkout or output directory.
+	/// An optional remote cache is checked for entries that are missing locally and receives every new entry.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LocalBuildCache
+	{
+	private:
+		// Binary Cache Manifest file format
+		static constexpr uint32_t FileVersion = 2;
+
+		// The previous file format without the output permissions that can still be read
+		static constexpr uint32_t NoPermissionsFileVersion = 1;
+
+		// The placeholder that replaces the operation working directory in the cache key and manifest paths
+		static constexpr std::string_view WorkingDirectoryToken = "$(WorkingDirectory)/";
+
+		/// <summary>
+		/// The recorded files for a single cache entry, each file is stored as the path and content digest.
+		/// The permissions of each output file are kept so a restored executable can still be run.
+		/// </summary>
+		struct CacheManifest
+		{
+			std::vector<std::pair<std::string, std::string>> Input;
+			std::vector<std::pair<std::string, std::string>> Output;
+			std::vector<uint32_t> OutputPermissions;
+		};
+
+		Path _cacheDirectory;
+		FileSystemState& _fileSystemState;
+		std::shared_ptr<IRemoteBuildCache> _remoteCache;
+		bool _hasCacheDirectories;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="LocalBuildCache"/> class.
+		/// </summary>
+		LocalBuildCache(
+			Path cacheDirectory,
+			FileSystemState& fileSystemState) :
+			LocalBuildCache(std::move(cacheDirectory), fileSystemState, nullptr)
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref="LocalBuildCache"/> class.
+		/// </summary>
+		LocalBuildCache(
+			Path cacheDirectory,
+			FileSystemState& fileSystemState,
+			std::shared_ptr<IRemoteBuildCache> remoteCache) :
+			_cacheDirectory(std::move(cacheDirectory)),
+			_fileSystemState(fileSystemState),
+			_remoteCache(std::move(remoteCache)),
+			_hasCacheDirectories(false)
+		{
+		}
+
+		/// <summary>
+		/// Attempt to restore the outputs for an operation from a previous run with the same command and input content
+		/// </summary>
+		bool TryRestore(
+			const OperationInfo& operationInfo,
+			OperationResult& operationResult)
+		{
+			auto& workingDirectory = operationInfo.Command.WorkingDirectory;
+			auto manifest = CacheManifest();
+			if (!TryLoadManifest(GetManifestName(GetOperationKey(operationInfo)), manifest))
+			{
+				Log::Diag("Build cache miss");
+				return false;
+			}
+
+			// Take the evaluate time before the inputs are checked, an input that changes during the restore is outdated
+			auto startTime = System::ISystem::Current().GetCurrentTime();
+
+			// Every file that was read by the cached run must still have the same content
+			auto input = std::vector<Path>();
+			for (auto& [file, digest] : manifest.Input)
+			{
+				auto path = ExpandPath(file, workingDirectory);
+				auto contentDigest = _fileSystemState.GetContentDigest(_fileSystemState.ToFileId(path, workingDirectory));
+				if (!contentDigest.has_value() || contentDigest.value() != digest)
+				{
+					Log::Diag("Build cache miss: Input changed {}", path.ToString());
+					return false;
+				}
+
+				input.push_back(std::move(path));
+			}
+
+			// The manifest may come from the remote cache, only the declared outputs of the operation can be written
+			auto output = std::vector<Path>();
+			for (auto& [file, digest] : manifest.Output)
+			{
+				auto path = ExpandPath(file, workingDirectory);
+				auto fileId = _fileSystemState.ToFileId(path, workingDirectory);
+				if (std::find(operationInfo.DeclaredOutput.begin(), operationInfo.DeclaredOutput.end(), fileId) ==
+					operationInfo.DeclaredOutput.end())
+				{
+					Log::Warning("Build cache manifest rejected: Undeclared output {}", path.ToString());
+					return false;
+				}
+
+				output.push_back(std::move(path));
+			}
+
+			// Load all of the outputs before any file is written so a missing entry does not leave a partial restore
+			auto outputContent = std::vector<std::string>();
+			for (auto& [file, digest] : manifest.Output)
+			{
+				auto contentName = GetContentName(digest);
+				auto content = std::string();
+				if (!TryReadEntry(contentName, content))
+				{
+					Log::Warning("Build cache content missing: {}", digest);
+					return false;
+				}
+
+				if (CryptoPP::Sha1::HashBase64(content) != digest)
+				{
+					// Remove the corrupted entry so the next successful run stores it again
+					Log::Warning("Build cache content corrupted: {}", digest);
+					System::IFileSystem::Current().DeleteFile(GetEntryFile(contentName));
+					return false;
+				}
+
+				outputContent.push_back(std::move(content));
+			}
+
+			for (auto i = 0u; i < output.size(); i++)
+			{
+				{
+					auto file = System::IFileSystem::Current().OpenWrite(output[i], true);
+					file->GetOutStream().write(outputContent[i].data(), outputContent[i].size());
+				}
+
+				if (i < manifest.OutputPermissions.size())
+					RestorePermissions(output[i], manifest.OutputPermissions[i]);
+			}
+
+			Log::Info("Restored from build cache");
+
+			operationResult.ObservedInput = _fileSystemState.ToFileIds(input, workingDirectory);
+			operationResult.ObservedOutput = _fileSystemState.ToFileIds(output, workingDirectory);
+
+			// Mark this operation as successful to enable future incremental builds
+			operationResult.WasSuccessfulRun = true;
+			operationResult.EvaluateTime = startTime;
+
+			// Ensure the File System State is notified of any output files that have changed
+			_fileSystemState.InvalidateFileWriteTimes(operationResult.ObservedOutput);
+
+			return true;
+		}
+
+		/// <summary>
+		/// Save the observed files and output content for a successful operation
+		/// </summary>
+		void Store(
+			const OperationInfo& operationInfo,
+			const OperationResult& operationResult)
+		{
+			// Only declared output files can be restored, anything else (such as a created directory) is left to the operation
+			if (operationResult.ObservedOutput.empty())
+				return;
+
+			for (auto fileId : operationResult.ObservedOutput)
+			{
+				if (std::find(operationInfo.DeclaredOutput.begin(), operationInfo.DeclaredOutput.end(), fileId) ==
+					operationInfo.DeclaredOutput.end())
+				{
+					Log::Diag("Build cache skipped: Undeclared output {}", _fileSystemState.GetFilePath(fileId).ToString());
+					return;
+				}
+			}
+
+			auto& workingDirectory = operationInfo.Command.WorkingDirectory;
+			auto manifest = CacheManifest();
+			for (auto fileId : operationResult.ObservedInput)
+			{
+				auto contentDigest = _fileSystemState.GetContentDigest(fileId);
+				if (!contentDigest.has_value())
+				{
+					Log::Diag("Build cache skipped: Missing input {}", _fileSystemState.GetFilePath(fileId).ToString());
+					return;
+				}
+
+				manifest.Input.emplace_back(
+					NormalizePath(_fileSystemState.GetFilePath(fileId), workingDirectory),
+					std::move(contentDigest.value()));
+			}
+
+			EnsureCacheDirectories();
+
+			for (auto fileId : operationResult.ObservedOutput)
+			{
+				auto& path = _fileSystemState.GetFilePath(fileId);
+				auto content = std::string();
+				if (!TryReadFile(path, content))
+				{
+					Log::Diag("Build cache skipped: Missing output {}", path.ToString());
+					return;
+				}
+
+				// The content is addressed by its digest, so an existing entry never needs to be written again
+				auto digest = CryptoPP::Sha1::HashBase64(content);
+				auto contentName = GetContentName(digest);
+				if (!System::IFileSystem::Current().Exists(GetEntryFile(contentName)))
+					WriteEntry(contentName, content);
+
+				if (_remoteCache != nullptr)
+				{
+					RunRemote([&]()
+					{
+						if (!_remoteCache->Exists(contentName))
+							_remoteCache->Put(contentName, content);
+					});
+				}
+
+				manifest.Output.emplace_back(NormalizePath(path, workingDirectory), std::move(digest));
+				manifest.OutputPermissions.push_back(GetPermissions(path));
+			}
+
+			// Write the manifest last so that it only references content that is already in the store
+			auto manifestStream = std::stringstream();
+			manifestStream.write("BCM\0", 4);
+			WriteValue(manifestStream, FileVersion);
+			WriteFiles(manifestStream, manifest.Input);
+			WriteFiles(manifestStream, manifest.Output);
+			WriteValue(manifestStream, static_cast<uint32_t>(manifest.OutputPermissions.size()));
+			for (auto permissions : manifest.OutputPermissions)
+				WriteValue(manifestStream, permissions);
+
+			auto manifestContent = manifestStream.str();
+
+			auto manifestName = GetManifestName(GetOperationKey(operationInfo));
+			WriteEntry(manifestName, manifestContent);
+
+			if (_remoteCache != nullptr)
+			{
+				RunRemote([&]()
+				{
+					_remoteCache->Put(manifestName, manifestContent);
+				});
+			}
+		}
+
+	private:
+		/// <summary>
+		/// Build the unique key for an operation from the command and the content of the declared inputs
+		/// </summary>
+		std::string GetOperationKey(const OperationInfo& operationInfo)
+		{
+			auto& workingDirectory = operationInfo.Command.WorkingDirectory;
+			auto keyStream = std::stringstream();
+
+			auto executableFileId = _fileSystemState.ToFileId(operationInfo.Command.Executable, workingDirectory);
+			keyStream << "Executable: " << NormalizePath(_fileSystemState.GetFilePath(executableFileId), workingDirectory) << "\n";
+			keyStream << "ExecutableDigest: " << _fileSystemState.GetContentDigest(executableFileId).value_or(std::string()) << "\n";
+
+			for (auto& argument : operationInfo.Command.Arguments)
+				keyStream << "Argument: " << NormalizeValue(argument, workingDirectory) << "\n";
+
+			for (auto fileId : operationInfo.DeclaredInput)
+			{
+				keyStream << "Input: " << NormalizePath(_fileSystemState.GetFilePath(fileId), workingDirectory) << "\n";
+				keyStream << "InputDigest: " << _fileSystemState.GetContentDigest(fileId).value_or(std::string()) << "\n";
+			}
+
+			return CryptoPP::Sha1::HashBase64(keyStream.str());
+		}
+
+		static std::string GetManifestName(const std::string& key)
+		{
+			return std::format("operations/{}.bcm", CacheName::FromDigest(key));
+		}
+
+		static std::string GetContentName(const std::string& digest)
+		{
+			return std::format("content/{}", CacheName::FromDigest(digest));
+		}
+
+		Path GetEntryFile(std::string_view name) const
+		{
+			return _cacheDirectory + Path(std::format("./{}", name));
+		}
+
+		/// <summary>
+		/// Write an entry to a unique temporary file and move it into place, so an interrupted write never leaves a
+		/// truncated entry behind and concurrent builds never see a partial file
+		/// </summary>
+		void WriteEntry(std::string_view name, std::string_view content)
+		{
+			auto entryFile = GetEntryFile(name);
+			auto temporaryFile = Path(std::format("{}.{:x}.tmp", entryFile.ToString(), std::random_device()()));
+			{
+				auto file = System::IFileSystem::Current().OpenWrite(temporaryFile, true);
+				file->GetOutStream().write(content.data(), content.size());
+				file->GetOutStream().flush();
+				if (!file->GetOutStream().good())
+					throw std::runtime_error(std::format("Failed to write build cache entry {}", name));
+			}
+
+			System::IFileSystem::Current().Rename(temporaryFile, entryFile);
+		}
+
+		/// <summary>
+		/// Read an entry from the local cache, falling back to the remote cache and keeping a local copy
+		/// </summary>
+		bool TryReadEntry(std::string_view name, std::string& content)
+		{
+			if (TryReadFile(GetEntryFile(name), content))
+				return true;
+
+			if (_remoteCache == nullptr)
+				return false;
+
+			bool result = false;
+			RunRemote([&]()
+			{
+				result = _remoteCache->TryGet(name, content);
+			});
+
+			if (result)
+			{
+				Log::Diag("Downloaded from remote build cache: {}", name);
+				EnsureCacheDirectories();
+				WriteEntry(name, content);
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Run a remote cache request, an unavailable remote cache is reported once and then ignored for the rest of the build
+		/// </summary>
+		template<typename TAction>
+		void RunRemote(TAction action)
+		{
+			try
+			{
+				action();
+			}
+			catch (const std::exception& ex)
+			{
+				Log::Warning("Remote build cache disabled: {}", ex.what());
+				_remoteCache = nullptr;
+			}
+		}
+
+		void EnsureCacheDirectories()
+		{
+			if (_hasCacheDirectories)
+				return;
+
+			for (auto& directory : { _cacheDirectory + Path("./operations/"), _cacheDirectory + Path("./content/") })
+			{
+				if (!System::IFileSystem::Current().Exists(directory))
+				{
+					Log::Info("Create Directory: {}", directory.ToString());
+					System::IFileSystem::Current().CreateDirectory(directory);
+				}
+			}
+
+			_hasCacheDirectories = true;
+		}
+
+		/// <summary>
+		/// Replace the working directory in a file path with the placeholder token
+		/// </summary>
+		static std::string NormalizePath(const Path& path, const Path& workingDirectory)
+		{
+			auto& value = path.ToString();
+			auto& root = workingDirectory.ToString();
+			if (value.starts_with(root))
+				return std::format("{}{}", WorkingDirectoryToken, std::string_view(value).substr(root.size()));
+			else
+				return value;
+		}
+
+		static Path ExpandPath(std::string_view value, const Path& workingDirectory)
+		{
+			if (value.starts_with(WorkingDirectoryToken))
+				return Path(std::format("{}{}", workingDirectory.ToString(), value.substr(WorkingDirectoryToken.size())));
+			else
+				return Path(value);
+		}
+
+		/// <summary>
+		/// Replace every reference to the working directory in an argument with the placeholder token
+		/// </summary>
+		static std::string NormalizeValue(std::string_view value, const Path& workingDirectory)
+		{
+			// Match the directory without the trailing separator to also find references to the directory itself
+			auto root = std::string_view(workingDirectory.ToString());
+			if (root.ends_with('/'))
+				root.remove_suffix(1);
+
+			auto token = WorkingDirectoryToken.substr(0, WorkingDirectoryToken.size() - 1);
+			auto result = std::string();
+			size_t offset = 0;
+			while (!root.empty())
+			{
+				auto match = value.find(root, offset);
+				if (match == std::string_view::npos)
+					break;
+
+				result.append(value.substr(offset, match - offset));
+				result.append(token);
+				offset = match + root.size();
+			}
+
+			result.append(value.substr(offset));
+			return result;
+		}
+
+		/// <summary>
+		/// Get the permissions of an output file, unknown when they cannot be read
+		/// </summary>
+		static uint32_t GetPermissions(const Path& path)
+		{
+			auto error = std::error_code();
+			auto status = std::filesystem::status(path.ToString(), error);
+			if (error || !std::filesystem::exists(status))
+				return static_cast<uint32_t>(std::filesystem::perms::unknown);
+
+			return static_cast<uint32_t>(status.permissions());
+		}
+
+		/// <summary>
+		/// Apply the recorded permissions to a restored output file
+		/// </summary>
+		static void RestorePermissions(const Path& path, uint32_t permissions)
+		{
+			if (permissions == static_cast<uint32_t>(std::filesystem::perms::unknown))
+				return;
+
+			auto error = std::error_code();
+			std::filesystem::permissions(
+				path.ToString(),
+				static_cast<std::filesystem::perms>(permissions),
+				std::filesystem::perm_options::replace,
+				error);
+			if (error)
+				Log::Warning("Failed to restore permissions for {}: {}", path.ToString(), error.message());
+		}
+
+		static bool TryReadFile(const Path& path, std::string& content)
+		{
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(path, true, file))
+				return false;
+
+			content = std::string(
+				std::istreambuf_iterator<char>(file->GetInStream()),
+				std::istreambuf_iterator<char>());
+			return true;
+		}
+
+		bool TryLoadManifest(const std::string& manifestName, CacheManifest& manifest)
+		{
+			auto content = std::string();
+			if (!TryReadEntry(manifestName, content))
+				return false;
+
+			try
+			{
+				size_t offset = 0;
+				if (content.size() < 8 || content.compare(0, 4, std::string_view("BCM\0", 4)) != 0)
+					throw std::runtime_error("Invalid build cache manifest header");
+
+				offset = 4;
+				auto fileVersion = ReadUInt32(content, offset);
+				if (fileVersion != FileVersion && fileVersion != NoPermissionsFileVersion)
+					throw std::runtime_error("Build cache manifest version does not match expected");
+
+				manifest.Input = ReadFiles(content, offset);
+				manifest.Output = ReadFiles(content, offset);
+				if (fileVersion >= FileVersion)
+				{
+					auto permissionsCount = ReadUInt32(content, offset);
+					if (permissionsCount != manifest.Output.size())
+						throw std::runtime_error("Build cache manifest permissions do not match the outputs");
+
+					for (auto i = 0u; i < permissionsCount; i++)
+						manifest.OutputPermissions.push_back(ReadUInt32(content, offset));
+				}
+
+				if (offset != content.size())
+					throw std::runtime_error("Build cache manifest corrupted - Did not read the entire file");
+			}
+			catch (const std::runtime_error& ex)
+			{
+				Log::Warning("Ignoring build cache manifest {}: {}", manifestName, ex.what());
+				return false;
+			}
+
+			return true;
+		}
+
+		static std::vector<std::pair<std::string, std::string>> ReadFiles(const std::string& content, size_t& offset)
+		{
+			auto count = ReadUInt32(content, offset);
+			auto result = std::vector<std::pair<std::string, std::string>>();
+			for (auto i = 0u; i < count; i++)
+			{
+				auto path = ReadString(content, offset);
+				auto digest = ReadString(content, offset);
+				result.emplace_back(std::move(path), std::move(digest));
+			}
+
+			return result;
+		}
+
+		static uint32_t ReadUInt32(const std::string& content, size_t& offset)
+		{
+			if (content.size() - offset < sizeof(uint32_t))
+				throw std::runtime_error("Tried to read past end of data");
+
+			uint32_t result = 0;
+			memcpy(&result, content.data() + offset, sizeof(uint32_t));
+			offset += sizeof(uint32_t);
+			return result;
+		}
+
+		static std::string ReadString(const std::string& content, size_t& offset)
+		{
+			auto size = ReadUInt32(content, offset);
+			if (content.size() - offset < size)
+				throw std::runtime_error("Tried to read past end of data");
+
+			auto result = content.substr(offset, size);
+			offset += size;
+			return result;
+		}
+
+		static void WriteFiles(std::ostream& stream, const std::vector<std::pair<std::string, std::string>>& files)
+		{
+			WriteValue(stream, static_cast<uint32_t>(files.size()));
+			for (auto& [path, digest] : files)
+			{
+				WriteValue(stream, path);
+				WriteValue(stream, digest);
+			}
+		}
+
+		static void WriteValue(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
+		}
+
+		static void WriteValue(std::ostream& stream, std::string_view value)
+		{
+			WriteValue(stream, static_cast<uint32_t>(value.size()));
+			stream.write(value.data(), value.size());
+		}
+	};
+}
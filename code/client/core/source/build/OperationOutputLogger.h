@@ -0,0 +1,163 @@
+﻿// <copyright file="OperationOutputLogger.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "BuildStateLock.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// Streams the output of a running operation to the log one line at a time.
+	/// Standard output is logged as info and standard error as errors, a trailing partial line is held until
+	/// the next chunk completes it or the logger is flushed. The standard output is also kept so that it can be
+	/// repeated as a warning when the process fails, which is only known once it has exited.
+	/// The output arrives on the monitor threads, which only split it into lines. The thread that owns the build state
+	/// logs the lines as they arrive, so the monitor never waits on the build state lock that other packages may hold.
+	/// </summary>
+	class OperationOutputLogger : public Monitor::IProcessOutputListener
+	{
+	private:
+		struct PendingLine
+		{
+			bool IsError;
+			std::string Line;
+		};
+
+		BuildStateLock::Owner _owner;
+		std::mutex _mutex;
+		std::condition_variable _condition;
+		std::string _stdOut;
+		std::string _stdErr;
+		std::string _streamedStdOut;
+		std::vector<PendingLine> _pendingLines;
+		bool _isComplete;
+
+	public:
+		OperationOutputLogger() :
+			_owner(),
+			_mutex(),
+			_condition(),
+			_stdOut(),
+			_stdErr(),
+			_streamedStdOut(),
+			_pendingLines(),
+			_isComplete(false)
+		{
+		}
+
+		void OnStandardOutput(std::string_view value) override final
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			_streamedStdOut.append(value);
+			SplitLines(_stdOut, value, false);
+		}
+
+		void OnStandardError(std::string_view value) override final
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			SplitLines(_stdErr, value, true);
+		}
+
+		/// <summary>
+		/// Signal that the process has exited and no more output will arrive
+		/// </summary>
+		void Complete()
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(_mutex);
+				_isComplete = true;
+			}
+
+			_condition.notify_one();
+		}
+
+		/// <summary>
+		/// Log the lines as they arrive until the logger is completed, called by the thread that owns the build state
+		/// while the lock is released
+		/// </summary>
+		void LogUntilComplete()
+		{
+			auto lock = std::unique_lock<std::mutex>(_mutex);
+			while (true)
+			{
+				_condition.wait(lock, [this]() { return !_pendingLines.empty() || _isComplete; });
+				auto lines = std::move(_pendingLines);
+				_pendingLines.clear();
+				auto isComplete = _isComplete;
+				lock.unlock();
+
+				{
+					auto borrow = BuildStateLock::ScopedBorrow(_owner);
+					LogLines(lines);
+				}
+
+				if (isComplete)
+					return;
+
+				lock.lock();
+			}
+		}
+
+		/// <summary>
+		/// Log the remaining lines and partial lines once the process has exited
+		/// </summary>
+		void Flush()
+		{
+			auto borrow = BuildStateLock::ScopedBorrow(_owner);
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			LogLines(_pendingLines);
+			if (!_stdOut.empty())
+				Log::Info(_stdOut);
+			if (!_stdErr.empty())
+				Log::Error(_stdErr);
+
+			_pendingLines.clear();
+			_stdOut.clear();
+			_stdErr.clear();
+		}
+
+		/// <summary>
+		/// Take all of the standard output that was streamed
+		/// </summary>
+		std::string TakeStandardOutput()
+		{
+			auto lock = std::lock_guard<std::mutex>(_mutex);
+			return std::move(_streamedStdOut);
+		}
+
+	private:
+		void SplitLines(std::string& pending, std::string_view value, bool isError)
+		{
+			auto hasLines = false;
+			size_t lineStart = 0;
+			for (auto lineEnd = value.find('\n'); lineEnd != std::string_view::npos; lineEnd = value.find('\n', lineStart))
+			{
+				pending.append(value.substr(lineStart, lineEnd - lineStart));
+				if (!pending.empty() && pending.back() == '\r')
+					pending.pop_back();
+
+				_pendingLines.push_back(PendingLine { isError, std::move(pending) });
+				pending.clear();
+				hasLines = true;
+				lineStart = lineEnd + 1;
+			}
+
+			pending.append(value.substr(lineStart));
+
+			if (hasLines)
+				_condition.notify_one();
+		}
+
+		static void LogLines(const std::vector<PendingLine>& lines)
+		{
+			for (auto& line : lines)
+			{
+				if (line.IsError)
+					Log::Error(line.Line);
+				else
+					Log::Info(line.Line);
+			}
+		}
+	};
+}
@@ -55,6 +55,31 @@ namespace Soup::Core
 		/// </summary>
 		bool ForceRebuild;
 
+		/// <summary>
+		/// Gets or sets a value indicating whether to use file content digests for up to date checks
+		/// </summary>
+		bool UseContentDigest;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to restore and store operation outputs in the local build cache
+		/// </summary>
+		bool UseBuildCache;
+
+		/// <summary>
+		/// Gets or sets the url of the remote build cache that is shared with other machines, empty when disabled
+		/// </summary>
+		std::string RemoteBuildCacheUrl;
+
+		/// <summary>
+		/// Gets or sets a value indicating whether to run the generate phase in persistent generate processes
+		/// </summary>
+		bool UseGenerateServer;
+
+		/// <summary>
+		/// Gets or sets the maximum number of operations to evaluate in parallel
+		/// </summary>
+		uint32_t MaxJobs = 1;
+
 		/// <summary>
 		/// Equality operator
 		/// </summary>
@@ -2,24 +2,88 @@
 
 namespace Soup::Core
 {
+	/// <summary>
+	/// Collects the files that are accessed by a monitored operation.
+	/// A compile reports the same system headers thousands of times, so every event is first looked up by its raw path
+	/// without any allocation. Only a path that has not been seen before is parsed and normalized, which keeps the
+	/// existing behavior for different spellings of the same file.
+	/// The monitor callbacks run on the monitor thread while the build state lock is released, so their messages are
+	/// held until the thread that owns the build state logs them once the process has exited. The monitor thread never
+	/// waits on the build state lock, which other packages may hold for a long time.
+	/// </summary>
 	class SystemAccessTracker : public Monitor::ISystemAccessMonitor
 	{
 	private:
+		enum class LogLevel
+		{
+			Diag,
+			Info,
+			Warning,
+		};
+
+		struct PendingLog
+		{
+			LogLevel Level;
+			std::string Message;
+		};
+
+		struct AccessedFile
+		{
+			Path File;
+			bool IsInput;
+			bool IsInputMissing;
+			bool IsOutput;
+			bool IsDeleteOnClose;
+		};
+
 		int _activeProcessCount;
-		std::set<std::string> _input;
-		std::set<std::string> _inputMissing;
-		std::set<std::string> _output;
-		std::set<std::string> _deleteOnClose;
+
+		// The messages from the monitor callbacks that have not been logged yet
+		std::vector<PendingLog> _pendingLogs;
+
+		// The unique normalized files in the order they were first accessed
+		std::vector<AccessedFile> _files;
+
+		// Lookup from a raw path as it was reported by the monitor to the normalized file
+		std::unordered_map<std::string, size_t, string_hash, std::equal_to<>> _rawLookup;
+
+		// Lookup from a normalized path to the file
+		std::unordered_map<std::string, size_t> _fileLookup;
 
 	public:
 		SystemAccessTracker() :
 			_activeProcessCount(0),
-			_input(),
-			_output(),
-			_deleteOnClose()
+			_pendingLogs(),
+			_files(),
+			_rawLookup(),
+			_fileLookup()
 		{
 		}
 
+		/// <summary>
+		/// Log the messages from the monitor callbacks, called by the thread that owns the build state
+		/// </summary>
+		void LogPendingMessages()
+		{
+			for (auto& pendingLog : _pendingLogs)
+			{
+				switch (pendingLog.Level)
+				{
+					case LogLevel::Diag:
+						Log::Diag(pendingLog.Message);
+						break;
+					case LogLevel::Info:
+						Log::Info(pendingLog.Message);
+						break;
+					case LogLevel::Warning:
+						Log::Warning(pendingLog.Message);
+						break;
+				}
+			}
+
+			_pendingLogs.clear();
+		}
+
 		void VerifyResult()
 		{
 			if (_activeProcessCount != 0)
@@ -28,112 +92,165 @@ namespace Soup::Core
 			}
 
 			// Cleanup on close delete files
-			for (auto& file : _deleteOnClose)
+			for (auto& file : _files)
 			{
-				auto extractOutputResult = _output.extract(file);
-				auto extractInputResult = _input.extract(file);
+				if (file.IsDeleteOnClose)
+				{
+					file.IsOutput = false;
+					file.IsInput = false;
+				}
 			}
 		}
 
-		std::set<std::string> GetInput()
+		/// <summary>
+		/// Get the unique file ids for all files that were read
+		/// </summary>
+		std::vector<FileId> GetInput(FileSystemState& fileSystemState, const Path& workingDirectory)
 		{
-			return _input;
+			auto result = std::vector<FileId>();
+			for (auto& file : _files)
+			{
+				if (file.IsInput)
+				{
+					#ifdef TRACE_FILE_SYSTEM_STATE
+						Log::Diag("ObservedInput: {}", file.File.ToString());
+					#endif
+					result.push_back(fileSystemState.ToFileId(file.File, workingDirectory));
+				}
+			}
+
+			return result;
 		}
 
-		std::set<std::string> GetOutput()
+		/// <summary>
+		/// Get the unique file ids for all files that were written
+		/// </summary>
+		std::vector<FileId> GetOutput(FileSystemState& fileSystemState, const Path& workingDirectory)
 		{
-			return _output;
+			auto result = std::vector<FileId>();
+			for (auto& file : _files)
+			{
+				if (file.IsOutput)
+				{
+					#ifdef TRACE_FILE_SYSTEM_STATE
+						Log::Diag("ObservedOutput: {}", file.File.ToString());
+					#endif
+					result.push_back(fileSystemState.ToFileId(file.File, workingDirectory));
+				}
+			}
+
+			return result;
 		}
 
 		virtual void OnCreateProcess(std::string_view applicationName, bool wasDetoured) override final
 		{
 			if (wasDetoured)
-				Log::Diag("SystemAccessTracker::OnCreateDetouredProcess - {}", applicationName);
+				AddLog(LogLevel::Diag, std::format("SystemAccessTracker::OnCreateDetouredProcess - {}", applicationName));
 			else
-				Log::Diag("SystemAccessTracker::OnCreateProcess - {}", applicationName);
+				AddLog(LogLevel::Diag, std::format("SystemAccessTracker::OnCreateProcess - {}", applicationName));
 		}
 
-		virtual void TouchFileRead(Path filePath, bool exists, bool wasBlocked) override final
+		virtual void TouchFileRead(std::string_view filePath, bool exists, bool wasBlocked) override final
 		{
 			if (wasBlocked)
 			{
 				// TODO: Warning
-				Log::Info("FileReadBlocked: {}", filePath.ToString());
+				AddLog(LogLevel::Info, std::format("FileReadBlocked: {}", filePath));
 			}
 			else
 			{
-				auto value = filePath.ToString();
-
 				#ifdef TRACE_SYSTEM_ACCESS
-				Log::Diag("TouchFileRead {}", value);
+				AddLog(LogLevel::Diag, std::format("TouchFileRead {}", filePath));
 				#endif
 
+				auto& file = GetFile(filePath);
 				if (exists)
 				{
-					_input.insert(std::move(value));
+					file.IsInput = true;
 				}
 				else
 				{
-					_inputMissing.insert(std::move(value));
+					file.IsInputMissing = true;
 				}
 			}
 		}
 
-		virtual void TouchFileWrite(Path filePath, bool wasBlocked) override final
+		virtual void TouchFileWrite(std::string_view filePath, bool wasBlocked) override final
 		{
 			if (wasBlocked)
 			{
 				// TODO: Warning
-				Log::Info("FileWriteBlocked: {}", filePath.ToString());
+				AddLog(LogLevel::Info, std::format("FileWriteBlocked: {}", filePath));
 			}
 			else
 			{
-				auto value = filePath.ToString();
-
 				#ifdef TRACE_SYSTEM_ACCESS
-				Log::Diag("TouchFileWrite {}", value);
+				AddLog(LogLevel::Diag, std::format("TouchFileWrite {}", filePath));
 				#endif
 
-				_output.insert(std::move(value));
+				GetFile(filePath).IsOutput = true;
 			}
 		}
 
-		virtual void TouchFileDelete(Path filePath, bool wasBlocked) override final
+		virtual void TouchFileDelete(std::string_view filePath, bool wasBlocked) override final
 		{
 			if (wasBlocked)
 			{
 				// TODO: Warning
-				Log::Info("FileDeleteBlocked: {}", filePath.ToString());
+				AddLog(LogLevel::Info, std::format("FileDeleteBlocked: {}", filePath));
 			}
 			else
 			{
-				auto value = filePath.ToString();
-
 				#ifdef TRACE_SYSTEM_ACCESS
-				Log::Diag("TouchFileDelete {}", value);
+				AddLog(LogLevel::Diag, std::format("TouchFileDelete {}", filePath));
 				#endif
 
 				// If this was an output file extract it as it was a transient file
 				// TODO: May want to track if we created the file
-				auto extractOutputResult = _output.extract(value);
-				auto extractInputResult = _input.extract(value);
+				auto& file = GetFile(filePath);
+				file.IsOutput = false;
+				file.IsInput = false;
 			}
 		}
 
-		virtual void TouchFileDeleteOnClose(Path filePath) override final
+		virtual void TouchFileDeleteOnClose(std::string_view filePath) override final
 		{
-			auto value = filePath.ToString();
-
 			#ifdef TRACE_SYSTEM_ACCESS
-			Log::Diag("TouchFileDeleteOnClose {}", value);
+			AddLog(LogLevel::Diag, std::format("TouchFileDeleteOnClose {}", filePath));
 			#endif
 
-			_deleteOnClose.insert(std::move(value));
+			GetFile(filePath).IsDeleteOnClose = true;
 		}
 
 		virtual void SearchPath(std::string_view path, std::string_view filename) override final
 		{
-			Log::Warning("Search Path encountered: {} - {}", path, filename);
+			AddLog(LogLevel::Warning, std::format("Search Path encountered: {} - {}", path, filename));
+		}
+
+	private:
+		void AddLog(LogLevel level, std::string message)
+		{
+			_pendingLogs.push_back(PendingLog { level, std::move(message) });
+		}
+
+		/// <summary>
+		/// Find the state for a file, the path is only parsed the first time a raw path is seen
+		/// </summary>
+		AccessedFile& GetFile(std::string_view filePath)
+		{
+			auto findRaw = _rawLookup.find(filePath);
+			if (findRaw != _rawLookup.end())
+				return _files[findRaw->second];
+
+			auto file = Path::Parse(filePath);
+			auto [findFile, isNew] = _fileLookup.emplace(file.ToString(), _files.size());
+			if (isNew)
+			{
+				_files.push_back(AccessedFile { std::move(file), false, false, false, false });
+			}
+
+			_rawLookup.emplace(filePath, findFile->second);
+			return _files[findFile->second];
 		}
 	};
 }
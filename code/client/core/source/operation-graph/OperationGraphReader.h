@@ -4,6 +4,7 @@
 
 #pragma once
 #include "OperationGraph.h"
+#include "OperationGraphView.h"
 
 namespace Soup::Core
 {
@@ -17,7 +18,10 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation Graph file format
-		static constexpr uint32_t FileVersion = 6;
+		static constexpr uint32_t FileVersion = OperationGraphView::FileVersion;
+
+		// The previous sequential file format that is still supported
+		static constexpr uint32_t SequentialFileVersion = 6;
 
 	public:
 		static OperationGraph Deserialize(std::istream& stream, FileSystemState& fileSystemState)
@@ -29,12 +33,29 @@ namespace Soup::Core
 
 			auto contentBuffer = std::vector<char>(size);
 			stream.read(contentBuffer.data(), size);
-			auto data = contentBuffer.data();
+
+			return Deserialize(contentBuffer.data(), contentBuffer.size(), fileSystemState);
+		}
+
+		/// <summary>
+		/// Deserialize the operation graph directly from the file content
+		/// </summary>
+		static OperationGraph Deserialize(char* data, size_t size, FileSystemState& fileSystemState)
+		{
+			// Peek at the version to select the format
+			uint32_t fileVersion = 0;
+			if (size >= 8)
+				memcpy(&fileVersion, data + 4, sizeof(uint32_t));
+
+			if (fileVersion == FileVersion)
+			{
+				return Deserialize(OperationGraphView(data, size), fileSystemState);
+			}
+
 			size_t offset = 0;
-			
 			auto result = Deserialize(data, size, offset, fileSystemState);
 
-			if (offset != contentBuffer.size())
+			if (offset != size)
 			{
 				throw std::runtime_error("Value Table file corrupted - Did not read the entire file");
 			}
@@ -43,6 +64,80 @@ namespace Soup::Core
 		}
 
 	private:
+		static OperationGraph Deserialize(const OperationGraphView& view, FileSystemState& fileSystemState)
+		{
+			// Map up the incoming file ids to the active file system state ids
+			// Note: Known files are found directly from the path string without parsing a new path
+			auto activeFileIdMap = std::unordered_map<FileId, FileId>();
+			activeFileIdMap.reserve(view.GetFileCount());
+			for (auto i = 0u; i < view.GetFileCount(); i++)
+			{
+				auto filePath = view.GetFilePath(i);
+				FileId activeFileId;
+				if (!fileSystemState.TryFindFileId(filePath, activeFileId))
+				{
+					activeFileId = fileSystemState.ToFileId(Path(filePath));
+				}
+
+				auto insertResult = activeFileIdMap.emplace(view.GetFileId(i), activeFileId);
+				if (!insertResult.second)
+					throw std::runtime_error("Failed to insert file id lookup");
+			}
+
+			// Parse each unique command directory and executable once
+			auto pathCache = std::unordered_map<std::string_view, Path>();
+			auto getPath = [&pathCache](std::string_view value) -> const Path&
+			{
+				auto findResult = pathCache.find(value);
+				if (findResult == pathCache.end())
+					findResult = pathCache.emplace(value, Path(value)).first;
+
+				return findResult->second;
+			};
+
+			auto operationCount = view.GetOperationCount();
+			auto operations = std::vector<OperationInfo>(operationCount);
+			for (auto i = 0u; i < operationCount; i++)
+			{
+				auto argumentValues = view.GetArguments(i);
+				auto arguments = std::vector<std::string>(argumentValues.begin(), argumentValues.end());
+
+				operations[i] = OperationInfo(
+					view.GetOperationId(i),
+					std::string(view.GetTitle(i)),
+					CommandInfo(
+						getPath(view.GetWorkingDirectory(i)),
+						getPath(view.GetExecutable(i)),
+						std::move(arguments)),
+					MapFileIds(view.GetDeclaredInput(i), activeFileIdMap),
+					MapFileIds(view.GetDeclaredOutput(i), activeFileIdMap),
+					MapFileIds(view.GetReadAccess(i), activeFileIdMap),
+					MapFileIds(view.GetWriteAccess(i), activeFileIdMap),
+					view.GetChildren(i),
+					view.GetDependencyCount(i));
+			}
+
+			return OperationGraph(
+				view.GetRootOperationIds(),
+				std::move(operations));
+		}
+
+		static std::vector<FileId> MapFileIds(
+			std::vector<FileId> fileIds, const std::unordered_map<FileId, FileId>& activeFileIdMap)
+		{
+			for (auto& fileId : fileIds)
+			{
+				// Find the active file id that maps to the cached file id
+				auto findActiveFileId = activeFileIdMap.find(fileId);
+				if (findActiveFileId == activeFileIdMap.end())
+					throw std::runtime_error("Could not find file id in active map");
+
+				fileId = findActiveFileId->second;
+			}
+
+			return fileIds;
+		}
+
 		static OperationGraph Deserialize(
 			char* data, size_t size, size_t& offset, FileSystemState& fileSystemState)
 		{
@@ -61,7 +156,7 @@ namespace Soup::Core
 			}
 
 			auto fileVersion = ReadUInt32(data, size, offset);
-			if (fileVersion != FileVersion)
+			if (fileVersion != SequentialFileVersion)
 			{
 				throw std::runtime_error("Operation graph file version does not match expected");
 			}
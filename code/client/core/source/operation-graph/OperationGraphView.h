@@ -0,0 +1,400 @@
+﻿// <copyright file="OperationGraphView.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "OperationGraph.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// A read only view over the binary operation graph table format that is queried in place.
+	/// The file is made up of a shared string table, a sorted file table, a shared pool of list values
+	/// and a fixed size record for each operation, all 4 byte aligned and addressed by offsets
+	/// so the content can be used directly from a mapped file without parsing it up front.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class OperationGraphView
+	{
+	public:
+		// Binary Operation Graph table file format
+		static constexpr uint32_t FileVersion = 7;
+
+		// The number of values in a single operation record
+		// Id, Title, WorkingDirectory, Executable, six lists as (offset, count) and the DependencyCount
+		static constexpr uint32_t OperationRecordValueCount = 17;
+
+	private:
+		enum class OperationField : uint32_t
+		{
+			Id = 0,
+			Title = 1,
+			WorkingDirectory = 2,
+			Executable = 3,
+			Arguments = 4,
+			DeclaredInput = 6,
+			DeclaredOutput = 8,
+			ReadAccess = 10,
+			WriteAccess = 12,
+			Children = 14,
+			DependencyCount = 16,
+		};
+
+		const char* _data;
+		size_t _size;
+
+		uint32_t _stringCount;
+		size_t _stringTableOffset;
+		size_t _stringDataOffset;
+		uint32_t _stringDataSize;
+
+		uint32_t _fileCount;
+		size_t _fileTableOffset;
+
+		uint32_t _valueCount;
+		size_t _valuesOffset;
+
+		uint32_t _rootOperationsOffset;
+		uint32_t _rootOperationsCount;
+
+		uint32_t _operationCount;
+		size_t _operationsOffset;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationGraphView"/> class.
+		/// Note: The view does not own the content which must outlive the view
+		/// </summary>
+		OperationGraphView(const char* data, size_t size) :
+			_data(data),
+			_size(size),
+			_stringCount(0),
+			_stringTableOffset(0),
+			_stringDataOffset(0),
+			_stringDataSize(0),
+			_fileCount(0),
+			_fileTableOffset(0),
+			_valueCount(0),
+			_valuesOffset(0),
+			_rootOperationsOffset(0),
+			_rootOperationsCount(0),
+			_operationCount(0),
+			_operationsOffset(0)
+		{
+			size_t offset = 0;
+			CheckHeader(offset, "BOG\0", "Invalid operation graph file header");
+
+			auto fileVersion = ReadUInt32(offset);
+			if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("Operation graph file version does not match expected");
+			}
+
+			// Locate the string table and the string data that follows it
+			CheckHeader(offset, "STR\0", "Invalid operation graph strings header");
+			_stringCount = ReadUInt32(offset);
+			_stringDataSize = ReadUInt32(offset);
+			_stringTableOffset = Skip(offset, static_cast<size_t>(_stringCount) * 2);
+			_stringDataOffset = offset;
+			offset += AlignSize(_stringDataSize);
+			if (offset > _size)
+				throw std::runtime_error("Tried to read past end of data");
+
+			// Locate the file table
+			CheckHeader(offset, "FIS\0", "Invalid operation graph files header");
+			_fileCount = ReadUInt32(offset);
+			_fileTableOffset = Skip(offset, static_cast<size_t>(_fileCount) * 2);
+
+			// Locate the shared list values
+			CheckHeader(offset, "LST\0", "Invalid operation graph list values header");
+			_valueCount = ReadUInt32(offset);
+			_valuesOffset = Skip(offset, _valueCount);
+
+			// Read the root operation ids list reference
+			CheckHeader(offset, "ROP\0", "Invalid operation graph root operations header");
+			_rootOperationsOffset = ReadUInt32(offset);
+			_rootOperationsCount = ReadUInt32(offset);
+			CheckListReference(_rootOperationsOffset, _rootOperationsCount);
+
+			// Locate the fixed size operation records
+			CheckHeader(offset, "OPS\0", "Invalid operation graph operations header");
+			_operationCount = ReadUInt32(offset);
+			_operationsOffset = Skip(offset, static_cast<size_t>(_operationCount) * OperationRecordValueCount);
+
+			if (offset != _size)
+			{
+				throw std::runtime_error("Operation graph file corrupted - Did not read the entire file");
+			}
+		}
+
+		/// <summary>
+		/// Get the root operation ids
+		/// </summary>
+		std::vector<OperationId> GetRootOperationIds() const
+		{
+			return ReadList(_rootOperationsOffset, _rootOperationsCount);
+		}
+
+		/// <summary>
+		/// Get the number of files referenced by the operations
+		/// </summary>
+		uint32_t GetFileCount() const
+		{
+			return _fileCount;
+		}
+
+		/// <summary>
+		/// Get the file id that was used for the file at the provided index in the table
+		/// </summary>
+		FileId GetFileId(uint32_t fileIndex) const
+		{
+			return ReadUInt32At(_fileTableOffset, GetFileTableValueIndex(fileIndex));
+		}
+
+		/// <summary>
+		/// Get the path for the file at the provided index in the table
+		/// </summary>
+		std::string_view GetFilePath(uint32_t fileIndex) const
+		{
+			return GetString(ReadUInt32At(_fileTableOffset, GetFileTableValueIndex(fileIndex) + 1));
+		}
+
+		/// <summary>
+		/// Find the index in the file table for a file id, the table is sorted by id
+		/// </summary>
+		bool TryFindFileIndex(FileId fileId, uint32_t& fileIndex) const
+		{
+			uint32_t low = 0;
+			uint32_t high = _fileCount;
+			while (low < high)
+			{
+				auto middle = low + (high - low) / 2;
+				auto middleFileId = GetFileId(middle);
+				if (middleFileId < fileId)
+				{
+					low = middle + 1;
+				}
+				else if (middleFileId > fileId)
+				{
+					high = middle;
+				}
+				else
+				{
+					fileIndex = middle;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Get the number of operations
+		/// </summary>
+		uint32_t GetOperationCount() const
+		{
+			return _operationCount;
+		}
+
+		/// <summary>
+		/// Find the index of the record for an operation id, the records are sorted by id
+		/// </summary>
+		bool TryFindOperationIndex(OperationId operationId, uint32_t& operationIndex) const
+		{
+			uint32_t low = 0;
+			uint32_t high = _operationCount;
+			while (low < high)
+			{
+				auto middle = low + (high - low) / 2;
+				auto middleOperationId = GetOperationId(middle);
+				if (middleOperationId < operationId)
+				{
+					low = middle + 1;
+				}
+				else if (middleOperationId > operationId)
+				{
+					high = middle;
+				}
+				else
+				{
+					operationIndex = middle;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		OperationId GetOperationId(uint32_t operationIndex) const
+		{
+			return ReadOperationValue(operationIndex, OperationField::Id);
+		}
+
+		std::string_view GetTitle(uint32_t operationIndex) const
+		{
+			return GetString(ReadOperationValue(operationIndex, OperationField::Title));
+		}
+
+		std::string_view GetWorkingDirectory(uint32_t operationIndex) const
+		{
+			return GetString(ReadOperationValue(operationIndex, OperationField::WorkingDirectory));
+		}
+
+		std::string_view GetExecutable(uint32_t operationIndex) const
+		{
+			return GetString(ReadOperationValue(operationIndex, OperationField::Executable));
+		}
+
+		std::vector<std::string_view> GetArguments(uint32_t operationIndex) const
+		{
+			auto stringIndexes = ReadOperationList(operationIndex, OperationField::Arguments);
+			auto result = std::vector<std::string_view>(stringIndexes.size());
+			for (auto i = 0u; i < stringIndexes.size(); i++)
+			{
+				result[i] = GetString(stringIndexes[i]);
+			}
+
+			return result;
+		}
+
+		std::vector<FileId> GetDeclaredInput(uint32_t operationIndex) const
+		{
+			return ReadOperationList(operationIndex, OperationField::DeclaredInput);
+		}
+
+		std::vector<FileId> GetDeclaredOutput(uint32_t operationIndex) const
+		{
+			return ReadOperationList(operationIndex, OperationField::DeclaredOutput);
+		}
+
+		std::vector<FileId> GetReadAccess(uint32_t operationIndex) const
+		{
+			return ReadOperationList(operationIndex, OperationField::ReadAccess);
+		}
+
+		std::vector<FileId> GetWriteAccess(uint32_t operationIndex) const
+		{
+			return ReadOperationList(operationIndex, OperationField::WriteAccess);
+		}
+
+		std::vector<OperationId> GetChildren(uint32_t operationIndex) const
+		{
+			return ReadOperationList(operationIndex, OperationField::Children);
+		}
+
+		uint32_t GetDependencyCount(uint32_t operationIndex) const
+		{
+			return ReadOperationValue(operationIndex, OperationField::DependencyCount);
+		}
+
+	private:
+		std::string_view GetString(uint32_t stringIndex) const
+		{
+			if (stringIndex >= _stringCount)
+				throw std::runtime_error("Operation graph string index out of range");
+
+			auto stringOffset = ReadUInt32At(_stringTableOffset, static_cast<size_t>(stringIndex) * 2);
+			auto stringLength = ReadUInt32At(_stringTableOffset, static_cast<size_t>(stringIndex) * 2 + 1);
+			if (static_cast<size_t>(stringOffset) + stringLength > _stringDataSize)
+				throw std::runtime_error("Operation graph string out of range");
+
+			return std::string_view(_data + _stringDataOffset + stringOffset, stringLength);
+		}
+
+		size_t GetFileTableValueIndex(uint32_t fileIndex) const
+		{
+			if (fileIndex >= _fileCount)
+				throw std::runtime_error("Operation graph file index out of range");
+
+			return static_cast<size_t>(fileIndex) * 2;
+		}
+
+		uint32_t ReadOperationValue(uint32_t operationIndex, OperationField field) const
+		{
+			if (operationIndex >= _operationCount)
+				throw std::runtime_error("Operation graph operation index out of range");
+
+			auto valueIndex = static_cast<size_t>(operationIndex) * OperationRecordValueCount + static_cast<size_t>(field);
+			return ReadUInt32At(_operationsOffset, valueIndex);
+		}
+
+		std::vector<uint32_t> ReadOperationList(uint32_t operationIndex, OperationField field) const
+		{
+			auto listOffset = ReadOperationValue(operationIndex, field);
+			auto listCount = ReadUInt32At(
+				_operationsOffset,
+				static_cast<size_t>(operationIndex) * OperationRecordValueCount + static_cast<size_t>(field) + 1);
+			CheckListReference(listOffset, listCount);
+
+			return ReadList(listOffset, listCount);
+		}
+
+		std::vector<uint32_t> ReadList(uint32_t listOffset, uint32_t listCount) const
+		{
+			auto result = std::vector<uint32_t>(listCount);
+			if (listCount > 0)
+			{
+				memcpy(result.data(), _data + _valuesOffset + static_cast<size_t>(listOffset) * sizeof(uint32_t), listCount * sizeof(uint32_t));
+			}
+
+			return result;
+		}
+
+		void CheckListReference(uint32_t listOffset, uint32_t listCount) const
+		{
+			if (static_cast<size_t>(listOffset) + listCount > _valueCount)
+				throw std::runtime_error("Operation graph list out of range");
+		}
+
+		void CheckHeader(size_t& offset, const char* expected, const char* message) const
+		{
+			if (offset + 4 > _size || memcmp(_data + offset, expected, 4) != 0)
+			{
+				throw std::runtime_error(message);
+			}
+
+			offset += 4;
+		}
+
+		uint32_t ReadUInt32(size_t& offset) const
+		{
+			if (offset + sizeof(uint32_t) > _size)
+				throw std::runtime_error("Tried to read past end of data");
+
+			uint32_t result = 0;
+			memcpy(&result, _data + offset, sizeof(uint32_t));
+			offset += sizeof(uint32_t);
+
+			return result;
+		}
+
+		uint32_t ReadUInt32At(size_t sectionOffset, size_t valueIndex) const
+		{
+			uint32_t result = 0;
+			memcpy(&result, _data + sectionOffset + valueIndex * sizeof(uint32_t), sizeof(uint32_t));
+
+			return result;
+		}
+
+		/// <summary>
+		/// Skip over a section of 32 bit values and return the offset of the start of the section
+		/// </summary>
+		size_t Skip(size_t& offset, size_t valueCount) const
+		{
+			auto sectionOffset = offset;
+			auto sectionSize = valueCount * sizeof(uint32_t);
+			if (sectionSize > _size - offset)
+				throw std::runtime_error("Tried to read past end of data");
+
+			offset += sectionSize;
+			return sectionOffset;
+		}
+
+		static size_t AlignSize(size_t size)
+		{
+			return (size + 3) & ~static_cast<size_t>(3);
+		}
+	};
+}
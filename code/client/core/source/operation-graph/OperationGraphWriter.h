@@ -3,6 +3,7 @@
 // </copyright>
 
 #pragma once
+#include "OperationGraphView.h"
 
 namespace Soup::Core
 {
@@ -13,7 +14,19 @@ namespace Soup::Core
 	{
 	private:
 		// Binary Operation graph file format
-		static constexpr uint32_t FileVersion = 6;
+		static constexpr uint32_t FileVersion = OperationGraphView::FileVersion;
+
+		/// <summary>
+		/// The shared tables that are built up before writing the file
+		/// Note: The string values reference the graph and file system state that outlive the writer
+		/// </summary>
+		struct GraphTables
+		{
+			std::vector<std::string_view> Strings;
+			std::unordered_map<std::string_view, uint32_t> StringLookup;
+			std::vector<uint32_t> Values;
+			std::vector<uint32_t> Operations;
+		};
 
 	public:
 		static void Serialize(
@@ -22,109 +35,142 @@ namespace Soup::Core
 			const FileSystemState& fileSystemState,
 			std::ostream& stream)
 		{
-			// Write the File Header with version
-			stream.write("BOG\0", 4);
-			WriteValue(stream, FileVersion);
+			auto tables = GraphTables();
 
-			// Write out the set of files
-			stream.write("FIS\0", 4);
-			WriteValue(stream, static_cast<uint32_t>(files.size()));
+			// Add the file paths to the string table in id order
+			auto fileTable = std::vector<uint32_t>();
+			fileTable.reserve(files.size() * 2);
 			for (auto fileId : files)
 			{
-				// Write the file id + path length + path
-				WriteValue(stream, fileId);
-				WriteValue(stream, fileSystemState.GetFilePath(fileId).ToString());
+				fileTable.push_back(fileId);
+				fileTable.push_back(AddString(tables, fileSystemState.GetFilePath(fileId).ToString()));
 			}
 
-			// Write out the root operation ids
-			stream.write("ROP\0", 4);
-			WriteValues(stream, state.GetRootOperationIds());
+			// Add the root operation ids to the shared list values
+			auto rootOperations = AddValues(tables, state.GetRootOperationIds());
 
-			// Write out the set of operations
+			// Build the fixed size operation records in id order
 			auto& operations = state.GetOperations();
-			stream.write("OPS\0", 4);
-			WriteValue(stream, static_cast<uint32_t>(operations.size()));
-			for (auto& operationValue : state.GetOperations())
+			tables.Operations.reserve(operations.size() * OperationGraphView::OperationRecordValueCount);
+			for (auto& operationValue : operations)
 			{
-				WriteOperationInfo(stream, operationValue.second);
+				AddOperationInfo(tables, operationValue.second);
 			}
-		}
-
-	private:
-		static void WriteOperationInfo(std::ostream& stream, const OperationInfo& operation)
-		{
-			// Write out the operation id
-			WriteValue(stream, operation.Id);
-
-			// Write out the operation title
-			WriteValue(stream, operation.Title);
 
-			// Write the command working directory
-			WriteValue(stream, operation.Command.WorkingDirectory.ToString());
+			// Write the File Header with version
+			stream.write("BOG\0", 4);
+			WriteValue(stream, FileVersion);
 
-			// Write the command executable
-			WriteValue(stream, operation.Command.Executable.ToString());
+			// Write out the string table followed by the string data padded to keep the file aligned
+			uint32_t stringDataSize = 0;
+			for (auto& value : tables.Strings)
+			{
+				stringDataSize += static_cast<uint32_t>(value.size());
+			}
 
-			// Write the command arguments
-			WriteValues(stream, operation.Command.Arguments);
+			stream.write("STR\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(tables.Strings.size()));
+			WriteValue(stream, stringDataSize);
+			uint32_t stringOffset = 0;
+			for (auto& value : tables.Strings)
+			{
+				WriteValue(stream, stringOffset);
+				WriteValue(stream, static_cast<uint32_t>(value.size()));
+				stringOffset += static_cast<uint32_t>(value.size());
+			}
 
-			// Write out the declared input files
-			WriteValues(stream, operation.DeclaredInput);
+			for (auto& value : tables.Strings)
+			{
+				stream.write(value.data(), value.size());
+			}
 
-			// Write out the declared output files
-			WriteValues(stream, operation.DeclaredOutput);
+			auto padding = (4 - (stringDataSize % 4)) % 4;
+			stream.write("\0\0\0", padding);
 
-			// Write out the read access list
-			WriteValues(stream, operation.ReadAccess);
+			// Write out the set of files
+			stream.write("FIS\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(files.size()));
+			WriteRawValues(stream, fileTable);
 
-			// Write out the write access list
-			WriteValues(stream, operation.WriteAccess);
+			// Write out the shared list values
+			stream.write("LST\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(tables.Values.size()));
+			WriteRawValues(stream, tables.Values);
 
-			// Write out the child operation ids
-			WriteValues(stream, operation.Children);
+			// Write out the root operation ids
+			stream.write("ROP\0", 4);
+			WriteValue(stream, rootOperations.first);
+			WriteValue(stream, rootOperations.second);
 
-			// Write out the dependency count
-			WriteValue(stream, operation.DependencyCount);
+			// Write out the set of operations
+			stream.write("OPS\0", 4);
+			WriteValue(stream, static_cast<uint32_t>(operations.size()));
+			WriteRawValues(stream, tables.Operations);
 		}
 
-		static void WriteValue(std::ostream& stream, uint32_t value)
+	private:
+		static void AddOperationInfo(GraphTables& tables, const OperationInfo& operation)
 		{
-			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
-		}
+			// Add the command arguments as a list of string indexes
+			auto argumentIndexes = std::vector<uint32_t>();
+			argumentIndexes.reserve(operation.Command.Arguments.size());
+			for (auto& argument : operation.Command.Arguments)
+			{
+				argumentIndexes.push_back(AddString(tables, argument));
+			}
 
-		static void WriteValue(std::ostream& stream, int64_t value)
-		{
-			stream.write(reinterpret_cast<char*>(&value), sizeof(int64_t));
+			auto title = AddString(tables, operation.Title);
+			auto workingDirectory = AddString(tables, operation.Command.WorkingDirectory.ToString());
+			auto executable = AddString(tables, operation.Command.Executable.ToString());
+			auto arguments = AddValues(tables, argumentIndexes);
+			auto declaredInput = AddValues(tables, operation.DeclaredInput);
+			auto declaredOutput = AddValues(tables, operation.DeclaredOutput);
+			auto readAccess = AddValues(tables, operation.ReadAccess);
+			auto writeAccess = AddValues(tables, operation.WriteAccess);
+			auto children = AddValues(tables, operation.Children);
+
+			// Write the fixed size record in the same order as the view fields
+			tables.Operations.insert(
+				tables.Operations.end(),
+				{
+					operation.Id,
+					title,
+					workingDirectory,
+					executable,
+					arguments.first, arguments.second,
+					declaredInput.first, declaredInput.second,
+					declaredOutput.first, declaredOutput.second,
+					readAccess.first, readAccess.second,
+					writeAccess.first, writeAccess.second,
+					children.first, children.second,
+					operation.DependencyCount,
+				});
 		}
 
-		static void WriteValue(std::ostream& stream, bool value)
+		static uint32_t AddString(GraphTables& tables, std::string_view value)
 		{
-			uint32_t integerValue = value ? 1u : 0u;
-			stream.write(reinterpret_cast<char*>(&integerValue), sizeof(uint32_t));
+			auto insertResult = tables.StringLookup.emplace(value, static_cast<uint32_t>(tables.Strings.size()));
+			if (insertResult.second)
+				tables.Strings.push_back(value);
+
+			return insertResult.first->second;
 		}
 
-		static void WriteValue(std::ostream& stream, std::string_view value)
+		static std::pair<uint32_t, uint32_t> AddValues(GraphTables& tables, const std::vector<uint32_t>& values)
 		{
-			WriteValue(stream, static_cast<uint32_t>(value.size()));
-			stream.write(value.data(), value.size());
+			auto offset = static_cast<uint32_t>(tables.Values.size());
+			tables.Values.insert(tables.Values.end(), values.begin(), values.end());
+			return { offset, static_cast<uint32_t>(values.size()) };
 		}
 
-		static void WriteValues(std::ostream& stream, const std::vector<std::string>& values)
+		static void WriteRawValues(std::ostream& stream, const std::vector<uint32_t>& values)
 		{
-			WriteValue(stream, static_cast<uint32_t>(values.size()));
-			for (auto& value : values)
-			{
-				WriteValue(stream, value);
-			}
+			stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(uint32_t));
 		}
 
-		static void WriteValues(std::ostream& stream, const std::vector<uint32_t>& values)
+		static void WriteValue(std::ostream& stream, uint32_t value)
 		{
-			WriteValue(stream, static_cast<uint32_t>(values.size()));
-			for (auto& value : values)
-			{
-				WriteValue(stream, value);
-			}
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
 		}
 	};
 }
@@ -23,12 +23,18 @@ namespace Soup::Core
 		std::vector<FileId> ObservedInput;
 		std::vector<FileId> ObservedOutput;
 
+		// The optional content digests for each observed file, empty when content digests are disabled
+		std::vector<std::string> ObservedInputDigests;
+		std::vector<std::string> ObservedOutputDigests;
+
 	public:
 		OperationResult() :
 			WasSuccessfulRun(false),
 			EvaluateTime(std::chrono::time_point<std::chrono::file_clock>::min()),
 			ObservedInput(),
-			ObservedOutput()
+			ObservedOutput(),
+			ObservedInputDigests(),
+			ObservedOutputDigests()
 		{
 		}
 
@@ -40,7 +46,25 @@ namespace Soup::Core
 			WasSuccessfulRun(wasSuccessfulRun),
 			EvaluateTime(evaluateTime),
 			ObservedInput(std::move(observedInput)),
-			ObservedOutput(std::move(observedOutput))
+			ObservedOutput(std::move(observedOutput)),
+			ObservedInputDigests(),
+			ObservedOutputDigests()
+		{
+		}
+
+		OperationResult(
+			bool wasSuccessfulRun,
+			std::chrono::time_point<std::chrono::file_clock> evaluateTime,
+			std::vector<FileId> observedInput,
+			std::vector<FileId> observedOutput,
+			std::vector<std::string> observedInputDigests,
+			std::vector<std::string> observedOutputDigests) :
+			WasSuccessfulRun(wasSuccessfulRun),
+			EvaluateTime(evaluateTime),
+			ObservedInput(std::move(observedInput)),
+			ObservedOutput(std::move(observedOutput)),
+			ObservedInputDigests(std::move(observedInputDigests)),
+			ObservedOutputDigests(std::move(observedOutputDigests))
 		{
 		}
 
@@ -49,7 +73,9 @@ namespace Soup::Core
 			return WasSuccessfulRun == rhs.WasSuccessfulRun &&
 				EvaluateTime == rhs.EvaluateTime &&
 				ObservedInput == rhs.ObservedInput &&
-				ObservedOutput == rhs.ObservedOutput;
+				ObservedOutput == rhs.ObservedOutput &&
+				ObservedInputDigests == rhs.ObservedInputDigests &&
+				ObservedOutputDigests == rhs.ObservedOutputDigests;
 		}
 	};
 }
\ No newline at end of file
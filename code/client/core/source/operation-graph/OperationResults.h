@@ -20,12 +20,51 @@ namespace Soup::Core
 	private:
 		std::map<OperationId, OperationResult> _results;
 
+		// The optional listener that is notified as each result is added or updated
+		std::function<void(OperationId, const OperationResult&)> _resultUpdated;
+
 	public:
+		/// <summary>
+		/// Set the result updated listener for the lifetime of this object, so a listener that references local state
+		/// is removed on every exit path
+		/// </summary>
+		class ScopedResultUpdatedCallback
+		{
+		private:
+			OperationResults& _results;
+
+		public:
+			ScopedResultUpdatedCallback(
+				OperationResults& results,
+				std::function<void(OperationId, const OperationResult&)> callback) :
+				_results(results)
+			{
+				_results.SetResultUpdatedCallback(std::move(callback));
+			}
+
+			ScopedResultUpdatedCallback(const ScopedResultUpdatedCallback&) = delete;
+			ScopedResultUpdatedCallback& operator=(const ScopedResultUpdatedCallback&) = delete;
+
+			~ScopedResultUpdatedCallback()
+			{
+				Reset();
+			}
+
+			/// <summary>
+			/// Remove the listener early
+			/// </summary>
+			void Reset()
+			{
+				_results.SetResultUpdatedCallback(nullptr);
+			}
+		};
+
 		/// <summary>
 		/// Initializes a new instance of the <see cref="OperationResults"/> class.
 		/// </summary>
 		OperationResults() :
-			_results()
+			_results(),
+			_resultUpdated()
 		{
 		}
 
@@ -34,8 +73,17 @@ namespace Soup::Core
 		/// </summary>
 		OperationResults(
 			std::map<OperationId, OperationResult> results) :
-			_results(std::move(results))
+			_results(std::move(results)),
+			_resultUpdated()
+		{
+		}
+
+		/// <summary>
+		/// Set the listener that is notified as each result is added or updated
+		/// </summary>
+		void SetResultUpdatedCallback(std::function<void(OperationId, const OperationResult&)> callback)
 		{
+			_resultUpdated = std::move(callback);
 		}
 
 		/// <summary>
@@ -75,6 +123,9 @@ namespace Soup::Core
 		OperationResult& AddOrUpdateOperationResult(OperationId operationId, OperationResult result)
 		{
 			auto [insertIterator, wasInserted] = _results.insert_or_assign(operationId, std::move(result));
+			if (_resultUpdated)
+				_resultUpdated(operationId, insertIterator->second);
+
 			return insertIterator->second;
 		}
 
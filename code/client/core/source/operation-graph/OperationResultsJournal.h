@@ -0,0 +1,235 @@
+﻿// <copyright file="OperationResultsJournal.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "OperationResultsReader.h"
+#include "OperationResultsWriter.h"
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The append only journal of operation results that are completed after the results file was last saved.
+	/// Each result is written and flushed as soon as it is known so a build that is killed part way through
+	/// does not lose the work that already finished. The journal is cleared when the results are compacted
+	/// back into the results file.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class OperationResultsJournal
+	{
+	private:
+		// Binary Operation Results Journal file format
+		static constexpr uint32_t FileVersion = 1;
+
+		// The record types, each record is written as the type, payload size and payload
+		static constexpr uint32_t FileRecordType = 1;
+		static constexpr uint32_t ResultRecordType = 2;
+
+		Path _journalFile;
+		const FileSystemState& _fileSystemState;
+		std::shared_ptr<System::IOutputFile> _file;
+		std::set<FileId> _writtenFiles;
+		bool _hasRecords;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="OperationResultsJournal"/> class.
+		/// </summary>
+		OperationResultsJournal(
+			Path journalFile,
+			const FileSystemState& fileSystemState,
+			bool hasExistingRecords) :
+			_journalFile(std::move(journalFile)),
+			_fileSystemState(fileSystemState),
+			_file(),
+			_writtenFiles(),
+			_hasRecords(hasExistingRecords)
+		{
+		}
+
+		/// <summary>
+		/// Append a single operation result along with any files it references that are new to the journal
+		/// </summary>
+		void Append(OperationId operationId, const OperationResult& result)
+		{
+			if (_file == nullptr)
+				Open();
+
+			auto& stream = _file->GetOutStream();
+			AppendFiles(stream, result.ObservedInput);
+			AppendFiles(stream, result.ObservedOutput);
+
+			auto payload = std::stringstream();
+			OperationResultsWriter::WriteOperationResult(payload, operationId, result);
+			WriteRecord(stream, ResultRecordType, payload.str());
+
+			// Ensure the record reaches the file before the next operation runs
+			stream.flush();
+			_hasRecords = true;
+		}
+
+		/// <summary>
+		/// Clear the journal after the results have been saved to the results file
+		/// </summary>
+		void Clear()
+		{
+			if (_hasRecords)
+			{
+				Open();
+				_file->GetOutStream().flush();
+				_hasRecords = false;
+			}
+		}
+
+		/// <summary>
+		/// Replay the results recorded in the journal on top of the loaded results
+		/// Note: A partial record at the end of the journal from an interrupted write is ignored, the journal is then
+		/// reported as corrupted so that it is reset once the recovered results are saved
+		/// </summary>
+		static uint32_t Replay(
+			const Path& journalFile,
+			OperationResults& results,
+			FileSystemState& fileSystemState,
+			bool& isCorrupted)
+		{
+			isCorrupted = false;
+			std::shared_ptr<System::IInputFile> file;
+			if (!System::IFileSystem::Current().TryOpenRead(journalFile, true, file))
+			{
+				return 0;
+			}
+
+			// Read the entire file for fastest read operation
+			auto& stream = file->GetInStream();
+			stream.seekg(0, std::ios_base::end);
+			auto size = static_cast<size_t>(stream.tellg());
+			stream.seekg(0, std::ios_base::beg);
+
+			auto contentBuffer = std::vector<char>(size);
+			stream.read(contentBuffer.data(), size);
+
+			// Keep any results that were read before a corrupted record
+			uint32_t resultCount = 0;
+			try
+			{
+				isCorrupted = !ReplayRecords(contentBuffer.data(), size, results, resultCount, fileSystemState);
+			}
+			catch(std::runtime_error& ex)
+			{
+				Log::Error(ex.what());
+				isCorrupted = true;
+			}
+			catch(...)
+			{
+				Log::Error("Failed to parse operation results journal");
+				isCorrupted = true;
+			}
+
+			return resultCount;
+		}
+
+	private:
+		/// <summary>
+		/// Replay the records, returns false if the journal ends with a partial record
+		/// </summary>
+		static bool ReplayRecords(
+			char* data,
+			size_t size,
+			OperationResults& results,
+			uint32_t& resultCount,
+			FileSystemState& fileSystemState)
+		{
+			if (size < 8 || memcmp(data, "BRJ\0", 4) != 0)
+			{
+				throw std::runtime_error("Invalid operation results journal file header");
+			}
+
+			size_t offset = 4;
+			auto fileVersion = OperationResultsReader::ReadUInt32(data, size, offset);
+			if (fileVersion != FileVersion)
+			{
+				throw std::runtime_error("Operation results journal file version does not match expected");
+			}
+
+			auto activeFileIdMap = std::unordered_map<FileId, FileId>();
+			while (size - offset >= 8)
+			{
+				auto recordType = OperationResultsReader::ReadUInt32(data, size, offset);
+				auto recordSize = OperationResultsReader::ReadUInt32(data, size, offset);
+				if (recordSize > size - offset)
+					return false;
+
+				auto recordEnd = offset + recordSize;
+				switch (recordType)
+				{
+					case FileRecordType:
+					{
+						auto fileId = OperationResultsReader::ReadUInt32(data, recordEnd, offset);
+						auto fileString = OperationResultsReader::ReadString(data, recordEnd, offset);
+						activeFileIdMap.insert_or_assign(fileId, fileSystemState.ToFileId(Path(std::move(fileString))));
+						break;
+					}
+					case ResultRecordType:
+					{
+						OperationResultsReader::ReadOperationResult(data, recordEnd, offset, activeFileIdMap, true, results);
+						resultCount++;
+						break;
+					}
+					default:
+					{
+						throw std::runtime_error("Unknown operation results journal record type");
+					}
+				}
+
+				if (offset != recordEnd)
+					throw std::runtime_error("Operation results journal record corrupted");
+			}
+
+			return offset == size;
+		}
+
+		void Open()
+		{
+			// Release any previous handle before the file is truncated
+			_file = nullptr;
+			_file = System::IFileSystem::Current().OpenWrite(_journalFile, true);
+			_writtenFiles.clear();
+
+			// Write the File Header with version
+			auto& stream = _file->GetOutStream();
+			stream.write("BRJ\0", 4);
+			WriteValue(stream, FileVersion);
+		}
+
+		void AppendFiles(std::ostream& stream, const std::vector<FileId>& files)
+		{
+			for (auto fileId : files)
+			{
+				if (_writtenFiles.insert(fileId).second)
+				{
+					// Write the file id + path length + path
+					auto payload = std::stringstream();
+					WriteValue(payload, fileId);
+					auto& path = _fileSystemState.GetFilePath(fileId).ToString();
+					WriteValue(payload, static_cast<uint32_t>(path.size()));
+					payload.write(path.data(), path.size());
+					WriteRecord(stream, FileRecordType, payload.str());
+				}
+			}
+		}
+
+		static void WriteRecord(std::ostream& stream, uint32_t recordType, std::string_view payload)
+		{
+			WriteValue(stream, recordType);
+			WriteValue(stream, static_cast<uint32_t>(payload.size()));
+			stream.write(payload.data(), payload.size());
+		}
+
+		static void WriteValue(std::ostream& stream, uint32_t value)
+		{
+			stream.write(reinterpret_cast<char*>(&value), sizeof(uint32_t));
+		}
+	};
+}
@@ -15,9 +15,14 @@ namespace Soup::Core
 	#endif
 	class OperationResultsReader
 	{
+		friend class OperationResultsJournal;
+
 	private:
 		// Binary Operation Results file format
-		static constexpr uint32_t FileVersion = 2;
+		static constexpr uint32_t FileVersion = 3;
+
+		// The previous file format without content digests that can still be read
+		static constexpr uint32_t NoDigestFileVersion = 2;
 
 		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
 		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
@@ -66,7 +71,7 @@ namespace Soup::Core
 			}
 
 			auto fileVersion = ReadUInt32(data, size, offset);
-			if (fileVersion != FileVersion)
+			if (fileVersion != FileVersion && fileVersion != NoDigestFileVersion)
 			{
 				throw std::runtime_error("Operation results file version does not match expected");
 			}
@@ -110,9 +115,10 @@ namespace Soup::Core
 
 			auto resultCount = ReadUInt32(data, size, offset);
 			auto results = OperationResults();
+			bool hasDigests = fileVersion >= FileVersion;
 			for (auto i = 0u; i < resultCount; i++)
 			{
-				ReadOperationResult(data, size, offset, activeFileIdMap, results);
+				ReadOperationResult(data, size, offset, activeFileIdMap, hasDigests, results);
 			}
 
 			return results;
@@ -123,6 +129,7 @@ namespace Soup::Core
 			size_t size,
 			size_t& offset,
 			const std::unordered_map<FileId, FileId>& activeFileIdMap,
+			bool hasDigests,
 			OperationResults& results)
 		{
 			// Read the operation id
@@ -149,11 +156,22 @@ namespace Soup::Core
 			// Read the observed output files
 			auto observedOutput = ReadFileIdList(data, size, offset, activeFileIdMap);
 
+			// Read the optional content digests
+			auto observedInputDigests = std::vector<std::string>();
+			auto observedOutputDigests = std::vector<std::string>();
+			if (hasDigests)
+			{
+				observedInputDigests = ReadStringList(data, size, offset);
+				observedOutputDigests = ReadStringList(data, size, offset);
+			}
+
 			auto result = OperationResult(
 				wasSuccessfulRun,
 				evaluateTimeFile,
 				std::move(observedInput),
-				std::move(observedOutput));
+				std::move(observedOutput),
+				std::move(observedInputDigests),
+				std::move(observedOutputDigests));
 
 			results.AddOrUpdateOperationResult(operationId, std::move(result));
 		}
@@ -191,6 +209,18 @@ namespace Soup::Core
 			return result;
 		}
 
+		static std::vector<std::string> ReadStringList(char* data, size_t size, size_t& offset)
+		{
+			auto listLength = ReadUInt32(data, size, offset);
+			auto result = std::vector<std::string>(listLength);
+			for (auto i = 0u; i < listLength; i++)
+			{
+				result[i] = ReadString(data, size, offset);
+			}
+
+			return result;
+		}
+
 		static std::vector<FileId> ReadFileIdList(
 			char* data, size_t size, size_t& offset, const std::unordered_map<FileId, FileId>& activeFileIdMap)
 		{
@@ -15,9 +15,11 @@ namespace Soup::Core
 	#endif
 	class OperationResultsWriter
 	{
+		friend class OperationResultsJournal;
+
 	private:
 		// Binary Operation results file format
-		static constexpr uint32_t FileVersion = 2;
+		static constexpr uint32_t FileVersion = 3;
 
 		// The time duration that represents how we store the values in the file using 64 bit integer with resolution of 100 nanoseconds
 		// Note: Unix Time, time since 00:00:00 Coordinated Universal Time (UTC), Thursday, 1 January 1970, not counting leap seconds
@@ -81,6 +83,10 @@ namespace Soup::Core
 
 			// Write out the observed output files
 			WriteValues(stream, result.ObservedOutput);
+
+			// Write out the optional content digests
+			WriteValues(stream, result.ObservedInputDigests);
+			WriteValues(stream, result.ObservedOutputDigests);
 		}
 
 		static void WriteValue(std::ostream& stream, uint32_t value)
@@ -113,5 +119,14 @@ namespace Soup::Core
 				WriteValue(stream, value);
 			}
 		}
+
+		static void WriteValues(std::ostream& stream, const std::vector<std::string>& values)
+		{
+			WriteValue(stream, static_cast<uint32_t>(values.size()));
+			for (auto& value : values)
+			{
+				WriteValue(stream, value);
+			}
+		}
 	};
 }
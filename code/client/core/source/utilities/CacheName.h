@@ -0,0 +1,46 @@
+﻿// <copyright file="CacheName.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// Converts content digests into names that are safe to use as a single file name or url path segment
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class CacheName
+	{
+	public:
+		/// <summary>
+		/// Convert a standard base64 digest to the unpadded base64url alphabet, which never contains a path separator
+		/// </summary>
+		static std::string FromDigest(std::string_view digest)
+		{
+			auto result = std::string();
+			result.reserve(digest.size());
+			for (auto value : digest)
+			{
+				switch (value)
+				{
+					case '+':
+						result.push_back('-');
+						break;
+					case '/':
+						result.push_back('_');
+						break;
+					case '=':
+						break;
+					default:
+						result.push_back(value);
+						break;
+				}
+			}
+
+			return result;
+		}
+	};
+}
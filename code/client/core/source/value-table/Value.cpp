@@ -25,12 +25,12 @@ namespace Soup::Core
 {
 
 Value::Value(ValueTable table) :
-	_value(std::move(table))
+	_value(std::make_shared<ValueTable>(std::move(table)))
 {
 }
 
 Value::Value(ValueList list) :
-	_value(std::move(list))
+	_value(std::make_shared<ValueList>(std::move(list)))
 {
 }
 
@@ -126,11 +126,18 @@ bool Value::IsBoolean() const
 	return GetType() == ValueType::Boolean;
 }
 
-ValueTable& Value::AsTable()
+ValueTable& Value::AsMutableTable()
 {
 	if (GetType() == ValueType::Table)
 	{
-		return std::get<ValueTable>(_value);
+		// Copy on write, the table may be shared with other values
+		auto& table = std::get<std::shared_ptr<ValueTable>>(_value);
+		if (table == nullptr)
+			table = std::make_shared<ValueTable>();
+		else if (table.use_count() > 1)
+			table = std::make_shared<ValueTable>(*table);
+
+		return *table;
 	}
 	else
 	{
@@ -139,11 +146,18 @@ ValueTable& Value::AsTable()
 	}
 }
 
-ValueList& Value::AsList()
+ValueList& Value::AsMutableList()
 {
 	if (GetType() == ValueType::List)
 	{
-		return std::get<ValueList>(_value);
+		// Copy on write, the list may be shared with other values
+		auto& list = std::get<std::shared_ptr<ValueList>>(_value);
+		if (list == nullptr)
+			list = std::make_shared<ValueList>();
+		else if (list.use_count() > 1)
+			list = std::make_shared<ValueList>(*list);
+
+		return *list;
 	}
 	else
 	{
@@ -156,7 +170,10 @@ const ValueTable& Value::AsTable() const
 {
 	if (GetType() == ValueType::Table)
 	{
-		return std::get<ValueTable>(_value);
+		// A value that was moved from no longer owns a table
+		static const auto EmptyTable = ValueTable();
+		auto& table = std::get<std::shared_ptr<ValueTable>>(_value);
+		return table != nullptr ? *table : EmptyTable;
 	}
 	else
 	{
@@ -169,7 +186,10 @@ const ValueList& Value::AsList() const
 {
 	if (GetType() == ValueType::List)
 	{
-		return std::get<ValueList>(_value);
+		// A value that was moved from no longer owns a list
+		static const auto EmptyList = ValueList();
+		auto& list = std::get<std::shared_ptr<ValueList>>(_value);
+		return list != nullptr ? *list : EmptyList;
 	}
 	else
 	{
@@ -276,9 +296,12 @@ bool Value::operator ==(const Value& rhs) const
 		switch (GetType())
 		{
 			case ValueType::Table:
-				return std::get<ValueTable>(_value) == std::get<ValueTable>(rhs._value);
+				// Shared tables are equal without comparing the content
+				return std::get<std::shared_ptr<ValueTable>>(_value) == std::get<std::shared_ptr<ValueTable>>(rhs._value) ||
+					AsTable() == rhs.AsTable();
 			case ValueType::List:
-				return std::get<ValueList>(_value) == std::get<ValueList>(rhs._value);
+				return std::get<std::shared_ptr<ValueList>>(_value) == std::get<std::shared_ptr<ValueList>>(rhs._value) ||
+					AsList() == rhs.AsList();
 			case ValueType::String:
 				return std::get<std::string>(_value) == std::get<std::string>(rhs._value);
 			case ValueType::Integer:
@@ -28,6 +28,12 @@ namespace Soup::Core
 
 	/// <summary>
 	/// Build State Extension interface
+	/// Tables and lists are shared between copies and only copied when a shared one is modified, so handing a large
+	/// state to another owner costs a reference count. Each level of the copy still shares its children, a change to a
+	/// nested value only copies the tables and lists on the path to it.
+	/// The accessors only read the shared table or list, a change must go through the mutable accessors which first
+	/// detach a shared table or list from the other copies.
+	/// Note: A reference from the mutable accessors must not be used after the value has been copied.
 	/// </summary>
 	class Value
 	{
@@ -62,8 +68,8 @@ namespace Soup::Core
 		/// </summary>
 		std::string ToString();
 
-		ValueTable& AsTable();
-		ValueList& AsList();
+		ValueTable& AsMutableTable();
+		ValueList& AsMutableList();
 
 		const ValueTable& AsTable() const;
 		const ValueList& AsList() const;
@@ -87,8 +93,8 @@ namespace Soup::Core
 
 	private:
 		std::variant<
-			ValueTable,
-			ValueList,
+			std::shared_ptr<ValueTable>,
+			std::shared_ptr<ValueList>,
 			std::string,
 			int64_t,
 			double,
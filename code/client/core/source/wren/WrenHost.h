@@ -19,6 +19,7 @@ namespace Soup::Core
 
 	private:
 		std::map<std::string, Path> _bundles;
+		std::vector<Path> _loadedFiles;
 
 	protected:
 		Path _scriptFile;
@@ -30,6 +31,7 @@ namespace Soup::Core
 			_scriptFile(std::move(scriptFile)),
 			_bundlesFile(std::move(bundlesFile)),
 			_bundles(),
+			_loadedFiles(),
 			_vm(nullptr)
 		{
 			// Configure the Wren Virtual Machine
@@ -52,11 +54,20 @@ namespace Soup::Core
 			_vm = nullptr;
 		}
 
+		/// <summary>
+		/// Get the script, bundles and module files the host tried to load, including modules that were missing
+		/// </summary>
+		const std::vector<Path>& GetLoadedFiles() const
+		{
+			return _loadedFiles;
+		}
+
 		void InterpretMain()
 		{
 			// Load the bundles
 			if (_bundlesFile.has_value())
 			{
+				_loadedFiles.push_back(_bundlesFile.value());
 				std::ifstream bundlesFile(_bundlesFile.value().ToString());
 				if (!bundlesFile.is_open())
 					throw std::runtime_error("Bundles does not exist");
@@ -80,6 +91,7 @@ namespace Soup::Core
 			}
 
 			// Load the script
+			_loadedFiles.push_back(_scriptFile);
 			std::ifstream scriptFile(_scriptFile.ToString());
 			if (!scriptFile.is_open())
 				throw std::runtime_error(std::format("Script does not exist {0}", _scriptFile.ToString()));
@@ -190,6 +202,8 @@ namespace Soup::Core
 			}
 			else
 			{
+				_loadedFiles.push_back(Path(moduleName));
+
 				// Attempt to load the module as a script file
 				std::ifstream scriptFile(moduleName.data());
 				if (scriptFile.is_open())
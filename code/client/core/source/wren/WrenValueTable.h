@@ -96,6 +96,161 @@ namespace Soup::Core
 		}
 
 		static ValueTable GetSlotTable(WrenVM* vm, int slot)
+		{
+			return GetSlotTable(vm, slot, nullptr);
+		}
+
+		/// <summary>
+		/// Get the table in the slot as an update of the previous value.
+		/// The tables and lists that are unchanged are shared with the previous value instead of being copied, so only
+		/// the parts that were modified use new memory and compare quickly against the previous state.
+		/// Note: Wren has no hook for writes to a map or list, so every value is read once to find the changes.
+		/// </summary>
+		static Value GetSlotTable(WrenVM* vm, int slot, const Value& previous)
+		{
+			auto mapType = wrenGetSlotType(vm, slot);
+			if (mapType != WREN_TYPE_MAP) {
+				throw std::runtime_error("Type must be a map");
+			}
+
+			return GetSlotValue(vm, slot, previous);
+		}
+
+		static ValueList GetSlotList(WrenVM* vm, int slot)
+		{
+			return GetSlotList(vm, slot, nullptr);
+		}
+
+	private:
+		static Value GetSlotValue(WrenVM* vm, int slot, const Value& previous)
+		{
+			auto result = TryGetSlotValueUpdate(vm, slot, previous);
+			return result.has_value() ? std::move(result.value()) : previous;
+		}
+
+		/// <summary>
+		/// Read the value in the slot as an update of the previous value, returns empty when it is unchanged.
+		/// Each value is read a single time and a table or list is only copied once a change is found in it.
+		/// </summary>
+		static std::optional<Value> TryGetSlotValueUpdate(WrenVM* vm, int slot, const Value& previous)
+		{
+			auto type = wrenGetSlotType(vm, slot);
+			if (type == WREN_TYPE_MAP)
+			{
+				if (!previous.IsTable())
+					return Value(GetSlotTable(vm, slot, nullptr));
+
+				auto result = TryGetSlotTableUpdate(vm, slot, previous.AsTable());
+				return result.has_value() ? std::optional<Value>(Value(std::move(result.value()))) : std::nullopt;
+			}
+			else if (type == WREN_TYPE_LIST)
+			{
+				if (!previous.IsList())
+					return Value(GetSlotList(vm, slot, nullptr));
+
+				auto result = TryGetSlotListUpdate(vm, slot, previous.AsList());
+				return result.has_value() ? std::optional<Value>(Value(std::move(result.value()))) : std::nullopt;
+			}
+			else
+			{
+				if (IsSlotValueEqual(vm, slot, previous))
+					return std::nullopt;
+
+				return GetSlotValue(vm, slot);
+			}
+		}
+
+		static std::optional<ValueTable> TryGetSlotTableUpdate(WrenVM* vm, int slot, const ValueTable& previous)
+		{
+			int mapSlot = slot;
+			int keySlot = slot + 1;
+			int valueSlot = slot + 2;
+
+			wrenEnsureSlots(vm, slot + 3);
+			auto mapCount = wrenGetMapCount(vm, mapSlot);
+
+			// A table with added or removed keys is read in full
+			if (static_cast<size_t>(mapCount) != previous.size())
+				return GetSlotTable(vm, slot, &previous);
+
+			auto result = std::optional<ValueTable>();
+			for (auto i = 0; i < mapCount; i++)
+			{
+				wrenGetMapKeyValueAt(vm, mapSlot, i, keySlot, valueSlot);
+
+				auto keyType = wrenGetSlotType(vm, keySlot);
+				if (keyType != WREN_TYPE_STRING) {
+					auto stringBuilder = std::stringstream();
+					stringBuilder << "KEY[" << i << "]";
+					throw InvalidTypeException(stringBuilder.str());
+				}
+
+				auto key = std::string(wrenGetSlotString(vm, keySlot));
+				auto previousValue = previous.find(key);
+				if (previousValue == previous.end())
+					return GetSlotTable(vm, slot, &previous);
+
+				try
+				{
+					auto value = TryGetSlotValueUpdate(vm, valueSlot, previousValue->second);
+					if (!value.has_value())
+						continue;
+
+					if (!result.has_value())
+						result = previous;
+					result->insert_or_assign(key, std::move(value.value()));
+				}
+				catch(const InvalidTypeException& exception)
+				{
+					// Unwrap the type error
+					auto stringBuilder = std::stringstream();
+					stringBuilder << "[" << key << "]" << exception.what();
+					throw InvalidTypeException(stringBuilder.str());
+				}
+			}
+
+			return result;
+		}
+
+		static std::optional<ValueList> TryGetSlotListUpdate(WrenVM* vm, int slot, const ValueList& previous)
+		{
+			int listSlot = slot;
+			int valueSlot = slot + 1;
+
+			wrenEnsureSlots(vm, slot + 2);
+			auto listCount = wrenGetListCount(vm, listSlot);
+
+			// A list that changed size is read in full
+			if (static_cast<size_t>(listCount) != previous.size())
+				return GetSlotList(vm, slot, &previous);
+
+			auto result = std::optional<ValueList>();
+			for (auto i = 0; i < listCount; i++)
+			{
+				try
+				{
+					wrenGetListElement(vm, listSlot, i, valueSlot);
+					auto value = TryGetSlotValueUpdate(vm, valueSlot, previous[i]);
+					if (!value.has_value())
+						continue;
+
+					if (!result.has_value())
+						result = previous;
+					result->at(i) = std::move(value.value());
+				}
+				catch(const InvalidTypeException& exception)
+				{
+					// Unwrap the type error
+					auto stringBuilder = std::stringstream();
+					stringBuilder << "[" << i << "]" << exception.what();
+					throw InvalidTypeException(stringBuilder.str());
+				}
+			}
+
+			return result;
+		}
+
+		static ValueTable GetSlotTable(WrenVM* vm, int slot, const ValueTable* previous)
 		{
 			int mapSlot = slot;
 			int keySlot = slot + 1;
@@ -124,7 +279,10 @@ namespace Soup::Core
 				auto key = wrenGetSlotString(vm, keySlot);
 				try
 				{
-					auto value = GetSlotValue(vm, valueSlot);
+					auto previousValue = previous != nullptr ? previous->find(key) : ValueTable::const_iterator();
+					auto value = previous != nullptr && previousValue != previous->end() ?
+						GetSlotValue(vm, valueSlot, previousValue->second) :
+						GetSlotValue(vm, valueSlot);
 					result.emplace(key, std::move(value));
 				}
 				catch(const InvalidTypeException& exception)
@@ -139,7 +297,7 @@ namespace Soup::Core
 			return result;
 		}
 
-		static ValueList GetSlotList(WrenVM* vm, int slot)
+		static ValueList GetSlotList(WrenVM* vm, int slot, const ValueList* previous)
 		{
 			int listSlot = slot;
 			int valueSlot = slot + 1;
@@ -158,7 +316,9 @@ namespace Soup::Core
 				try
 				{
 					wrenGetListElement(vm, listSlot, i, valueSlot);
-					auto value = GetSlotValue(vm, valueSlot);
+					auto value = previous != nullptr && static_cast<size_t>(i) < previous->size() ?
+						GetSlotValue(vm, valueSlot, previous->at(i)) :
+						GetSlotValue(vm, valueSlot);
 					result.push_back(std::move(value));
 				}
 				catch(const InvalidTypeException& exception)
@@ -173,6 +333,7 @@ namespace Soup::Core
 			return result;
 		}
 
+	public:
 		static Value GetSlotValue(WrenVM* vm, int slot)
 		{
 			auto type = wrenGetSlotType(vm, slot);
@@ -205,5 +366,27 @@ namespace Soup::Core
 					throw std::runtime_error("Unkown SlotType.");
 			}
 		}
+
+	private:
+		/// <summary>
+		/// Check if the primitive value in the slot matches the previous value without building a copy
+		/// </summary>
+		static bool IsSlotValueEqual(WrenVM* vm, int slot, const Value& previous)
+		{
+			auto type = wrenGetSlotType(vm, slot);
+			switch (type)
+			{
+				case WREN_TYPE_BOOL:
+					return previous.GetType() == ValueType::Boolean && previous.AsBoolean() == wrenGetSlotBool(vm, slot);
+				case WREN_TYPE_NUM:
+					// Numbers are always read back as floats
+					return previous.GetType() == ValueType::Float && previous.AsFloat() == wrenGetSlotDouble(vm, slot);
+				case WREN_TYPE_STRING:
+					return previous.GetType() == ValueType::String && previous.AsString() == wrenGetSlotString(vm, slot);
+				default:
+					// Invalid values are reported when the value is read
+					return false;
+			}
+		}
 	};
 }
\ No newline at end of file
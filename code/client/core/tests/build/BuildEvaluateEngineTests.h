@@ -115,8 +115,8 @@ namespace Soup::Core::UnitTests
 				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 				[](Monitor::ISystemAccessMonitor& monitor)
 				{
-					monitor.TouchFileRead(Path("./InputFile2.in"), true, false);
-					monitor.TouchFileWrite(Path("./OutputFile2.out"), false);
+					monitor.TouchFileRead("./InputFile2.in", true, false);
+					monitor.TouchFileWrite("./OutputFile2.out", false);
 				});
 
 			// Setup the input build state
@@ -219,7 +219,7 @@ namespace Soup::Core::UnitTests
 		}
 
 		// [[Fact]]
-		void Execute_OneOperation_ObservedInputAndOutput_CircularReference_RemoveInput()
+		void Execute_OneOperation_Mkdir_InProcess()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
@@ -233,28 +233,30 @@ namespace Soup::Core::UnitTests
 			auto fileSystem = std::make_shared<MockFileSystem>();
 			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
 			auto fileSystemState = FileSystemState(
-				1,
-				std::unordered_map<FileId, Path>({}));
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Tools/mkdir.exe") },
+					{ 2, Path("C:/TestWorkingDirectory/out/") },
+				}));
 
 			// Register the test process manager
 			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
 			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
 
-			monitorProcessManager->RegisterExecuteCallback(
-				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
-				[](Monitor::ISystemAccessMonitor& monitor)
-				{
-					// Read and write the same file
-					monitor.TouchFileRead(Path("./File.txt"), true, false);
-					monitor.TouchFileWrite(Path("./File.txt"), false);
-				});
-
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
 				false,
 				false,
 				false,
-				fileSystemState);
+				false,
+				1,
+				fileSystemState,
+				nullptr,
+				nullptr,
+				std::map<std::string, Path>(
+				{
+					{ "mkdir", Path("C:/Tools/mkdir.exe") },
+				}));
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -262,15 +264,15 @@ namespace Soup::Core::UnitTests
 				{
 					OperationInfo(
 						1,
-						"TestCommand: 1",
+						"MakeDir: 1",
 						CommandInfo(
 							Path("C:/TestWorkingDirectory/"),
-							Path("./Command.exe"),
-							{ "Arguments" }),
-						{ },
-						{ },
+							Path("C:/Tools/mkdir.exe"),
+							{ "./out/" }),
 						{ },
+						{ 2, },
 						{ },
+						{ 2, },
 						{ },
 						1),
 				});
@@ -278,7 +280,6 @@ namespace Soup::Core::UnitTests
 			auto temporaryDirectory = Path();
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
-
 			auto ranOperations = uut.Evaluate(
 				operationGraph,
 				operationResults,
@@ -311,12 +312,9 @@ namespace Soup::Core::UnitTests
 					"DIAG: Build evaluation start",
 					"DIAG: Check for previous operation invocation",
 					"INFO: Operation has no successful previous invocation",
-					"HIGH: TestCommand: 1",
-					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
-					"DIAG: Allowed Read Access:",
-					"DIAG: Allowed Write Access:",
-					"WARN: File \"C:/TestWorkingDirectory/File.txt\" observed as both input and output for operation \"TestCommand: 1\"",
-					"WARN: Removing from input list for now. Will be treated as error in the future.",
+					"HIGH: MakeDir: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] C:/Tools/mkdir.exe ./out/",
+					"DIAG: Execute InProcess Mkdir: C:/TestWorkingDirectory/out/",
 					"DIAG: Build evaluation end",
 				}),
 				testListener->GetMessages(),
@@ -333,26 +331,21 @@ namespace Soup::Core::UnitTests
 			// Verify expected file system requests
 			Assert::AreEqual(
 				std::vector<std::string>({
+					"Exists: C:/TestWorkingDirectory/out/",
+					"CreateDirectory: C:/TestWorkingDirectory/out/",
 				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
 
-			// Verify expected process requests
+			// Verify no process was created for the built-in tool
 			Assert::AreEqual(
-				std::vector<std::string>({
-					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
-					"ProcessStart: 1",
-					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
-					"GetExitCode: 1",
-				}),
+				std::vector<std::string>({}),
 				monitorProcessManager->GetRequests(),
 				"Verify monitor process manager requests match expected.");
 		}
 
 		// [[Fact]]
-		void Execute_OneOperation_ObservedInput_CircularReference_RemoveInput()
+		void Execute_OneOperation_Mkdir_InProcess_WriteAccessDenied()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
@@ -366,44 +359,44 @@ namespace Soup::Core::UnitTests
 			auto fileSystem = std::make_shared<MockFileSystem>();
 			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
 			auto fileSystemState = FileSystemState(
-				1,
+				3,
 				std::unordered_map<FileId, Path>({
-					{ 1, Path("C:/TestWorkingDirectory/File.txt") },
+					{ 1, Path("C:/Tools/mkdir.exe") },
+					{ 2, Path("C:/TestWorkingDirectory/out/") },
 				}));
 
 			// Register the test process manager
 			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
 			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
 
-			monitorProcessManager->RegisterExecuteCallback(
-				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
-				[](Monitor::ISystemAccessMonitor& monitor)
-				{
-					// Read and write the same file
-					monitor.TouchFileRead(Path("./File.txt"), true, false);
-					monitor.TouchFileWrite(Path("./File.txt"), false);
-				});
-
 			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
 				false,
 				false,
 				false,
-				fileSystemState);
+				false,
+				1,
+				fileSystemState,
+				nullptr,
+				nullptr,
+				std::map<std::string, Path>(
+				{
+					{ "mkdir", Path("C:/Tools/mkdir.exe") },
+				}));
 
-			// Evaluate the build
+			// Evaluate the build with a directory outside of the allowed write access
 			auto operationGraph = OperationGraph(
 				{ 1, },
 				{
 					OperationInfo(
 						1,
-						"TestCommand: 1",
+						"MakeDir: 1",
 						CommandInfo(
 							Path("C:/TestWorkingDirectory/"),
-							Path("./Command.exe"),
-							{ "Arguments" }),
+							Path("C:/Tools/mkdir.exe"),
+							{ "./out/" }),
 						{ },
-						{ 1, },
+						{ 2, },
 						{ },
 						{ },
 						{ },
@@ -414,29 +407,20 @@ namespace Soup::Core::UnitTests
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
 
-			auto ranOperations = uut.Evaluate(
-				operationGraph,
-				operationResults,
-				temporaryDirectory,
-				globalAllowedReadAccess,
-				globalAllowedWriteAccess);
-
-			Assert::IsTrue(ranOperations, "Verify ran operations");
+			Assert::Throws<BuildFailedException>([&]()
+			{
+				auto ranOperations = uut.Evaluate(
+					operationGraph,
+					operationResults,
+					temporaryDirectory,
+					globalAllowedReadAccess,
+					globalAllowedWriteAccess);
+				(void)ranOperations;
+			});
 
 			// Verify operation results
 			Assert::AreEqual(
-				std::map<OperationId, OperationResult>(
-				{
-					{
-						1,
-						OperationResult(
-							true,
-							std::chrono::clock_cast<std::chrono::file_clock>(
-								std::chrono::time_point<std::chrono::system_clock>()),
-							{ },
-							{ 1, })
-					},
-				}),
+				std::map<OperationId, OperationResult>(),
 				operationResults.GetResults(),
 				"Verify operation results match expected.");
 
@@ -446,48 +430,29 @@ namespace Soup::Core::UnitTests
 					"DIAG: Build evaluation start",
 					"DIAG: Check for previous operation invocation",
 					"INFO: Operation has no successful previous invocation",
-					"HIGH: TestCommand: 1",
-					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
-					"DIAG: Allowed Read Access:",
-					"DIAG: Allowed Write Access:",
-					"WARN: File \"C:/TestWorkingDirectory/File.txt\" observed as both input and output for operation \"TestCommand: 1\"",
-					"WARN: Removing from input list for now. Will be treated as error in the future.",
-					"DIAG: Build evaluation end",
+					"HIGH: MakeDir: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] C:/Tools/mkdir.exe ./out/",
+					"DIAG: Execute InProcess Mkdir: C:/TestWorkingDirectory/out/",
+					"ERRO: File write access denied: C:/TestWorkingDirectory/out/",
 				}),
 				testListener->GetMessages(),
 				"Verify log messages match expected.");
 
-			// Verify expected system requests
-			Assert::AreEqual(
-				std::vector<std::string>({
-					"GetCurrentTime",
-				}),
-				system->GetRequests(),
-				"Verify system requests match expected.");
-
-			// Verify expected file system requests
+			// Verify the directory was not created
 			Assert::AreEqual(
-				std::vector<std::string>({
-				}),
+				std::vector<std::string>({}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
 
-			// Verify expected process requests
+			// Verify no process was created for the built-in tool
 			Assert::AreEqual(
-				std::vector<std::string>({
-					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
-					"ProcessStart: 1",
-					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
-					"GetExitCode: 1",
-				}),
+				std::vector<std::string>({}),
 				monitorProcessManager->GetRequests(),
 				"Verify monitor process manager requests match expected.");
 		}
 
 		// [[Fact]]
-		void Evaluate_OneOperation_Incremental_MissingFileInfo()
+		void Execute_OneOperation_Mkdir_Exists_InProcess_Untouched()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
@@ -497,22 +462,19 @@ namespace Soup::Core::UnitTests
 			auto system = std::make_shared<MockSystem>();
 			auto scopedSystem = ScopedSystemRegister(system);
 
-			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 9min);
-
 			// Register the test file system
 			auto fileSystem = std::make_shared<MockFileSystem>();
 			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockDirectory(
+				Path("C:/TestWorkingDirectory/out/"),
+				std::make_shared<MockDirectory>(std::vector<Path>()));
+
 			auto fileSystemState = FileSystemState(
 				3,
 				std::unordered_map<FileId, Path>({
-					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
-					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
-					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
-				}),
-				{},
-				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
-					{ 3, executableInputTime },
+					{ 1, Path("C:/Tools/mkdir.exe") },
+					{ 2, Path("C:/TestWorkingDirectory/out/") },
 				}));
 
 			// Register the test process manager
@@ -524,7 +486,15 @@ namespace Soup::Core::UnitTests
 				false,
 				false,
 				false,
-				fileSystemState);
+				false,
+				1,
+				fileSystemState,
+				nullptr,
+				nullptr,
+				std::map<std::string, Path>(
+				{
+					{ "mkdir", Path("C:/Tools/mkdir.exe") },
+				}));
 
 			// Evaluate the build
 			auto operationGraph = OperationGraph(
@@ -532,29 +502,19 @@ namespace Soup::Core::UnitTests
 				{
 					OperationInfo(
 						1,
-						"TestCommand: 1",
+						"MakeDir: 1",
 						CommandInfo(
 							Path("C:/TestWorkingDirectory/"),
-							Path("./Command.exe"),
-							{ "Arguments" }),
-						{ 1, },
-						{ 2, },
+							Path("C:/Tools/mkdir.exe"),
+							{ "./out/" }),
 						{ },
+						{ 2, },
 						{ },
+						{ 2, },
 						{ },
 						1),
 				});
-			auto operationResults = OperationResults({
-				{
-					1,
-					OperationResult(
-						true,
-						std::chrono::clock_cast<std::chrono::file_clock>(
-							std::chrono::sys_days(May/22/2015) + 9h + 10min),
-						{ 1, },
-						{ 2, })
-				},
-			});
+			auto operationResults = OperationResults();
 			auto temporaryDirectory = Path();
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
@@ -577,8 +537,8 @@ namespace Soup::Core::UnitTests
 							true,
 							std::chrono::clock_cast<std::chrono::file_clock>(
 								std::chrono::time_point<std::chrono::system_clock>()),
-							{},
-							{})
+							{ },
+							{ 2, })
 					},
 				}),
 				operationResults.GetResults(),
@@ -589,11 +549,10 @@ namespace Soup::Core::UnitTests
 				std::vector<std::string>({
 					"DIAG: Build evaluation start",
 					"DIAG: Check for previous operation invocation",
-					"INFO: Output target does not exist: C:/TestWorkingDirectory/OutputFile.out",
-					"HIGH: TestCommand: 1",
-					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
-					"DIAG: Allowed Read Access:",
-					"DIAG: Allowed Write Access:",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: MakeDir: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] C:/Tools/mkdir.exe ./out/",
+					"DIAG: Execute InProcess Mkdir: C:/TestWorkingDirectory/out/",
 					"DIAG: Build evaluation end",
 				}),
 				testListener->GetMessages(),
@@ -610,27 +569,20 @@ namespace Soup::Core::UnitTests
 			// Verify expected file system requests
 			Assert::AreEqual(
 				std::vector<std::string>({
-					"TryGetLastWriteTime: C:/TestWorkingDirectory/OutputFile.out",
+					"Exists: C:/TestWorkingDirectory/out/",
 				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
 
-			// Verify expected process requests
+			// Verify no process was created for the built-in tool
 			Assert::AreEqual(
-				std::vector<std::string>({
-					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
-					"ProcessStart: 1",
-					"WaitForExit: 1",
-					"GetStandardOutput: 1",
-					"GetStandardError: 1",
-					"GetExitCode: 1",
-				}),
+				std::vector<std::string>({}),
 				monitorProcessManager->GetRequests(),
 				"Verify monitor process manager requests match expected.");
 		}
 
 		// [[Fact]]
-		void Evaluate_OneOperation_Incremental_MissingTargetFile()
+		void Execute_OneOperation_ObservedInputAndOutput_CircularReference_RemoveInput()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
@@ -640,34 +592,27 @@ namespace Soup::Core::UnitTests
 			auto system = std::make_shared<MockSystem>();
 			auto scopedSystem = ScopedSystemRegister(system);
 
-			// Setup the input file only
-			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 11min);
-			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 9min);
-
 			// Register the test file system
 			auto fileSystem = std::make_shared<MockFileSystem>();
 			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
 			auto fileSystemState = FileSystemState(
-				3,
-				std::unordered_map<FileId, Path>({
-					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
-					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
-					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
-				}),
-				{},
-				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
-					{ 1, inputTime },
-					{ 2, std::nullopt },
-					{ 3, executableInputTime },
-				}));
+				1,
+				std::unordered_map<FileId, Path>({}));
 
 			// Register the test process manager
 			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
 			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
 
-			// Create the build state
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[](Monitor::ISystemAccessMonitor& monitor)
+				{
+					// Read and write the same file
+					monitor.TouchFileRead("./File.txt", true, false);
+					monitor.TouchFileWrite("./File.txt", false);
+				});
+
+			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
 				false,
 				false,
@@ -685,26 +630,18 @@ namespace Soup::Core::UnitTests
 							Path("C:/TestWorkingDirectory/"),
 							Path("./Command.exe"),
 							{ "Arguments" }),
-						{ 1, },
-						{ 2, },
+						{ },
+						{ },
 						{ },
 						{ },
 						{ },
 						1),
 				});
-			auto operationResults = OperationResults({
-				{
-					1,
-					OperationResult(
-						true,
-						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 10min),
-						{ 1, },
-						{ 2, })
-				},
-			});
+			auto operationResults = OperationResults();
 			auto temporaryDirectory = Path();
 			auto globalAllowedReadAccess = std::vector<Path>();
 			auto globalAllowedWriteAccess = std::vector<Path>();
+
 			auto ranOperations = uut.Evaluate(
 				operationGraph,
 				operationResults,
@@ -724,8 +661,8 @@ namespace Soup::Core::UnitTests
 							true,
 							std::chrono::clock_cast<std::chrono::file_clock>(
 								std::chrono::time_point<std::chrono::system_clock>()),
-							{},
-							{})
+							{ },
+							{ 2, })
 					},
 				}),
 				operationResults.GetResults(),
@@ -736,11 +673,13 @@ namespace Soup::Core::UnitTests
 				std::vector<std::string>({
 					"DIAG: Build evaluation start",
 					"DIAG: Check for previous operation invocation",
-					"INFO: Output target does not exist: C:/TestWorkingDirectory/OutputFile.out",
+					"INFO: Operation has no successful previous invocation",
 					"HIGH: TestCommand: 1",
 					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
 					"DIAG: Allowed Read Access:",
 					"DIAG: Allowed Write Access:",
+					"WARN: File \"C:/TestWorkingDirectory/File.txt\" observed as both input and output for operation \"TestCommand: 1\"",
+					"WARN: Removing from input list for now. Will be treated as error in the future.",
 					"DIAG: Build evaluation end",
 				}),
 				testListener->GetMessages(),
@@ -756,7 +695,8 @@ namespace Soup::Core::UnitTests
 
 			// Verify expected file system requests
 			Assert::AreEqual(
-				std::vector<std::string>({}),
+				std::vector<std::string>({
+				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
 
@@ -775,7 +715,7 @@ namespace Soup::Core::UnitTests
 		}
 
 		// [[Fact]]
-		void Evaluate_OneOperation_Incremental_OutOfDate()
+		void Execute_OneOperation_ObservedInput_CircularReference_RemoveInput()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
@@ -785,28 +725,156 @@ namespace Soup::Core::UnitTests
 			auto system = std::make_shared<MockSystem>();
 			auto scopedSystem = ScopedSystemRegister(system);
 
-			// Setup the input/output files to be out of date
-			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 10min);
-			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 11min);
-			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 9min);
-
 			// Register the test file system
 			auto fileSystem = std::make_shared<MockFileSystem>();
 			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
 			auto fileSystemState = FileSystemState(
-				3,
+				1,
 				std::unordered_map<FileId, Path>({
-					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
-					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
-					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
-				}),
-				{},
+					{ 1, Path("C:/TestWorkingDirectory/File.txt") },
+				}));
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			monitorProcessManager->RegisterExecuteCallback(
+				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+				[](Monitor::ISystemAccessMonitor& monitor)
+				{
+					// Read and write the same file
+					monitor.TouchFileRead("./File.txt", true, false);
+					monitor.TouchFileWrite("./File.txt", false);
+				});
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command.exe"),
+							{ "Arguments" }),
+						{ },
+						{ 1, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ 1, })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"WARN: File \"C:/TestWorkingDirectory/File.txt\" observed as both input and output for operation \"TestCommand: 1\"",
+					"WARN: Removing from input list for now. Will be treated as error in the future.",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Evaluate_OneOperation_Incremental_MissingFileInfo()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 9min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
+				}),
+				{},
 				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
-					{ 1, inputTime },
-					{ 2, outputTime },
 					{ 3, executableInputTime },
 				}));
 
@@ -844,7 +912,8 @@ namespace Soup::Core::UnitTests
 					1,
 					OperationResult(
 						true,
-						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 10min),
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(May/22/2015) + 9h + 10min),
 						{ 1, },
 						{ 2, })
 				},
@@ -878,20 +947,12 @@ namespace Soup::Core::UnitTests
 				operationResults.GetResults(),
 				"Verify operation results match expected.");
 
-			// Verify expected system requests
-			Assert::AreEqual(
-				std::vector<std::string>({
-					"GetCurrentTime",
-				}),
-				system->GetRequests(),
-				"Verify system requests match expected.");
-
 			// Verify expected logs
 			Assert::AreEqual(
 				std::vector<std::string>({
 					"DIAG: Build evaluation start",
 					"DIAG: Check for previous operation invocation",
-					"INFO: Input altered after target [C:/TestWorkingDirectory/InputFile.in] -> [C:/TestWorkingDirectory/OutputFile.out]",
+					"INFO: Output target does not exist: C:/TestWorkingDirectory/OutputFile.out",
 					"HIGH: TestCommand: 1",
 					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
 					"DIAG: Allowed Read Access:",
@@ -901,9 +962,19 @@ namespace Soup::Core::UnitTests
 				testListener->GetMessages(),
 				"Verify log messages match expected.");
 
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
 			// Verify expected file system requests
 			Assert::AreEqual(
-				std::vector<std::string>({}),
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/TestWorkingDirectory/OutputFile.out",
+				}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
 
@@ -922,7 +993,7 @@ namespace Soup::Core::UnitTests
 		}
 
 		// [[Fact]]
-		void Evaluate_OneOperation_Incremental_Executable_OutOfDate()
+		void Evaluate_OneOperation_Incremental_MissingTargetFile()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
@@ -932,13 +1003,11 @@ namespace Soup::Core::UnitTests
 			auto system = std::make_shared<MockSystem>();
 			auto scopedSystem = ScopedSystemRegister(system);
 
-			// Setup the input/output files to be out of date
-			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+			// Setup the input file only
 			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 9min);
-			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
 				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 9min);
 
 			// Register the test file system
 			auto fileSystem = std::make_shared<MockFileSystem>();
@@ -953,7 +1022,7 @@ namespace Soup::Core::UnitTests
 				{},
 				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
 					{ 1, inputTime },
-					{ 2, outputTime },
+					{ 2, std::nullopt },
 					{ 3, executableInputTime },
 				}));
 
@@ -961,7 +1030,7 @@ namespace Soup::Core::UnitTests
 			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
 			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
 
-			// Setup the input build state
+			// Create the build state
 			auto uut = BuildEvaluateEngine(
 				false,
 				false,
@@ -991,7 +1060,7 @@ namespace Soup::Core::UnitTests
 					1,
 					OperationResult(
 						true,
-						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 0min),
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 10min),
 						{ 1, },
 						{ 2, })
 				},
@@ -1025,21 +1094,12 @@ namespace Soup::Core::UnitTests
 				operationResults.GetResults(),
 				"Verify operation results match expected.");
 
-			// Verify expected system requests
-			Assert::AreEqual(
-				std::vector<std::string>({
-					"GetCurrentTime",
-				}),
-				system->GetRequests(),
-				"Verify system requests match expected.");
-
 			// Verify expected logs
 			Assert::AreEqual(
 				std::vector<std::string>({
 					"DIAG: Build evaluation start",
 					"DIAG: Check for previous operation invocation",
-					"INFO: Input altered after last evaluate [C:/TestWorkingDirectory/Command.exe]",
-					"DIAG: Executable out of date",
+					"INFO: Output target does not exist: C:/TestWorkingDirectory/OutputFile.out",
 					"HIGH: TestCommand: 1",
 					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
 					"DIAG: Allowed Read Access:",
@@ -1049,6 +1109,14 @@ namespace Soup::Core::UnitTests
 				testListener->GetMessages(),
 				"Verify log messages match expected.");
 
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
 			// Verify expected file system requests
 			Assert::AreEqual(
 				std::vector<std::string>({}),
@@ -1070,19 +1138,23 @@ namespace Soup::Core::UnitTests
 		}
 
 		// [[Fact]]
-		void Evaluate_OneOperation_Incremental_UpToDate()
+		void Evaluate_OneOperation_Incremental_OutOfDate()
 		{
 			// Register the test listener
 			auto testListener = std::make_shared<TestTraceListener>();
 			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
 
-			// Setup the input/output files to be up to date
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Setup the input/output files to be out of date
 			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
 			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
 				std::chrono::sys_days(May/22/2015) + 9h + 11min);
 			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
-				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+				std::chrono::sys_days(May/22/2015) + 9h + 9min);
 
 			// Register the test file system
 			auto fileSystem = std::make_shared<MockFileSystem>();
@@ -1102,10 +1174,10 @@ namespace Soup::Core::UnitTests
 				}));
 
 			// Register the test process manager
-			auto processManager = std::make_shared<MockProcessManager>();
-			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
 
-			// Create the initial build state
+			// Setup the input build state
 			auto uut = BuildEvaluateEngine(
 				false,
 				false,
@@ -1135,7 +1207,7 @@ namespace Soup::Core::UnitTests
 					1,
 					OperationResult(
 						true,
-						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 15min),
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 10min),
 						{ 1, },
 						{ 2, })
 				},
@@ -1150,7 +1222,7 @@ namespace Soup::Core::UnitTests
 				globalAllowedReadAccess,
 				globalAllowedWriteAccess);
 
-			Assert::IsFalse(ranOperations, "Verify did not run operations");
+			Assert::IsTrue(ranOperations, "Verify ran operations");
 
 			// Verify operation results
 			Assert::AreEqual(
@@ -1161,21 +1233,32 @@ namespace Soup::Core::UnitTests
 						OperationResult(
 							true,
 							std::chrono::clock_cast<std::chrono::file_clock>(
-								std::chrono::sys_days(May / 22 / 2015) + 9h + 15min),
-							{ 1, },
-							{ 2, })
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{},
+							{})
 					},
 				}),
 				operationResults.GetResults(),
 				"Verify operation results match expected.");
 
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
 			// Verify expected logs
 			Assert::AreEqual(
 				std::vector<std::string>({
 					"DIAG: Build evaluation start",
 					"DIAG: Check for previous operation invocation",
-					"INFO: Up to date",
-					"INFO: TestCommand: 1",
+					"INFO: Input altered after target [C:/TestWorkingDirectory/InputFile.in] -> [C:/TestWorkingDirectory/OutputFile.out]",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
 					"DIAG: Build evaluation end",
 				}),
 				testListener->GetMessages(),
@@ -1186,6 +1269,676 @@ namespace Soup::Core::UnitTests
 				std::vector<std::string>({}),
 				fileSystem->GetRequests(),
 				"Verify file system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Evaluate_OneOperation_Incremental_Executable_OutOfDate()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Setup the input/output files to be out of date
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 9min);
+			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, inputTime },
+					{ 2, outputTime },
+					{ 3, executableInputTime },
+				}));
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command.exe"),
+							{ "Arguments" }),
+						{ 1, },
+						{ 2, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 0min),
+						{ 1, },
+						{ 2, })
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{},
+							{})
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Input altered after last evaluate [C:/TestWorkingDirectory/Command.exe]",
+					"DIAG: Executable out of date",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Evaluate_OneOperation_Incremental_UpToDate()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Setup the input/output files to be up to date
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, inputTime },
+					{ 2, outputTime },
+					{ 3, executableInputTime },
+				}));
+
+			// Register the test process manager
+			auto processManager = std::make_shared<MockProcessManager>();
+			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+
+			// Create the initial build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command.exe"),
+							{ "Arguments" }),
+						{ 1, },
+						{ 2, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 15min),
+						{ 1, },
+						{ 2, })
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsFalse(ranOperations, "Verify did not run operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::sys_days(May / 22 / 2015) + 9h + 15min),
+							{ 1, },
+							{ 2, })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Up to date",
+					"INFO: TestCommand: 1",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void Evaluate_OneOperation_Incremental_UnchangedOutput_UpToDate()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Setup an output that was left untouched because its content already matched,
+			// the input is newer than the output but was seen by the last evaluate
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 5min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/Command.exe") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, inputTime },
+					{ 2, outputTime },
+					{ 3, executableInputTime },
+				}));
+
+			// Register the test process manager
+			auto processManager = std::make_shared<MockProcessManager>();
+			auto scopedProcessManager = ScopedProcessManagerRegister(processManager);
+
+			// Create the initial build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command.exe"),
+							{ "Arguments" }),
+						{ 1, },
+						{ 2, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 15min),
+						{ 1, },
+						{ 2, })
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsFalse(ranOperations, "Verify did not run operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::sys_days(May / 22 / 2015) + 9h + 15min),
+							{ 1, },
+							{ 2, })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Up to date",
+					"INFO: TestCommand: 1",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void Evaluate_OneOperation_Incremental_UnchangedOutput_Deleted()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Setup a copy that left its identical destination untouched, the input is newer than the old
+			// destination but was seen by the last evaluate and the destination has since been deleted
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+			auto executableInputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 10min);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/copy.exe") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, inputTime },
+					{ 2, std::nullopt },
+					{ 3, executableInputTime },
+				}));
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Create the build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"Copy: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./copy.exe"),
+							{ "InputFile.in", "OutputFile.out" }),
+						{ 1, },
+						{ 2, },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults({
+				{
+					1,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(std::chrono::sys_days(May/22/2015) + 9h + 15min),
+						{ 1, },
+						{ 2, })
+				},
+			});
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Output target does not exist: C:/TestWorkingDirectory/OutputFile.out",
+					"HIGH: Copy: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./copy.exe InputFile.in OutputFile.out",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected process requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./copy.exe InputFile.in OutputFile.out Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
+		}
+
+		// [[Fact]]
+		void Execute_TwoOperations_Parallel_DependencyOrder()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			auto fileSystemState = FileSystemState();
+
+			// Register the test process manager
+			auto monitorProcessManager = std::make_shared<Monitor::MockMonitorProcessManager>();
+			auto scopedMonitorProcessManager = Monitor::ScopedMonitorProcessManagerRegister(monitorProcessManager);
+
+			// Setup the input build state
+			auto uut = BuildEvaluateEngine(
+				false,
+				false,
+				false,
+				false,
+				4,
+				fileSystemState);
+
+			// Evaluate the build
+			auto operationGraph = OperationGraph(
+				{ 1, },
+				{
+					OperationInfo(
+						1,
+						"TestCommand: 1",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command1.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ 2 },
+						1),
+					OperationInfo(
+						2,
+						"TestCommand: 2",
+						CommandInfo(
+							Path("C:/TestWorkingDirectory/"),
+							Path("./Command2.exe"),
+							{ "Arguments" }),
+						{ },
+						{ },
+						{ },
+						{ },
+						{ },
+						1),
+				});
+			auto operationResults = OperationResults();
+			auto temporaryDirectory = Path();
+			auto globalAllowedReadAccess = std::vector<Path>();
+			auto globalAllowedWriteAccess = std::vector<Path>();
+			auto ranOperations = uut.Evaluate(
+				operationGraph,
+				operationResults,
+				temporaryDirectory,
+				globalAllowedReadAccess,
+				globalAllowedWriteAccess);
+
+			Assert::IsTrue(ranOperations, "Verify ran operations");
+
+			// Verify operation results
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>(
+				{
+					{
+						1,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+					{
+						2,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+				}),
+				operationResults.GetResults(),
+				"Verify operation results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build evaluation start",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 1",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command1.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Check for previous operation invocation",
+					"INFO: Operation has no successful previous invocation",
+					"HIGH: TestCommand: 2",
+					"DIAG: Execute: [C:/TestWorkingDirectory/] ./Command2.exe Arguments",
+					"DIAG: Allowed Read Access:",
+					"DIAG: Allowed Write Access:",
+					"DIAG: Build evaluation end",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"GetCurrentTime",
+					"GetCurrentTime",
+				}),
+				system->GetRequests(),
+				"Verify system requests match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify the child operation only started after the parent completed
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 1",
+					"WaitForExit: 1",
+					"GetStandardOutput: 1",
+					"GetStandardError: 1",
+					"GetExitCode: 1",
+					"CreateMonitorProcess: 2 [C:/TestWorkingDirectory/] ./Command2.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
+					"ProcessStart: 2",
+					"WaitForExit: 2",
+					"GetStandardOutput: 2",
+					"GetStandardError: 2",
+					"GetExitCode: 2",
+				}),
+				monitorProcessManager->GetRequests(),
+				"Verify monitor process manager requests match expected.");
 		}
 
 		// [[Fact]]
@@ -1216,7 +1969,7 @@ namespace Soup::Core::UnitTests
 				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 				[](Monitor::ISystemAccessMonitor& monitor)
 				{
-					monitor.TouchFileWrite(Path("./OutputFile.out"), false);
+					monitor.TouchFileWrite("./OutputFile.out", false);
 				});
 
 			// Setup the input build state
@@ -1354,7 +2107,7 @@ namespace Soup::Core::UnitTests
 				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 				[](Monitor::ISystemAccessMonitor& monitor)
 				{
-					monitor.TouchFileWrite(Path("./File.txt"), false);
+					monitor.TouchFileWrite("./File.txt", false);
 				});
 
 			// Setup the input build state
@@ -1492,7 +2245,7 @@ namespace Soup::Core::UnitTests
 				"CreateMonitorProcess: 1 [C:/TestWorkingDirectory/] ./Command1.exe Arguments Environment [2] 1 0 AllowedRead [0] AllowedWrite [0]",
 				[](Monitor::ISystemAccessMonitor& monitor)
 				{
-					monitor.TouchFileRead(Path("./File.txt"), true, false);
+					monitor.TouchFileRead("./File.txt", true, false);
 				});
 
 			// Setup the input build state
@@ -357,6 +357,56 @@ namespace Soup::Core::UnitTests
 				"Verify log messages match expected.");
 		}
 
+		// [[Fact]]
+		void IsOutdated_SingleInput_TargetExists_InputSeenByLastEvaluate()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Create the file state
+			auto outputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 12min);
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 13min);
+			auto lastEvaluateTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 14min);
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Output.bin") },
+					{ 2, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 1, outputTime },
+					{ 2, inputTime },
+				}));
+
+			// Setup the input parameters
+			auto targetFiles = std::vector<FileId>({
+				1,
+			});
+			auto inputFiles = std::vector<FileId>({
+				2,
+			});
+
+			// Perform the check
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.IsOutdated(lastEvaluateTime, targetFiles, inputFiles);
+
+			// Verify the results
+			Assert::IsFalse(result, "Verify the result is false.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
 		// [[Fact]]
 		void IsOutdated_MultipleInputs_RelativeAndAbsolute()
 		{
@@ -407,5 +457,147 @@ namespace Soup::Core::UnitTests
 				testListener->GetMessages(),
 				"Verify log messages match expected.");
 		}
+
+		// [[Fact]]
+		void HasMatchingContent_NoDigests()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				2,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Input.cpp") },
+				}));
+
+			// Setup the input parameters
+			auto files = std::vector<FileId>({
+				1,
+			});
+			auto contentDigests = std::vector<std::string>({});
+
+			// Perform the check
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.HasMatchingContent(files, contentDigests);
+
+			// Verify the results
+			Assert::IsFalse(result, "Verify the result is false.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void HasMatchingContent_Altered()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(std::stringstream("Hello Soup")));
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				2,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Input.cpp") },
+				}));
+
+			// Setup the input parameters
+			auto files = std::vector<FileId>({
+				1,
+			});
+			auto contentDigests = std::vector<std::string>({
+				"Ck1VqNd45QIvq3AZd8XYQLvEhtA",
+			});
+
+			// Perform the check
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.HasMatchingContent(files, contentDigests);
+
+			// Verify the results
+			Assert::IsFalse(result, "Verify the result is false.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Content altered [C:/Root/Input.cpp]",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void HasMatchingContent_Unchanged()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("C:/Root/Input.cpp"),
+				std::make_shared<MockFile>(std::stringstream("Hello World")));
+
+			// Initialize the file system state
+			auto fileSystemState = FileSystemState(
+				2,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/Root/Input.cpp") },
+				}));
+
+			// Setup the input parameters
+			auto files = std::vector<FileId>({
+				1,
+			});
+			auto contentDigests = std::vector<std::string>({
+				"Ck1VqNd45QIvq3AZd8XYQLvEhtA",
+			});
+
+			// Perform the check twice to verify the digest is cached
+			auto uut = BuildHistoryChecker(fileSystemState);
+			bool result = uut.HasMatchingContent(files, contentDigests);
+			bool secondResult = uut.HasMatchingContent(files, contentDigests);
+
+			// Verify the results
+			Assert::IsTrue(result, "Verify the result is true.");
+			Assert::IsTrue(secondResult, "Verify the second result is true.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenReadBinary: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
 	};
 }
@@ -0,0 +1,76 @@
+// <copyright file="FileSystemSnapshotReaderTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+using namespace std::chrono;
+
+namespace Soup::Core::UnitTests
+{
+	class FileSystemSnapshotReaderTests
+	{
+	public:
+		// [[Fact]]
+		void Deserialize_InvalidFileHeaderThrows()
+		{
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'F', 'S', '2',
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto exception = Assert::Throws<std::runtime_error>([&content]() {
+				auto actual = FileSystemSnapshotReader::Deserialize(content);
+			});
+
+			Assert::AreEqual("Invalid file system snapshot file header", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Deserialize_InvalidFileVersionThrows()
+		{
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'F', 'S', '\0', 0x00, 0x00, 0x00, 0x02,
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto exception = Assert::Throws<std::runtime_error>([&content]() {
+				auto actual = FileSystemSnapshotReader::Deserialize(content);
+			});
+
+			Assert::AreEqual("File system snapshot file version does not match expected", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Deserialize_Single()
+		{
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'F', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				'D', 'I', 'R', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x02, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, '.', '/', 'A', '.', 'h',
+				0x06, 0x00, 0x00, 0x00, '.', '/', 'S', 'r', 'c', '/',
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = FileSystemSnapshotReader::Deserialize(content);
+
+			Assert::AreEqual(
+				std::map<std::string, DirectorySnapshot>({
+					{
+						"C:/Root/",
+						DirectorySnapshot(
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+							{ "./A.h", "./Src/", })
+					},
+				}),
+				actual,
+				"Verify directories match expected.");
+		}
+	};
+}
@@ -0,0 +1,64 @@
+// <copyright file="FileSystemSnapshotWriterTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+using namespace std::chrono;
+
+namespace Soup::Core::UnitTests
+{
+	class FileSystemSnapshotWriterTests
+	{
+	public:
+		// [[Fact]]
+		void Serialize_Empty()
+		{
+			auto directories = std::map<std::string, DirectorySnapshot>();
+			auto content = std::stringstream();
+
+			FileSystemSnapshotWriter::Serialize(directories, content);
+
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'F', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				'D', 'I', 'R', '\0', 0x00, 0x00, 0x00, 0x00,
+			});
+			Assert::AreEqual(
+				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
+				content.str(),
+				"Verify file content match expected.");
+		}
+
+		// [[Fact]]
+		void Serialize_Single()
+		{
+			auto directories = std::map<std::string, DirectorySnapshot>({
+				{
+					"C:/Root/",
+					DirectorySnapshot(
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+						{ "./A.h", "./Src/", })
+				},
+			});
+			auto content = std::stringstream();
+
+			FileSystemSnapshotWriter::Serialize(directories, content);
+
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'F', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				'D', 'I', 'R', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x02, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, '.', '/', 'A', '.', 'h',
+				0x06, 0x00, 0x00, 0x00, '.', '/', 'S', 'r', 'c', '/',
+			});
+			Assert::AreEqual(
+				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
+				content.str(),
+				"Verify file content match expected.");
+		}
+	};
+}
@@ -221,5 +221,116 @@ namespace Soup::Core::UnitTests
 				uut.GetFiles(),
 				"Verify files match expected.");
 		}
+
+		// [[Fact]]
+		void TryFindFileId_AfterMove()
+		{
+			auto original = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{
+						8,
+						Path("C:/Root/DoStuff.exe"),
+					}}));
+			original.ToFileId(Path("C:/Root/DoStuff2.exe"));
+
+			auto uut = FileSystemState(std::move(original));
+
+			FileId fileId;
+			Assert::IsTrue(uut.TryFindFileId(Path("C:/Root/DoStuff.exe"), fileId), "Verify first file is found.");
+			Assert::AreEqual<FileId>(8, fileId, "Verify file id matches expected.");
+			Assert::IsTrue(uut.TryFindFileId(std::string_view("C:/Root/DoStuff2.exe"), fileId), "Verify new file is found.");
+			Assert::AreEqual<FileId>(11, fileId, "Verify file id matches expected.");
+			Assert::AreEqual<FileId>(12, uut.ToFileId(Path("C:/Root/DoStuff3.exe")), "Verify next file id matches expected.");
+		}
+
+		// [[Fact]]
+		void NotifyFileChanged_InvalidatesWriteTime()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{ 8, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 8, inputTime },
+				}));
+
+			uut.NotifyFileChanged(Path("C:/Root/Input.cpp"));
+
+			auto lastWriteTime = uut.GetLastWriteTime(8);
+
+			Assert::IsFalse(lastWriteTime.has_value(), "Verify the deleted file has no write time.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void HasObservedFileChanged_Observed()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto inputTime = std::chrono::clock_cast<std::chrono::file_clock>(
+				std::chrono::sys_days(May/22/2015) + 9h + 11min);
+
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{ 8, Path("C:/Root/Input.cpp") },
+				}),
+				{},
+				std::unordered_map<FileId, std::optional<std::chrono::time_point<std::chrono::file_clock>>>({
+					{ 8, inputTime },
+				}));
+
+			Assert::IsTrue(uut.HasObservedFileChanged(Path("C:/Root/Input.cpp")), "Verify the deleted file changed.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryGetLastWriteTime: C:/Root/Input.cpp",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void HasObservedFileChanged_NotObserved()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto uut = FileSystemState(
+				10,
+				std::unordered_map<FileId, Path>({
+					{ 8, Path("C:/Root/Output.obj") },
+				}));
+
+			Assert::IsFalse(uut.HasObservedFileChanged(Path("C:/Root/Output.obj")), "Verify the unobserved file is ignored.");
+			Assert::IsFalse(uut.HasObservedFileChanged(Path("C:/Root/Unknown.cpp")), "Verify the unknown file is ignored.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
 	};
 }
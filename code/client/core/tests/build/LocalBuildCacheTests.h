@@ -0,0 +1,441 @@
+// <copyright file="LocalBuildCacheTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "MockRemoteBuildCache.h"
+
+namespace Soup::Core::UnitTests
+{
+	class LocalBuildCacheTests
+	{
+	public:
+		// [[Fact]]
+		void TryRestore_NoEntry()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/InputFile.in"),
+				std::make_shared<MockFile>(std::stringstream("input")));
+
+			auto fileSystemState = FileSystemState(
+				2,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+				}));
+
+			auto uut = LocalBuildCache(Path("C:/Cache/"), fileSystemState);
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(
+				OperationInfo(
+					1,
+					"TestCommand: 1",
+					CommandInfo(
+						Path("C:/TestWorkingDirectory/"),
+						Path("./Command.exe"),
+						{ "Arguments" }),
+					{ 1, },
+					{ 2, },
+					{ },
+					{ },
+					{ },
+					1),
+				operationResult);
+
+			Assert::IsFalse(result, "Verify result is false.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build cache miss",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void Store_UndeclaredOutput()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/obj") },
+				}));
+
+			auto uut = LocalBuildCache(Path("C:/Cache/"), fileSystemState);
+			uut.Store(
+				OperationInfo(
+					1,
+					"TestCommand: 1",
+					CommandInfo(
+						Path("C:/TestWorkingDirectory/"),
+						Path("./Command.exe"),
+						{ "Arguments" }),
+					{ 1, },
+					{ 2, },
+					{ },
+					{ },
+					{ },
+					1),
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ 1, },
+					{ 2, 3, }));
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"DIAG: Build cache skipped: Undeclared output C:/TestWorkingDirectory/obj",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			// Verify nothing was written to the cache
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void Store_TryRestore_DifferentWorkingDirectory()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system with the same sources in two checkouts
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/CheckoutA/InputFile.in"),
+				std::make_shared<MockFile>(std::stringstream("input")));
+			fileSystem->CreateMockFile(
+				Path("C:/CheckoutA/out/OutputFile.out"),
+				std::make_shared<MockFile>(std::stringstream("output")));
+			fileSystem->CreateMockFile(
+				Path("C:/CheckoutB/InputFile.in"),
+				std::make_shared<MockFile>(std::stringstream("input")));
+
+			// Store the result of the operation run in the first checkout
+			auto storeFileSystemState = FileSystemState(
+				2,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/CheckoutA/InputFile.in") },
+					{ 2, Path("C:/CheckoutA/out/OutputFile.out") },
+				}));
+			auto storeCache = LocalBuildCache(Path("C:/Cache/"), storeFileSystemState);
+			storeCache.Store(
+				OperationInfo(
+					1,
+					"TestCommand: 1",
+					CommandInfo(
+						Path("C:/CheckoutA/"),
+						Path("./Command.exe"),
+						{ "C:/CheckoutA/InputFile.in", "-o", "C:/CheckoutA/out/OutputFile.out" }),
+					{ 1, },
+					{ 2, },
+					{ },
+					{ },
+					{ },
+					1),
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ 1, },
+					{ 2, }));
+
+			// Restore the same operation in the second checkout
+			auto fileSystemState = FileSystemState(
+				2,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/CheckoutB/InputFile.in") },
+					{ 2, Path("C:/CheckoutB/out/OutputFile.out") },
+				}));
+			auto uut = LocalBuildCache(Path("C:/Cache/"), fileSystemState);
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(
+				OperationInfo(
+					1,
+					"TestCommand: 1",
+					CommandInfo(
+						Path("C:/CheckoutB/"),
+						Path("./Command.exe"),
+						{ "C:/CheckoutB/InputFile.in", "-o", "C:/CheckoutB/out/OutputFile.out" }),
+					{ 1, },
+					{ 2, },
+					{ },
+					{ },
+					{ },
+					1),
+				operationResult);
+
+			Assert::IsTrue(result, "Verify result is true.");
+			Assert::AreEqual(
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ 1, },
+					{ 2, }),
+				operationResult,
+				"Verify operation result matches expected.");
+
+			// Verify the output was restored
+			auto outputFile = fileSystem->GetMockFile(Path("C:/CheckoutB/out/OutputFile.out"));
+			Assert::AreEqual(
+				std::string("output"),
+				outputFile->Content.str(),
+				"Verify output content matches expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Create Directory: C:/Cache/operations/",
+					"INFO: Create Directory: C:/Cache/content/",
+					"INFO: Restored from build cache",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void Store_TryRestore_RemoteEntry()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			auto remoteCache = std::make_shared<MockRemoteBuildCache>();
+			auto operationInfo = OperationInfo(
+				1,
+				"TestCommand: 1",
+				CommandInfo(
+					Path("C:/TestWorkingDirectory/"),
+					Path("./Command.exe"),
+					{ "Arguments" }),
+				{ 1, },
+				{ 2, },
+				{ },
+				{ },
+				{ },
+				1);
+
+			// Store the result of the operation run on the first machine
+			{
+				auto fileSystem = std::make_shared<MockFileSystem>();
+				auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+				fileSystem->CreateMockFile(
+					Path("C:/TestWorkingDirectory/InputFile.in"),
+					std::make_shared<MockFile>(std::stringstream("input")));
+				fileSystem->CreateMockFile(
+					Path("C:/TestWorkingDirectory/OutputFile.out"),
+					std::make_shared<MockFile>(std::stringstream("output")));
+
+				auto fileSystemState = FileSystemState(
+					2,
+					std::unordered_map<FileId, Path>({
+						{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+						{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					}));
+				auto storeCache = LocalBuildCache(Path("C:/Cache/"), fileSystemState, remoteCache);
+				storeCache.Store(
+					operationInfo,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::time_point<std::chrono::system_clock>()),
+						{ 1, },
+						{ 2, }));
+			}
+
+			// The remote has the content and the manifest
+			auto entryNames = remoteCache->GetEntryNames();
+			Assert::AreEqual<size_t>(2, entryNames.size(), "Verify remote entry count.");
+			auto& contentName = entryNames[0];
+			auto& manifestName = entryNames[1];
+			Assert::IsTrue(contentName.starts_with("content/"), "Verify content entry name.");
+			Assert::IsTrue(manifestName.starts_with("operations/"), "Verify manifest entry name.");
+			for (auto& name : { contentName, manifestName })
+			{
+				Assert::IsTrue(
+					std::count(name.begin(), name.end(), '/') == 1 &&
+						name.find_first_of("+=") == std::string::npos,
+					"Verify entry name is a single url safe file name.");
+			}
+
+			// Restore the same operation on a second machine with an empty local cache
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/InputFile.in"),
+				std::make_shared<MockFile>(std::stringstream("input")));
+
+			auto fileSystemState = FileSystemState(
+				2,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+				}));
+			auto uut = LocalBuildCache(Path("C:/Cache/"), fileSystemState, remoteCache);
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(operationInfo, operationResult);
+
+			Assert::IsTrue(result, "Verify result is true.");
+
+			// Verify the output was restored and the local cache keeps a copy of the downloaded entries
+			Assert::AreEqual(
+				std::string("output"),
+				fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/OutputFile.out"))->Content.str(),
+				"Verify output content matches expected.");
+			Assert::AreEqual(
+				std::string("output"),
+				fileSystem->GetMockFile(Path("C:/Cache/") + Path("./" + contentName))->Content.str(),
+				"Verify local content copy matches expected.");
+
+			// Verify expected remote requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"Exists: " + contentName,
+					"Put: " + contentName,
+					"Put: " + manifestName,
+					"TryGet: " + manifestName,
+					"TryGet: " + contentName,
+				}),
+				remoteCache->GetRequests(),
+				"Verify remote requests match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Create Directory: C:/Cache/operations/",
+					"INFO: Create Directory: C:/Cache/content/",
+					"DIAG: Downloaded from remote build cache: " + manifestName,
+					"INFO: Create Directory: C:/Cache/operations/",
+					"INFO: Create Directory: C:/Cache/content/",
+					"DIAG: Downloaded from remote build cache: " + contentName,
+					"INFO: Restored from build cache",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+
+		// [[Fact]]
+		void Store_TryRestore_UndeclaredOutput()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test system
+			auto system = std::make_shared<MockSystem>();
+			auto scopedSystem = ScopedSystemRegister(system);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/InputFile.in"),
+				std::make_shared<MockFile>(std::stringstream("input")));
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/OutputFile.out"),
+				std::make_shared<MockFile>(std::stringstream("output")));
+			fileSystem->CreateMockFile(
+				Path("C:/TestWorkingDirectory/OtherFile.out"),
+				std::make_shared<MockFile>(std::stringstream("other")));
+
+			auto fileSystemState = FileSystemState(
+				3,
+				std::unordered_map<FileId, Path>({
+					{ 1, Path("C:/TestWorkingDirectory/InputFile.in") },
+					{ 2, Path("C:/TestWorkingDirectory/OutputFile.out") },
+					{ 3, Path("C:/TestWorkingDirectory/OtherFile.out") },
+				}));
+
+			// Store an entry that writes the first output
+			auto uut = LocalBuildCache(Path("C:/Cache/"), fileSystemState);
+			uut.Store(
+				OperationInfo(
+					1,
+					"TestCommand: 1",
+					CommandInfo(
+						Path("C:/TestWorkingDirectory/"),
+						Path("./Command.exe"),
+						{ "Arguments" }),
+					{ 1, },
+					{ 2, },
+					{ },
+					{ },
+					{ },
+					1),
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ 1, },
+					{ 2, }));
+
+			// The same command that only declares the other output must not restore the entry
+			auto operationResult = OperationResult();
+			auto result = uut.TryRestore(
+				OperationInfo(
+					1,
+					"TestCommand: 1",
+					CommandInfo(
+						Path("C:/TestWorkingDirectory/"),
+						Path("./Command.exe"),
+						{ "Arguments" }),
+					{ 1, },
+					{ 3, },
+					{ },
+					{ },
+					{ },
+					1),
+				operationResult);
+
+			Assert::IsFalse(result, "Verify result is false.");
+			Assert::AreEqual(
+				std::string("output"),
+				fileSystem->GetMockFile(Path("C:/TestWorkingDirectory/OutputFile.out"))->Content.str(),
+				"Verify the undeclared output was not written.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Create Directory: C:/Cache/operations/",
+					"INFO: Create Directory: C:/Cache/content/",
+					"WARN: Build cache manifest rejected: Undeclared output C:/TestWorkingDirectory/OutputFile.out",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+	};
+}
@@ -0,0 +1,71 @@
+﻿// <copyright file="MockRemoteBuildCache.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core
+{
+	/// <summary>
+	/// The mock remote build cache that keeps all entries in memory
+	/// </summary>
+	class MockRemoteBuildCache : public IRemoteBuildCache
+	{
+	private:
+		std::map<std::string, std::string, std::less<>> _entries;
+		std::vector<std::string> _requests;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="MockRemoteBuildCache"/> class.
+		/// </summary>
+		MockRemoteBuildCache() :
+			_entries(),
+			_requests()
+		{
+		}
+
+		/// <summary>
+		/// Get the remote requests
+		/// </summary>
+		const std::vector<std::string>& GetRequests() const
+		{
+			return _requests;
+		}
+
+		/// <summary>
+		/// Get the names of all stored entries
+		/// </summary>
+		std::vector<std::string> GetEntryNames() const
+		{
+			auto result = std::vector<std::string>();
+			for (auto& entry : _entries)
+				result.push_back(entry.first);
+
+			return result;
+		}
+
+		bool Exists(std::string_view name) override final
+		{
+			_requests.push_back(std::format("Exists: {}", name));
+			return _entries.contains(name);
+		}
+
+		bool TryGet(std::string_view name, std::string& content) override final
+		{
+			_requests.push_back(std::format("TryGet: {}", name));
+			auto findResult = _entries.find(name);
+			if (findResult == _entries.end())
+				return false;
+
+			content = findResult->second;
+			return true;
+		}
+
+		void Put(std::string_view name, std::string_view content) override final
+		{
+			_requests.push_back(std::format("Put: {}", name));
+			_entries.insert_or_assign(std::string(name), std::string(content));
+		}
+	};
+}
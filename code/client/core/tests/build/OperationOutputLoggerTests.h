@@ -0,0 +1,88 @@
+// <copyright file="OperationOutputLoggerTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class OperationOutputLoggerTests
+	{
+	public:
+		// [[Fact]]
+		void LogUntilComplete_LogsLinesFromOtherThread()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			auto uut = OperationOutputLogger();
+
+			// Write the output from a separate thread the same as the monitor
+			auto writer = std::thread(
+				[&uut]()
+				{
+					uut.OnStandardOutput("Line 1\nLine ");
+					uut.OnStandardError("Error 1\r\n");
+					uut.OnStandardOutput("2\nPartial");
+					uut.Complete();
+				});
+
+			uut.LogUntilComplete();
+			writer.join();
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Line 1",
+					"ERRO: Error 1",
+					"INFO: Line 2",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			uut.Flush();
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Line 1",
+					"ERRO: Error 1",
+					"INFO: Line 2",
+					"INFO: Partial",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+			Assert::AreEqual(
+				std::string("Line 1\nLine 2\nPartial"),
+				uut.TakeStandardOutput(),
+				"Verify standard output matches expected.");
+		}
+
+		// [[Fact]]
+		void Flush_LogsLinesNotYetLogged()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			auto uut = OperationOutputLogger();
+			uut.OnStandardOutput("Line 1\n");
+			uut.OnStandardError("Error 1");
+
+			// Nothing is logged on the thread that writes the output
+			Assert::AreEqual(
+				std::vector<std::string>(),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+
+			uut.Flush();
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Line 1",
+					"ERRO: Error 1",
+				}),
+				testListener->GetMessages(),
+				"Verify log messages match expected.");
+		}
+	};
+}
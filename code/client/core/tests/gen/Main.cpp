@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <chrono>
+#include <deque>
 #include <filesystem>
 #include <iostream>
 #include <memory>
@@ -12,6 +13,8 @@
 #include <string>
 #include <vector>
 
+#include "wren/wren.h"
+
 import Monitor.Host;
 import Opal;
 import Soup.Core;
@@ -28,7 +31,11 @@ using namespace Soup::Test;
 #include "build/BuildHistoryCheckerTests.gen.h"
 #include "build/BuildLoadEngineTests.gen.h"
 #include "build/BuildRunnerTests.gen.h"
+#include "build/FileSystemSnapshotReaderTests.gen.h"
+#include "build/FileSystemSnapshotWriterTests.gen.h"
 #include "build/FileSystemStateTests.gen.h"
+#include "build/LocalBuildCacheTests.gen.h"
+#include "build/OperationOutputLoggerTests.gen.h"
 #include "build/PackageProviderTests.gen.h"
 #include "build/RecipeBuildLocationManagerTests.gen.h"
 
@@ -41,6 +48,7 @@ using namespace Soup::Test;
 #include "operation-graph/OperationGraphWriterTests.gen.h"
 #include "operation-graph/OperationResultsTests.gen.h"
 #include "operation-graph/OperationResultsManagerTests.gen.h"
+#include "operation-graph/OperationResultsJournalTests.gen.h"
 #include "operation-graph/OperationResultsReaderTests.gen.h"
 #include "operation-graph/OperationResultsWriterTests.gen.h"
 
@@ -56,6 +64,9 @@ using namespace Soup::Test;
 #include "value-table/ValueTableManagerTests.gen.h"
 #include "value-table/ValueTableReaderTests.gen.h"
 #include "value-table/ValueTableWriterTests.gen.h"
+#include "value-table/ValueTests.gen.h"
+
+#include "wren/WrenValueTableTests.gen.h"
 
 int main()
 {
@@ -68,7 +79,11 @@ int main()
 	state += RunBuildHistoryCheckerTests();
 	state += RunBuildLoadEngineTests();
 	state += RunBuildRunnerTests();
+	state += RunFileSystemSnapshotReaderTests();
+	state += RunFileSystemSnapshotWriterTests();
 	state += RunFileSystemStateTests();
+	state += RunLocalBuildCacheTests();
+	state += RunOperationOutputLoggerTests();
 	state += RunPackageProviderTests();
 	state += RunRecipeBuildLocationManagerTests();
 
@@ -81,6 +96,7 @@ int main()
 	state += RunOperationGraphWriterTests();
 	state += RunOperationResultsTests();
 	state += RunOperationResultsManagerTests();
+	state += RunOperationResultsJournalTests();
 	state += RunOperationResultsReaderTests();
 	state += RunOperationResultsWriterTests();
 
@@ -96,6 +112,9 @@ int main()
 	state += RunValueTableManagerTests();
 	state += RunValueTableReaderTests();
 	state += RunValueTableWriterTests();
+	state += RunValueTests();
+
+	state += RunWrenValueTableTests();
 
 	std::cout << state.PassCount << " PASSED." << std::endl;
 	std::cout << state.FailCount << " FAILED." << std::endl;
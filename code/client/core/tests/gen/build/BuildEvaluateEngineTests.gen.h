@@ -8,6 +8,9 @@ TestState RunBuildEvaluateEngineTests()
 	TestState state = { 0, 0 };
 	state += Soup::Test::RunTest(className, "Initialize", [&testClass]() { testClass->Initialize(); });
 	state += Soup::Test::RunTest(className, "Execute_OneOperation_FirstRun", [&testClass]() { testClass->Execute_OneOperation_FirstRun(); });
+	state += Soup::Test::RunTest(className, "Execute_OneOperation_Mkdir_InProcess", [&testClass]() { testClass->Execute_OneOperation_Mkdir_InProcess(); });
+	state += Soup::Test::RunTest(className, "Execute_OneOperation_Mkdir_InProcess_WriteAccessDenied", [&testClass]() { testClass->Execute_OneOperation_Mkdir_InProcess_WriteAccessDenied(); });
+	state += Soup::Test::RunTest(className, "Execute_OneOperation_Mkdir_Exists_InProcess_Untouched", [&testClass]() { testClass->Execute_OneOperation_Mkdir_Exists_InProcess_Untouched(); });
 	state += Soup::Test::RunTest(className, "Execute_OneOperation_ObservedInputAndOutput_CircularReference_RemoveInput", [&testClass]() { testClass->Execute_OneOperation_ObservedInputAndOutput_CircularReference_RemoveInput(); });
 	state += Soup::Test::RunTest(className, "Execute_OneOperation_ObservedInput_CircularReference_RemoveInput", [&testClass]() { testClass->Execute_OneOperation_ObservedInput_CircularReference_RemoveInput(); });
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_MissingFileInfo", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_MissingFileInfo(); });
@@ -15,6 +18,9 @@ TestState RunBuildEvaluateEngineTests()
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_OutOfDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_OutOfDate(); });
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_Executable_OutOfDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_Executable_OutOfDate(); });
 	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_UpToDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_UpToDate(); });
+	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_UnchangedOutput_UpToDate", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_UnchangedOutput_UpToDate(); });
+	state += Soup::Test::RunTest(className, "Evaluate_OneOperation_Incremental_UnchangedOutput_Deleted", [&testClass]() { testClass->Evaluate_OneOperation_Incremental_UnchangedOutput_Deleted(); });
+	state += Soup::Test::RunTest(className, "Execute_TwoOperations_Parallel_DependencyOrder", [&testClass]() { testClass->Execute_TwoOperations_Parallel_DependencyOrder(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_DuplicateOutputFile_Fails", [&testClass]() { testClass->Execute_TwoOperations_DuplicateOutputFile_Fails(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_UndeclaredOutputWithDeclaredInput_Fails", [&testClass]() { testClass->Execute_TwoOperations_UndeclaredOutputWithDeclaredInput_Fails(); });
 	state += Soup::Test::RunTest(className, "Execute_TwoOperations_UndeclaredInputWithDeclaredOutput_Fails", [&testClass]() { testClass->Execute_TwoOperations_UndeclaredInputWithDeclaredOutput_Fails(); });
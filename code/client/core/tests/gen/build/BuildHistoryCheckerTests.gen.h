@@ -13,7 +13,11 @@ TestState RunBuildHistoryCheckerTests()
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_DeletedInputFile", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_DeletedInputFile(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_Outdated", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_Outdated(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_UpToDate", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_UpToDate(); });
+	state += Soup::Test::RunTest(className, "IsOutdated_SingleInput_TargetExists_InputSeenByLastEvaluate", [&testClass]() { testClass->IsOutdated_SingleInput_TargetExists_InputSeenByLastEvaluate(); });
 	state += Soup::Test::RunTest(className, "IsOutdated_MultipleInputs_RelativeAndAbsolute", [&testClass]() { testClass->IsOutdated_MultipleInputs_RelativeAndAbsolute(); });
+	state += Soup::Test::RunTest(className, "HasMatchingContent_NoDigests", [&testClass]() { testClass->HasMatchingContent_NoDigests(); });
+	state += Soup::Test::RunTest(className, "HasMatchingContent_Altered", [&testClass]() { testClass->HasMatchingContent_Altered(); });
+	state += Soup::Test::RunTest(className, "HasMatchingContent_Unchanged", [&testClass]() { testClass->HasMatchingContent_Unchanged(); });
 
 	return state;
 }
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+#include "build/FileSystemSnapshotReaderTests.h"
+
+TestState RunFileSystemSnapshotReaderTests() 
+{
+	auto className = "FileSystemSnapshotReaderTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::FileSystemSnapshotReaderTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Deserialize_InvalidFileHeaderThrows", [&testClass]() { testClass->Deserialize_InvalidFileHeaderThrows(); });
+	state += Soup::Test::RunTest(className, "Deserialize_InvalidFileVersionThrows", [&testClass]() { testClass->Deserialize_InvalidFileVersionThrows(); });
+	state += Soup::Test::RunTest(className, "Deserialize_Single", [&testClass]() { testClass->Deserialize_Single(); });
+
+	return state;
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include "build/FileSystemSnapshotWriterTests.h"
+
+TestState RunFileSystemSnapshotWriterTests() 
+{
+	auto className = "FileSystemSnapshotWriterTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::FileSystemSnapshotWriterTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Serialize_Empty", [&testClass]() { testClass->Serialize_Empty(); });
+	state += Soup::Test::RunTest(className, "Serialize_Single", [&testClass]() { testClass->Serialize_Single(); });
+
+	return state;
+}
\ No newline at end of file
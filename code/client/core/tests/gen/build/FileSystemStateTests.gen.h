@@ -16,6 +16,10 @@ TestState RunFileSystemStateTests()
 	state += Soup::Test::RunTest(className, "TryFindFileId_Found", [&testClass]() { testClass->TryFindFileId_Found(); });
 	state += Soup::Test::RunTest(className, "ToFileId_Existing", [&testClass]() { testClass->ToFileId_Existing(); });
 	state += Soup::Test::RunTest(className, "ToFileId_Unknown", [&testClass]() { testClass->ToFileId_Unknown(); });
+	state += Soup::Test::RunTest(className, "TryFindFileId_AfterMove", [&testClass]() { testClass->TryFindFileId_AfterMove(); });
+	state += Soup::Test::RunTest(className, "NotifyFileChanged_InvalidatesWriteTime", [&testClass]() { testClass->NotifyFileChanged_InvalidatesWriteTime(); });
+	state += Soup::Test::RunTest(className, "HasObservedFileChanged_Observed", [&testClass]() { testClass->HasObservedFileChanged_Observed(); });
+	state += Soup::Test::RunTest(className, "HasObservedFileChanged_NotObserved", [&testClass]() { testClass->HasObservedFileChanged_NotObserved(); });
 
 	return state;
 }
\ No newline at end of file
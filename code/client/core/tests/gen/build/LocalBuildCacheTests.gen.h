@@ -0,0 +1,16 @@
+#pragma once
+#include "build/LocalBuildCacheTests.h"
+
+TestState RunLocalBuildCacheTests() 
+{
+	auto className = "LocalBuildCacheTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::LocalBuildCacheTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "TryRestore_NoEntry", [&testClass]() { testClass->TryRestore_NoEntry(); });
+	state += Soup::Test::RunTest(className, "Store_UndeclaredOutput", [&testClass]() { testClass->Store_UndeclaredOutput(); });
+	state += Soup::Test::RunTest(className, "Store_TryRestore_DifferentWorkingDirectory", [&testClass]() { testClass->Store_TryRestore_DifferentWorkingDirectory(); });
+	state += Soup::Test::RunTest(className, "Store_TryRestore_RemoteEntry", [&testClass]() { testClass->Store_TryRestore_RemoteEntry(); });
+	state += Soup::Test::RunTest(className, "Store_TryRestore_UndeclaredOutput", [&testClass]() { testClass->Store_TryRestore_UndeclaredOutput(); });
+
+	return state;
+}
\ No newline at end of file
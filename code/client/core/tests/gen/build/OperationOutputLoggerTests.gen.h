@@ -0,0 +1,13 @@
+#pragma once
+#include "build/OperationOutputLoggerTests.h"
+
+TestState RunOperationOutputLoggerTests() 
+ {
+	auto className = "OperationOutputLoggerTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::OperationOutputLoggerTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "LogUntilComplete_LogsLinesFromOtherThread", [&testClass]() { testClass->LogUntilComplete_LogsLinesFromOtherThread(); });
+	state += Soup::Test::RunTest(className, "Flush_LogsLinesNotYetLogged", [&testClass]() { testClass->Flush_LogsLinesNotYetLogged(); });
+
+	return state;
+}
\ No newline at end of file
@@ -14,6 +14,8 @@ TestState RunOperationGraphReaderTests()
 	state += Soup::Test::RunTest(className, "Deserialize_SingleSimple", [&testClass]() { testClass->Deserialize_SingleSimple(); });
 	state += Soup::Test::RunTest(className, "Deserialize_SingleComplex", [&testClass]() { testClass->Deserialize_SingleComplex(); });
 	state += Soup::Test::RunTest(className, "Deserialize_Multiple", [&testClass]() { testClass->Deserialize_Multiple(); });
+	state += Soup::Test::RunTest(className, "Deserialize_Table_InvalidStringsHeaderThrows", [&testClass]() { testClass->Deserialize_Table_InvalidStringsHeaderThrows(); });
+	state += Soup::Test::RunTest(className, "Deserialize_Table_SingleComplex", [&testClass]() { testClass->Deserialize_Table_SingleComplex(); });
 
 	return state;
 }
\ No newline at end of file
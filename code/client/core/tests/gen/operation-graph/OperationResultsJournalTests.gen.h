@@ -0,0 +1,16 @@
+#pragma once
+#include "operation-graph/OperationResultsJournalTests.h"
+
+TestState RunOperationResultsJournalTests() 
+{
+	auto className = "OperationResultsJournalTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::OperationResultsJournalTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Replay_MissingFile", [&testClass]() { testClass->Replay_MissingFile(); });
+	state += Soup::Test::RunTest(className, "Clear_NoRecords", [&testClass]() { testClass->Clear_NoRecords(); });
+	state += Soup::Test::RunTest(className, "Append_Replay_RoundTrip", [&testClass]() { testClass->Append_Replay_RoundTrip(); });
+	state += Soup::Test::RunTest(className, "Replay_PartialRecord", [&testClass]() { testClass->Replay_PartialRecord(); });
+	state += Soup::Test::RunTest(className, "Replay_InvalidHeader", [&testClass]() { testClass->Replay_InvalidHeader(); });
+
+	return state;
+}
\ No newline at end of file
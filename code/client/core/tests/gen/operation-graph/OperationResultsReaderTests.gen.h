@@ -14,6 +14,7 @@ TestState RunOperationResultsReaderTests()
 	state += Soup::Test::RunTest(className, "Deserialize_SingleSimple", [&testClass]() { testClass->Deserialize_SingleSimple(); });
 	state += Soup::Test::RunTest(className, "Deserialize_SingleComplex", [&testClass]() { testClass->Deserialize_SingleComplex(); });
 	state += Soup::Test::RunTest(className, "Deserialize_Multiple", [&testClass]() { testClass->Deserialize_Multiple(); });
+	state += Soup::Test::RunTest(className, "Deserialize_SingleContentDigests", [&testClass]() { testClass->Deserialize_SingleContentDigests(); });
 
 	return state;
 }
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+#include "value-table/ValueTests.h"
+
+TestState RunValueTests() 
+ {
+	auto className = "ValueTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::ValueTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Copy_Table_SharesContent", [&testClass]() { testClass->Copy_Table_SharesContent(); });
+	state += Soup::Test::RunTest(className, "Copy_Table_Read_SharesContent", [&testClass]() { testClass->Copy_Table_Read_SharesContent(); });
+	state += Soup::Test::RunTest(className, "Copy_Table_ModifyCopy_LeavesOriginal", [&testClass]() { testClass->Copy_Table_ModifyCopy_LeavesOriginal(); });
+	state += Soup::Test::RunTest(className, "Copy_NestedTable_ModifyNested_SharesSiblings", [&testClass]() { testClass->Copy_NestedTable_ModifyNested_SharesSiblings(); });
+	state += Soup::Test::RunTest(className, "Copy_List_ModifyCopy_LeavesOriginal", [&testClass]() { testClass->Copy_List_ModifyCopy_LeavesOriginal(); });
+
+	return state;
+}
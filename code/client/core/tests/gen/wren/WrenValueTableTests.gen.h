@@ -0,0 +1,13 @@
+#pragma once
+#include "wren/WrenValueTableTests.h"
+
+TestState RunWrenValueTableTests() 
+ {
+	auto className = "WrenValueTableTests";
+	auto testClass = std::make_shared<Soup::Core::UnitTests::WrenValueTableTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "GetSlotTable_Unchanged_SharesPrevious", [&testClass]() { testClass->GetSlotTable_Unchanged_SharesPrevious(); });
+	state += Soup::Test::RunTest(className, "GetSlotTable_Changed_SharesUnchangedTables", [&testClass]() { testClass->GetSlotTable_Changed_SharesUnchangedTables(); });
+
+	return state;
+}
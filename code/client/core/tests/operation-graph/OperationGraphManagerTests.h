@@ -210,23 +210,32 @@ namespace Soup::Core::UnitTests
 			// Verify the file content
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'G', '\0', 0x06, 0x00, 0x00, 0x00,
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x05, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x08, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
+				0x15, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+				0x1D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
+				0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
-				'R', 'O', 'P', '\0', 0x01, 0x00, 0x00, 0x00,
-				0x05, 0x00, 0x00, 0x00,
+				'L', 'S', 'T', '\0', 0x03, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				'R', 'O', 'P', '\0', 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
 				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
-				0x0D, 0x00, 0x00, 0x00, 'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
-				0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'R', 'o', 'o', 't', '/',
-				0x0D, 0x00, 0x00, 0x00, '.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
-				0x02, 0x00, 0x00, 0x00,
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '1',
-				0x04, 0x00, 0x00, 0x00, 'a', 'r', 'g', '2',
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
-				0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
 			});
 			auto mockFile = fileSystem->GetMockFile(Path("./TestFiles/.soup/OperationGraph.bog"));
@@ -342,5 +342,99 @@ namespace Soup::Core::UnitTests
 				actual.GetOperations(),
 				"Verify operations match expected.");
 		}
+
+		// [[Fact]]
+		void Deserialize_Table_InvalidStringsHeaderThrows()
+		{
+			auto fileSystemState = FileSystemState();
+			auto binaryFileContent = std::vector<char>(
+			{
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '2',
+			});
+			auto content = std::stringstream(std::string(binaryFileContent.data(), binaryFileContent.size()));
+
+			auto exception = Assert::Throws<std::runtime_error>([&content, &fileSystemState]() {
+				auto actual = OperationGraphReader::Deserialize(content, fileSystemState);
+			});
+
+			Assert::AreEqual("Invalid operation graph strings header", exception.what(), "Verify Exception message");
+		}
+
+		// [[Fact]]
+		void Deserialize_Table_SingleComplex()
+		{
+			auto fileSystemState = FileSystemState(
+				13,
+				{
+					{ 11, Path("C:/File1") },
+					{ 12, Path("C:/File2") },
+				});
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'G', '\0', 0x07, 0x00, 0x00, 0x00,
+				'S', 'T', 'R', '\0', 0x07, 0x00, 0x00, 0x00, 0x3A, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+				0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+				0x10, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x14, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x18, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
+				0x25, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+				0x2D, 0x00, 0x00, 0x00, 0x0D, 0x00, 0x00, 0x00,
+				'C', ':', '/', 'F', 'i', 'l', 'e', '1',
+				'C', ':', '/', 'F', 'i', 'l', 'e', '2',
+				'a', 'r', 'g', '1',
+				'a', 'r', 'g', '2',
+				'T', 'e', 's', 't', 'O', 'p', 'e', 'r', 'a', 't', 'i', 'o', 'n',
+				'C', ':', '/', 'R', 'o', 'o', 't', '/',
+				'.', '/', 'D', 'o', 'S', 't', 'u', 'f', 'f', '.', 'e', 'x', 'e',
+				0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				'L', 'S', 'T', '\0', 0x05, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				'R', 'O', 'P', '\0', 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				'O', 'P', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationGraphReader::Deserialize(content, fileSystemState);
+
+			Assert::AreEqual(
+				std::vector<OperationId>({ 5, }),
+				actual.GetRootOperationIds(),
+				"Verify root operation ids match expected.");
+			Assert::AreEqual(
+				std::map<OperationId, OperationInfo>({
+					{
+						5,
+						OperationInfo(
+							5,
+							"TestOperation",
+							CommandInfo(
+								Path("C:/Root/"),
+								Path("./DoStuff.exe"),
+								{ "arg1", "arg2" }),
+							{ 11, },
+							{ 12, },
+							{ },
+							{ },
+							{ },
+							1),
+					}
+				}),
+				actual.GetOperations(),
+				"Verify operations match expected.");
+		}
 	};
 }
@@ -0,0 +1,254 @@
+// <copyright file="OperationResultsJournalTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class OperationResultsJournalTests
+	{
+	public:
+		// [[Fact]]
+		void Replay_MissingFile()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto actual = OperationResults();
+			auto isCorrupted = true;
+			auto result = OperationResultsJournal::Replay(
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				actual,
+				fileSystemState,
+				isCorrupted);
+
+			Assert::AreEqual<uint32_t>(0, result, "Verify no results were replayed.");
+			Assert::IsFalse(isCorrupted, "Verify the journal is not corrupted.");
+
+			// Verify expected file system requests
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"TryOpenReadBinary: ./TestFiles/.soup/Evaluate.brj",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify messages match expected.");
+		}
+
+		// [[Fact]]
+		void Clear_NoRecords()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState();
+			auto uut = OperationResultsJournal(Path("./TestFiles/.soup/Evaluate.brj"), fileSystemState, false);
+			uut.Clear();
+
+			// Verify the journal was not touched
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+		}
+
+		// [[Fact]]
+		void Append_Replay_RoundTrip()
+		{
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			auto fileSystemState = FileSystemState(
+				2,
+				{
+					{ 1, Path("C:/Root/Input.cpp") },
+					{ 2, Path("C:/Root/Output.obj") },
+				});
+			auto uut = OperationResultsJournal(Path("./TestFiles/.soup/Evaluate.brj"), fileSystemState, false);
+			uut.Append(
+				5,
+				OperationResult(
+					true,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ 1, },
+					{ 2, }));
+			uut.Append(
+				6,
+				OperationResult(
+					false,
+					std::chrono::clock_cast<std::chrono::file_clock>(
+						std::chrono::time_point<std::chrono::system_clock>()),
+					{ 2, },
+					{ }));
+
+			// Verify the journal is only opened once
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"OpenWriteBinary: ./TestFiles/.soup/Evaluate.brj",
+				}),
+				fileSystem->GetRequests(),
+				"Verify file system requests match expected.");
+
+			auto content = fileSystem->GetMockFile(Path("./TestFiles/.soup/Evaluate.brj"))->Content.str();
+
+			// Replay the journal into a fresh state
+			auto replayFileSystem = std::make_shared<MockFileSystem>();
+			auto scopedReplayFileSystem = ScopedFileSystemRegister(replayFileSystem);
+			replayFileSystem->CreateMockFile(
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				std::make_shared<MockFile>(std::stringstream(content)));
+
+			auto replayFileSystemState = FileSystemState();
+			auto actual = OperationResults();
+			auto isCorrupted = true;
+			auto result = OperationResultsJournal::Replay(
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				actual,
+				replayFileSystemState,
+				isCorrupted);
+
+			Assert::AreEqual<uint32_t>(2, result, "Verify both results were replayed.");
+			Assert::IsFalse(isCorrupted, "Verify the journal is not corrupted.");
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{
+						5,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ 1, },
+							{ 2, })
+					},
+					{
+						6,
+						OperationResult(
+							false,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ 2, },
+							{ })
+					},
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+			Assert::AreEqual(
+				std::string("C:/Root/Output.obj"),
+				replayFileSystemState.GetFilePath(2).ToString(),
+				"Verify file path match expected.");
+		}
+
+		// [[Fact]]
+		void Replay_PartialRecord()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// A single complete result record followed by a record that was cut off part way through
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'R', 'J', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+				0x06, 0x00, 0x00, 0x00,
+			});
+			fileSystem->CreateMockFile(
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				std::make_shared<MockFile>(std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()))));
+
+			auto fileSystemState = FileSystemState();
+			auto actual = OperationResults();
+			auto isCorrupted = false;
+			auto result = OperationResultsJournal::Replay(
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				actual,
+				fileSystemState,
+				isCorrupted);
+
+			Assert::AreEqual<uint32_t>(1, result, "Verify the complete result was replayed.");
+			Assert::IsTrue(isCorrupted, "Verify the partial record requires a reset.");
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{
+						5,
+						OperationResult(
+							false,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::time_point<std::chrono::system_clock>()),
+							{ },
+							{ })
+					},
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({}),
+				testListener->GetMessages(),
+				"Verify messages match expected.");
+		}
+
+		// [[Fact]]
+		void Replay_InvalidHeader()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			fileSystem->CreateMockFile(
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				std::make_shared<MockFile>(std::stringstream("garbage!")));
+
+			auto fileSystemState = FileSystemState();
+			auto actual = OperationResults();
+			auto isCorrupted = false;
+			auto result = OperationResultsJournal::Replay(
+				Path("./TestFiles/.soup/Evaluate.brj"),
+				actual,
+				fileSystemState,
+				isCorrupted);
+
+			Assert::AreEqual<uint32_t>(0, result, "Verify no results were replayed.");
+			Assert::IsTrue(isCorrupted, "Verify the invalid journal requires a reset.");
+
+			// Verify expected logs
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"ERRO: Invalid operation results journal file header",
+				}),
+				testListener->GetMessages(),
+				"Verify messages match expected.");
+		}
+	};
+}
@@ -179,7 +179,7 @@ namespace Soup::Core::UnitTests
 			// Verify the file content
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x03, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
@@ -187,6 +187,7 @@ namespace Soup::Core::UnitTests
 				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			});
 			auto mockFile = fileSystem->GetMockFile(Path("./TestFiles/.soup/OperationResults.bor"));
 			Assert::AreEqual(
@@ -252,5 +252,51 @@ namespace Soup::Core::UnitTests
 				actual.GetResults(),
 				"Verify results match expected.");
 		}
+
+		// [[Fact]]
+		void Deserialize_SingleContentDigests()
+		{
+			auto fileSystemState = FileSystemState(
+				20,
+				{
+					{ 11, Path("C:/File1") },
+					{ 12, Path("C:/File2") },
+				});
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'R', '\0', 0x03, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '1',
+				0x02, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 'C', ':', '/', 'F', 'i', 'l', 'e', '2',
+				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 'D', '1',
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 'D', '2',
+			});
+			auto content = std::stringstream(std::string((char*)binaryFileContent.data(), binaryFileContent.size()));
+
+			auto actual = OperationResultsReader::Deserialize(content, fileSystemState);
+
+			Assert::AreEqual(
+				std::map<OperationId, OperationResult>({
+					{
+						5,
+						OperationResult(
+							true,
+							std::chrono::clock_cast<std::chrono::file_clock>(
+								std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+							{ 11, },
+							{ 12, },
+							{ "D1", },
+							{ "D2", }),
+					}
+				}),
+				actual.GetResults(),
+				"Verify results match expected.");
+		}
 	};
 }
@@ -22,7 +22,7 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x03, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 			});
@@ -54,7 +54,7 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x03, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
@@ -62,6 +62,7 @@ namespace Soup::Core::UnitTests
 				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
 				0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			});
 
 			Assert::AreEqual(
@@ -92,7 +93,7 @@ namespace Soup::Core::UnitTests
 
 			auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x03, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
@@ -100,6 +101,7 @@ namespace Soup::Core::UnitTests
 				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			});
 			Assert::AreEqual(
 				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
@@ -138,7 +140,7 @@ namespace Soup::Core::UnitTests
 
 auto binaryFileContent = std::vector<uint8_t>(
 			{
-				'B', 'O', 'R', '\0', 0x02, 0x00, 0x00, 0x00,
+				'B', 'O', 'R', '\0', 0x03, 0x00, 0x00, 0x00,
 				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
 				'R', 'T', 'S', '\0', 0x02, 0x00, 0x00, 0x00,
 				0x05, 0x00, 0x00, 0x00,
@@ -146,11 +148,13 @@ auto binaryFileContent = std::vector<uint8_t>(
 				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 				0x06, 0x00, 0x00, 0x00,
 				0x01, 0x00, 0x00, 0x00,
 				0x80, 0x8d, 0xa9, 0xeb, 0x0b, 0x41, 0x38, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
 				0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 			});
 
 			Assert::AreEqual(
@@ -158,5 +162,46 @@ auto binaryFileContent = std::vector<uint8_t>(
 				content.str(),
 				"Verify file content match expected.");
 		}
+
+		// [[Fact]]
+		void Serialize_SingleContentDigests()
+		{
+			auto fileSystemState = FileSystemState();
+			auto files = std::set<FileId>();
+			auto operationResults = OperationResults({
+				{
+					5,
+					OperationResult(
+						true,
+						std::chrono::clock_cast<std::chrono::file_clock>(
+							std::chrono::sys_days(March/5/2020) + 12h + 35min + 34s + 1ms),
+						{ 1, },
+						{ 2, },
+						{ "D1", },
+						{ "D2", })
+				},
+			});
+			auto content = std::stringstream();
+
+			OperationResultsWriter::Serialize(operationResults, files, fileSystemState, content);
+
+			auto binaryFileContent = std::vector<uint8_t>(
+			{
+				'B', 'O', 'R', '\0', 0x03, 0x00, 0x00, 0x00,
+				'F', 'I', 'S', '\0', 0x00, 0x00, 0x00, 0x00,
+				'R', 'T', 'S', '\0', 0x01, 0x00, 0x00, 0x00,
+				0x05, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00,
+				0x10, 0x16, 0x62, 0xbb, 0x0b, 0x41, 0x38, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 'D', '1',
+				0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 'D', '2',
+			});
+			Assert::AreEqual(
+				std::string((char*)binaryFileContent.data(), binaryFileContent.size()),
+				content.str(),
+				"Verify file content match expected.");
+		}
 	};
 }
@@ -0,0 +1,117 @@
+// <copyright file="ValueTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class ValueTests
+	{
+	public:
+		// [[Fact]]
+		void Copy_Table_SharesContent()
+		{
+			const auto value = Value(ValueTable(
+			{
+				{ "Key", Value(std::string("Value")) },
+			}));
+
+			const auto copy = value;
+
+			Assert::IsTrue(&value.AsTable() == &copy.AsTable(), "Verify the table is shared.");
+		}
+
+		// [[Fact]]
+		void Copy_Table_Read_SharesContent()
+		{
+			auto value = Value(ValueTable(
+			{
+				{ "Key", Value(std::string("Value")) },
+			}));
+
+			// Reading a value that is not const must not copy the shared table
+			auto copy = value;
+			Assert::AreEqual(std::string("Value"), copy.AsTable().at("Key").AsString(), "Verify the value matches expected.");
+
+			Assert::IsTrue(&value.AsTable() == &copy.AsTable(), "Verify the table is still shared.");
+		}
+
+		// [[Fact]]
+		void Copy_Table_ModifyCopy_LeavesOriginal()
+		{
+			auto value = Value(ValueTable(
+			{
+				{ "Key", Value(std::string("Value")) },
+			}));
+
+			auto copy = value;
+			copy.AsMutableTable().insert_or_assign("Key", Value(std::string("Updated")));
+			copy.AsMutableTable().emplace("NewKey", Value(true));
+
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{ "Key", Value(std::string("Value")) },
+				}),
+				value.AsTable(),
+				"Verify the original is unchanged.");
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{ "Key", Value(std::string("Updated")) },
+					{ "NewKey", Value(true) },
+				}),
+				copy.AsTable(),
+				"Verify the copy is updated.");
+		}
+
+		// [[Fact]]
+		void Copy_NestedTable_ModifyNested_SharesSiblings()
+		{
+			auto value = Value(ValueTable(
+			{
+				{ "Changed", Value(ValueTable()) },
+				{ "Unchanged", Value(ValueList({ Value(static_cast<int64_t>(1)) })) },
+			}));
+
+			auto copy = value;
+			copy.AsMutableTable().at("Changed").AsMutableTable().emplace("Key", Value(true));
+
+			const auto& original = value.AsTable();
+			const auto& updated = copy.AsTable();
+			Assert::AreEqual(
+				ValueTable(),
+				original.at("Changed").AsTable(),
+				"Verify the original nested table is unchanged.");
+			Assert::AreEqual(
+				ValueTable(
+				{
+					{ "Key", Value(true) },
+				}),
+				updated.at("Changed").AsTable(),
+				"Verify the copy nested table is updated.");
+			Assert::IsTrue(
+				&original.at("Unchanged").AsList() == &updated.at("Unchanged").AsList(),
+				"Verify the unchanged list is still shared.");
+		}
+
+		// [[Fact]]
+		void Copy_List_ModifyCopy_LeavesOriginal()
+		{
+			auto value = Value(ValueList({ Value(std::string("First")) }));
+
+			auto copy = value;
+			copy.AsMutableList().push_back(Value(std::string("Second")));
+
+			Assert::AreEqual(
+				ValueList({ Value(std::string("First")) }),
+				value.AsList(),
+				"Verify the original is unchanged.");
+			Assert::AreEqual(
+				ValueList({ Value(std::string("First")), Value(std::string("Second")) }),
+				copy.AsList(),
+				"Verify the copy is updated.");
+		}
+	};
+}
@@ -0,0 +1,72 @@
+// <copyright file="WrenValueTableTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::UnitTests
+{
+	class WrenValueTableTests
+	{
+	public:
+		// [[Fact]]
+		void GetSlotTable_Unchanged_SharesPrevious()
+		{
+			const auto previous = Value(ValueTable(
+			{
+				{ "Float", Value(1.0) },
+				{ "List", Value(ValueList({ Value(std::string("Value")) })) },
+				{ "Unchanged", Value(ValueTable({ { "Key", Value(std::string("Value")) } })) },
+			}));
+
+			WrenConfiguration config;
+			wrenInitConfiguration(&config);
+			auto vm = wrenNewVM(&config);
+
+			WrenValueTable::SetSlotTable(vm, 0, previous.AsTable());
+			const auto actual = WrenValueTable::GetSlotTable(vm, 0, previous);
+
+			wrenFreeVM(vm);
+
+			Assert::AreEqual(previous.AsTable(), actual.AsTable(), "Verify the value matches expected.");
+			Assert::IsTrue(
+				&previous.AsTable() == &actual.AsTable(),
+				"Verify the unchanged table is shared.");
+		}
+
+		// [[Fact]]
+		void GetSlotTable_Changed_SharesUnchangedTables()
+		{
+			const auto previous = Value(ValueTable(
+			{
+				{ "Float", Value(1.0) },
+				{ "List", Value(ValueList({ Value(std::string("Value")) })) },
+				{ "Unchanged", Value(ValueTable({ { "Key", Value(std::string("Value")) } })) },
+			}));
+			const auto updated = ValueTable(
+			{
+				{ "Float", Value(2.0) },
+				{ "List", Value(ValueList({ Value(std::string("Value")) })) },
+				{ "Unchanged", Value(ValueTable({ { "Key", Value(std::string("Value")) } })) },
+			});
+
+			WrenConfiguration config;
+			wrenInitConfiguration(&config);
+			auto vm = wrenNewVM(&config);
+
+			WrenValueTable::SetSlotTable(vm, 0, updated);
+			const auto actual = WrenValueTable::GetSlotTable(vm, 0, previous);
+
+			wrenFreeVM(vm);
+
+			Assert::AreEqual(updated, actual.AsTable(), "Verify the value matches expected.");
+			Assert::AreEqual(1.0, previous.AsTable().at("Float").AsFloat(), "Verify the previous value is unchanged.");
+			Assert::IsTrue(
+				&previous.AsTable().at("Unchanged").AsTable() == &actual.AsTable().at("Unchanged").AsTable(),
+				"Verify the unchanged table is shared.");
+			Assert::IsTrue(
+				&previous.AsTable().at("List").AsList() == &actual.AsTable().at("List").AsList(),
+				"Verify the unchanged list is shared.");
+		}
+	};
+}
@@ -16,6 +16,12 @@ internal static class OperationGraphReader
 	// Binary Operation Graph file format
 	private static uint FileVersion => 6;
 
+	// Binary Operation Graph table file format written by the native build
+	private static uint TableFileVersion => 7;
+
+	// The number of values in a single table format operation record
+	private static int OperationRecordValueCount => 17;
+
 	public static OperationGraph Deserialize(System.IO.BinaryReader reader)
 	{
 		// Read the File Header with version
@@ -29,7 +35,11 @@ internal static class OperationGraphReader
 		}
 
 		var fileVersion = reader.ReadUInt32();
-		if (fileVersion != FileVersion)
+		if (fileVersion == TableFileVersion)
+		{
+			return DeserializeTable(reader);
+		}
+		else if (fileVersion != FileVersion)
 		{
 			throw new InvalidOperationException("Operation graph file version does not match expected");
 		}
@@ -97,6 +107,108 @@ internal static class OperationGraphReader
 			operations);
 	}
 
+	private static OperationGraph DeserializeTable(System.IO.BinaryReader reader)
+	{
+		// Read the shared string table
+		CheckHeader(reader, "STR", "Invalid operation graph strings header");
+		var stringCount = reader.ReadUInt32();
+		var stringDataSize = reader.ReadUInt32();
+		var stringRanges = new List<(int Offset, int Length)>((int)stringCount);
+		for (var i = 0; i < stringCount; i++)
+		{
+			stringRanges.Add(((int)reader.ReadUInt32(), (int)reader.ReadUInt32()));
+		}
+
+		var stringData = reader.ReadBytes((int)stringDataSize);
+		_ = reader.ReadBytes((int)((4 - (stringDataSize % 4)) % 4));
+		var strings = new List<string>((int)stringCount);
+		foreach (var (offset, length) in stringRanges)
+		{
+			strings.Add(System.Text.Encoding.UTF8.GetString(stringData, offset, length));
+		}
+
+		// Read the set of files
+		CheckHeader(reader, "FIS", "Invalid operation graph files header");
+		var fileCount = reader.ReadUInt32();
+		var files = new List<(FileId FileId, Path Path)>();
+		for (var i = 0; i < fileCount; i++)
+		{
+			var fileId = new FileId(reader.ReadUInt32());
+			var file = new Path(strings[(int)reader.ReadUInt32()]);
+
+			files.Add((fileId, file));
+		}
+
+		// Read the shared list values
+		CheckHeader(reader, "LST", "Invalid operation graph list values header");
+		var valueCount = reader.ReadUInt32();
+		var values = new uint[valueCount];
+		for (var i = 0; i < valueCount; i++)
+		{
+			values[i] = reader.ReadUInt32();
+		}
+
+		// Read the root operation ids
+		CheckHeader(reader, "ROP", "Invalid operation graph root operations header");
+		var rootOperationIds = ReadTableList(values, reader.ReadUInt32(), reader.ReadUInt32())
+			.ConvertAll(value => new OperationId(value));
+
+		// Read the fixed size operation records
+		CheckHeader(reader, "OPS", "Invalid operation graph operations header");
+		var operationCount = reader.ReadUInt32();
+		var operations = new List<OperationInfo>();
+		for (var i = 0; i < operationCount; i++)
+		{
+			var record = new uint[OperationRecordValueCount];
+			for (var j = 0; j < OperationRecordValueCount; j++)
+			{
+				record[j] = reader.ReadUInt32();
+			}
+
+			operations.Add(new OperationInfo(
+				new OperationId(record[0]),
+				strings[(int)record[1]],
+				new CommandInfo(
+					new Path(strings[(int)record[2]]),
+					new Path(strings[(int)record[3]]),
+					ReadTableList(values, record[4], record[5]).ConvertAll(value => strings[(int)value])),
+				ReadTableList(values, record[6], record[7]).ConvertAll(value => new FileId(value)),
+				ReadTableList(values, record[8], record[9]).ConvertAll(value => new FileId(value)),
+				ReadTableList(values, record[10], record[11]).ConvertAll(value => new FileId(value)),
+				ReadTableList(values, record[12], record[13]).ConvertAll(value => new FileId(value)),
+				ReadTableList(values, record[14], record[15]).ConvertAll(value => new OperationId(value)),
+				record[16]));
+		}
+
+		if (reader.BaseStream.Position != reader.BaseStream.Length)
+		{
+			var remaining = reader.BaseStream.Length - reader.BaseStream.Position;
+			throw new InvalidOperationException($"Operation graph file corrupted - Did not read the entire file {remaining}");
+		}
+
+		return new OperationGraph(
+			files,
+			rootOperationIds,
+			operations);
+	}
+
+	private static void CheckHeader(System.IO.BinaryReader reader, string expected, string message)
+	{
+		var headerBuffer = reader.ReadBytes(4);
+		if (headerBuffer[0] != expected[0] ||
+			headerBuffer[1] != expected[1] ||
+			headerBuffer[2] != expected[2] ||
+			headerBuffer[3] != '\0')
+		{
+			throw new InvalidOperationException(message);
+		}
+	}
+
+	private static List<uint> ReadTableList(uint[] values, uint offset, uint count)
+	{
+		return new List<uint>(new ArraySegment<uint>(values, (int)offset, (int)count));
+	}
+
 	private static OperationInfo ReadOperationInfo(System.IO.BinaryReader reader)
 	{
 		// Read the operation id
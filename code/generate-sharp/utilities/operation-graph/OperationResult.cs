@@ -17,12 +17,28 @@ public class OperationResult : IEquatable<OperationResult>
 		bool wasSuccessfulRun,
 		DateTime evaluateTime,
 		IList<FileId> observedInput,
-		IList<FileId> observedOutput)
+		IList<FileId> observedOutput) :
+		this(wasSuccessfulRun, evaluateTime, observedInput, observedOutput, new List<string>(), new List<string>())
+	{
+	}
+
+	/// <summary>
+	/// Initializes a new instance of the <see cref="OperationResult"/> class with the content digests of the observed files.
+	/// </summary>
+	public OperationResult(
+		bool wasSuccessfulRun,
+		DateTime evaluateTime,
+		IList<FileId> observedInput,
+		IList<FileId> observedOutput,
+		IList<string> observedInputDigests,
+		IList<string> observedOutputDigests)
 	{
 		this.WasSuccessfulRun = wasSuccessfulRun;
 		this.EvaluateTime = evaluateTime;
 		this.ObservedInput = observedInput;
 		this.ObservedOutput = observedOutput;
+		this.ObservedInputDigests = observedInputDigests;
+		this.ObservedOutputDigests = observedOutputDigests;
 	}
 
 	public bool Equals(OperationResult? other)
@@ -33,7 +49,9 @@ public class OperationResult : IEquatable<OperationResult>
 		var result = this.WasSuccessfulRun == other.WasSuccessfulRun &&
 			this.EvaluateTime == other.EvaluateTime &&
 			Enumerable.SequenceEqual(this.ObservedInput, other.ObservedInput) &&
-			Enumerable.SequenceEqual(this.ObservedOutput, other.ObservedOutput);
+			Enumerable.SequenceEqual(this.ObservedOutput, other.ObservedOutput) &&
+			Enumerable.SequenceEqual(this.ObservedInputDigests, other.ObservedInputDigests) &&
+			Enumerable.SequenceEqual(this.ObservedOutputDigests, other.ObservedOutputDigests);
 
 		return result;
 	}
@@ -64,4 +82,10 @@ public class OperationResult : IEquatable<OperationResult>
 	public DateTime EvaluateTime { get; init; }
 	public IList<FileId> ObservedInput { get; init; }
 	public IList<FileId> ObservedOutput { get; init; }
+
+	/// <summary>
+	/// The content digests of the observed files, empty when content digests were not enabled
+	/// </summary>
+	public IList<string> ObservedInputDigests { get; init; }
+	public IList<string> ObservedOutputDigests { get; init; }
 }
\ No newline at end of file
@@ -14,7 +14,10 @@ namespace Soup.Build.Utilities;
 internal static class OperationResultsReader
 {
 	// Binary Operation Results file format
-	private static uint FileVersion => 2;
+	private static uint FileVersion => 3;
+
+	// The previous file format without content digests that can still be read
+	private static uint NoDigestFileVersion => 2;
 
 	public static OperationResults Deserialize(System.IO.BinaryReader reader)
 	{
@@ -29,7 +32,7 @@ internal static class OperationResultsReader
 		}
 
 		var fileVersion = reader.ReadUInt32();
-		if (fileVersion != FileVersion)
+		if (fileVersion != FileVersion && fileVersion != NoDigestFileVersion)
 		{
 			throw new InvalidOperationException("Operation results file version does not match expected");
 		}
@@ -67,9 +70,10 @@ internal static class OperationResultsReader
 
 		var operationResultsCount = reader.ReadUInt32();
 		var operationResults = new Dictionary<OperationId, OperationResult>();
+		var hasDigests = fileVersion >= FileVersion;
 		for (var i = 0; i < operationResultsCount; i++)
 		{
-			var (operationId, operationResult) = ReadOperationInfo(reader);
+			var (operationId, operationResult) = ReadOperationInfo(reader, hasDigests);
 			operationResults.Add(operationId, operationResult);
 		}
 
@@ -84,7 +88,7 @@ internal static class OperationResultsReader
 			operationResults);
 	}
 
-	private static (OperationId, OperationResult) ReadOperationInfo(System.IO.BinaryReader reader)
+	private static (OperationId, OperationResult) ReadOperationInfo(System.IO.BinaryReader reader, bool hasDigests)
 	{
 		// Read the operation id
 		var id = new OperationId(reader.ReadUInt32());
@@ -101,11 +105,22 @@ internal static class OperationResultsReader
 		// Read the observed output files
 		var observedOutput = ReadFileIdList(reader);
 
+		// Read the optional content digests
+		var observedInputDigests = new List<string>();
+		var observedOutputDigests = new List<string>();
+		if (hasDigests)
+		{
+			observedInputDigests = ReadStringList(reader);
+			observedOutputDigests = ReadStringList(reader);
+		}
+
 		return (id, new OperationResult(
 			wasSuccessfulRun,
 			evaluateTime,
 			observedInput,
-			observedOutput));
+			observedOutput,
+			observedInputDigests,
+			observedOutputDigests));
 	}
 
 	private static bool ReadBoolean(System.IO.BinaryReader reader)
@@ -122,6 +137,18 @@ internal static class OperationResultsReader
 		return new string(result);
 	}
 
+	private static List<string> ReadStringList(System.IO.BinaryReader reader)
+	{
+		var size = reader.ReadUInt32();
+		var result = new List<string>((int)size);
+		for (var i = 0; i < size; i++)
+		{
+			result.Add(ReadString(reader));
+		}
+
+		return result;
+	}
+
 	private static List<FileId> ReadFileIdList(System.IO.BinaryReader reader)
 	{
 		var size = reader.ReadUInt32();
@@ -16,13 +16,47 @@ namespace Soup::Core::Generate
 	private:
 		std::map<std::string, ExtensionTaskDetails> _tasks;
 
+		// One interpreted Wren Host per script and bundles file, shared by discovery and every task of the package.
+		// Note: A host is never shared with another package, the VM keeps the static state the script set.
+		std::map<std::pair<std::string, std::string>, std::unique_ptr<GenerateHost>> _hosts;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref="ExtensionManager"/> class.
 		/// </summary>
 		ExtensionManager() :
-			_tasks()
+			_tasks(),
+			_hosts()
+		{
+		}
+
+		/// <summary>
+		/// Get every file that was loaded by the extension scripts
+		/// </summary>
+		std::vector<Path> GetLoadedFiles() const
+		{
+			auto result = std::vector<Path>();
+			for (auto& [key, host] : _hosts)
+			{
+				auto& loadedFiles = host->GetLoadedFiles();
+				result.insert(result.end(), loadedFiles.begin(), loadedFiles.end());
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Load an extension script and register all of the extension tasks it contains
+		/// </summary>
+		void RegisterExtensionScript(const Path& scriptFile, const std::optional<Path>& bundlesFile)
 		{
+			auto& host = EnsureHost(scriptFile, bundlesFile);
+			auto extensions = host.DiscoverExtensions();
+
+			for (auto& extension : extensions)
+			{
+				RegisterExtensionTask(std::move(extension));
+			}
 		}
 
 		/// <summary>
@@ -110,22 +144,21 @@ namespace Soup::Core::Generate
 				if (currentTask == nullptr)
 					throw std::runtime_error("TryFindNextTask returned empty result");
 
-				// Create a Wren Host to evaluate the extension task
-				auto host = std::make_unique<GenerateHost>(currentTask->ScriptFile, currentTask->BundlesFile);
-				host->InterpretMain();
+				// Reuse the Wren Host that already interpreted the extension script
+				auto& host = EnsureHost(currentTask->ScriptFile, currentTask->BundlesFile);
 
 				// Set the current state AFTER we initialize to prevent pre-loading
-				host->SetState(state);
+				host.SetState(state);
 
 				Log::Info("TaskStart: {}", currentTask->Name);
 
-				host->EvaluateTask(currentTask->Name);
+				host.EvaluateTask(currentTask->Name);
 
 				Log::Info("TaskDone: {}", currentTask->Name);
 
 				// Get the final state to be passed to the next extension
-				auto updatedActiveState = host->GetUpdatedActiveState();
-				auto updatedSharedState = host->GetUpdatedSharedState();
+				auto updatedActiveState = host.GetUpdatedActiveState();
+				auto updatedSharedState = host.GetUpdatedSharedState();
 
 				auto runBeforeList = ValueList();
 				for (const auto& value : currentTask->RunBeforeList)
@@ -139,10 +172,10 @@ namespace Soup::Core::Generate
 				for (const auto& value : currentTask->RunAfterClosureList)
 					runAfterClosureList.push_back(Value(value));
 
-				// Build the extension task info
+				// Build the extension task info, the states are shared with the generate state
 				auto extensionTaskInfo = ValueTable();
-				extensionTaskInfo.emplace("ActiveState", Value(updatedActiveState));
-				extensionTaskInfo.emplace("SharedState", Value(updatedSharedState));
+				extensionTaskInfo.emplace("ActiveState", updatedActiveState);
+				extensionTaskInfo.emplace("SharedState", updatedSharedState);
 				extensionTaskInfo.emplace("RunBeforeList", Value(std::move(runBeforeList)));
 				extensionTaskInfo.emplace("RunAfterList", Value(std::move(runAfterList)));
 				extensionTaskInfo.emplace("RunAfterClosureList", Value(std::move(runAfterClosureList)));
@@ -163,12 +196,31 @@ namespace Soup::Core::Generate
 			generateInfoTable.emplace("Version", Value("0.1"));
 			generateInfoTable.emplace("RuntimeOrder", Value(std::move(runtimeOrderList)));
 			generateInfoTable.emplace("TaskInfo", Value(std::move(extensionTaskInfoTable)));
-			generateInfoTable.emplace("GlobalState", Value(state.GetGlobalState()));
+			generateInfoTable.emplace("GlobalState", state.GetGlobalStateValue());
 
 			state.SetGenerateInfo(std::move(generateInfoTable));
 		}
 
 	private:
+		/// <summary>
+		/// Get the Wren Host for the script, creating and interpreting it the first time it is used
+		/// </summary>
+		GenerateHost& EnsureHost(const Path& scriptFile, const std::optional<Path>& bundlesFile)
+		{
+			auto key = std::make_pair(
+				scriptFile.ToString(),
+				bundlesFile.has_value() ? bundlesFile.value().ToString() : std::string());
+			auto findResult = _hosts.find(key);
+			if (findResult != _hosts.end())
+				return *findResult->second;
+
+			auto host = std::make_unique<GenerateHost>(scriptFile, bundlesFile);
+			host->InterpretMain();
+
+			auto insertResult = _hosts.emplace(std::move(key), std::move(host));
+			return *insertResult.first->second;
+		}
+
 		/// <summary>
 		/// Try to find the next task that has yet to be run and is ready
 		/// Returns false if all tasks have been run
@@ -0,0 +1,97 @@
+// <copyright file="GenerateCache.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::Generate
+{
+	/// <summary>
+	/// The state that is loaded once and shared by every generate request that runs in the same process.
+	/// Each entry remembers the write times of the files it was loaded from and is reloaded once any of them changes.
+	/// Note: The Wren hosts are not shared, a VM keeps the module variables and static fields a script set while it ran.
+	/// </summary>
+	class GenerateCache
+	{
+	private:
+		using FileWriteTimes = std::vector<std::pair<Path, std::optional<std::chrono::time_point<std::chrono::file_clock>>>>;
+
+		struct CachedLocalUserConfig
+		{
+			FileWriteTimes Files;
+			ValueList SdkParameters;
+			std::vector<Path> SdkReadAccess;
+		};
+
+		std::map<std::string, CachedLocalUserConfig> _localUserConfigs;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="GenerateCache"/> class.
+		/// </summary>
+		GenerateCache() :
+			_localUserConfigs()
+		{
+		}
+
+		/// <summary>
+		/// Get the sdk state that was loaded from the local user config, if the file has not changed since
+		/// </summary>
+		bool TryGetLocalUserConfig(
+			const Path& localUserConfigPath,
+			ValueList& sdkParameters,
+			std::vector<Path>& sdkReadAccess)
+		{
+			auto findResult = _localUserConfigs.find(localUserConfigPath.ToString());
+			if (findResult == _localUserConfigs.end() || !IsUnchanged(findResult->second.Files))
+				return false;
+
+			sdkParameters = findResult->second.SdkParameters;
+			sdkReadAccess = findResult->second.SdkReadAccess;
+			return true;
+		}
+
+		/// <summary>
+		/// Remember the sdk state that was loaded from the local user config
+		/// </summary>
+		void SetLocalUserConfig(
+			const Path& localUserConfigPath,
+			const ValueList& sdkParameters,
+			const std::vector<Path>& sdkReadAccess)
+		{
+			_localUserConfigs.insert_or_assign(
+				localUserConfigPath.ToString(),
+				CachedLocalUserConfig(GetWriteTimes({ localUserConfigPath }), sdkParameters, sdkReadAccess));
+		}
+
+	private:
+		static FileWriteTimes GetWriteTimes(const std::vector<Path>& files)
+		{
+			auto result = FileWriteTimes();
+			for (auto& file : files)
+				result.emplace_back(file, GetLastWriteTime(file));
+
+			return result;
+		}
+
+		static bool IsUnchanged(const FileWriteTimes& files)
+		{
+			for (auto& [file, lastWriteTime] : files)
+			{
+				if (GetLastWriteTime(file) != lastWriteTime)
+					return false;
+			}
+
+			return true;
+		}
+
+		static std::optional<std::chrono::time_point<std::chrono::file_clock>> GetLastWriteTime(const Path& file)
+		{
+			auto lastWriteTime = std::chrono::time_point<std::chrono::file_clock>();
+			if (!System::IFileSystem::Current().TryGetLastWriteTime(file, lastWriteTime))
+				return std::nullopt;
+
+			return lastWriteTime;
+		}
+	};
+}
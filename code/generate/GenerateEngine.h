@@ -4,6 +4,7 @@
 
 #pragma once
 #include "ExtensionManager.h"
+#include "GenerateCache.h"
 #include "GenerateState.h"
 
 namespace Soup::Core::Generate
@@ -11,11 +12,36 @@ namespace Soup::Core::Generate
 	class GenerateEngine
 	{
 	private:
+		GenerateCache& _cache;
 		FileSystemState _fileSystemState;
+
+		// The files that were read and written by the run
+		std::vector<Path> _readFiles;
+		std::vector<Path> _writeFiles;
+
 	public:
-		GenerateEngine() :
-			_fileSystemState()
+		GenerateEngine(GenerateCache& cache) :
+			_cache(cache),
+			_fileSystemState(),
+			_readFiles(),
+			_writeFiles()
+		{
+		}
+
+		/// <summary>
+		/// Get the files that were read by the run, the same inputs a monitored generate process would report
+		/// </summary>
+		const std::vector<Path>& GetReadFiles() const
+		{
+			return _readFiles;
+		}
+
+		/// <summary>
+		/// Get the files that were written by the run
+		/// </summary>
+		const std::vector<Path>& GetWriteFiles() const
 		{
+			return _writeFiles;
 		}
 
 		void Run(const Path& soupTargetDirectory)
@@ -25,6 +51,7 @@ namespace Soup::Core::Generate
 
 			// Load the input file
 			auto inputFile = soupTargetDirectory + BuildConstants::GenerateInputFileName();
+			_readFiles.push_back(inputFile);
 			auto inputTable = ValueTable();
 			if (!ValueTableManager::TryLoadState(inputFile, inputTable))
 			{
@@ -42,6 +69,7 @@ namespace Soup::Core::Generate
 
 			// Load the recipe file
 			auto recipeFile = packageRoot + BuildConstants::RecipeFileName();
+			_readFiles.push_back(recipeFile);
 			Recipe recipe;
 			if (!RecipeExtensions::TryLoadRecipeFromFile(recipeFile, recipe))
 			{
@@ -103,22 +131,22 @@ namespace Soup::Core::Generate
 			auto recipeState = RecipeBuildStateConverter::ConvertToBuildState(recipe.GetTable());
 			globalState.emplace("Recipe", Value(std::move(recipeState)));
 
-			// Initialize input global state
+			// Initialize input global state, the values share their tables with the input
 			for (auto& [key, value] : inputTable.at("GlobalState").AsTable())
 			{
-				globalState.emplace(key, std::move(value));
+				globalState.emplace(key, value);
 			}
 
 			// Merge the dependencies state
-			auto& globalDependenciesTable = globalState.at("Dependencies").AsTable();
+			auto& globalDependenciesTable = globalState.at("Dependencies").AsMutableTable();
 			for (auto& [dependencyType, dependencyTypeValue] : dependenciesSharedState)
 			{
-				auto& globalDependenciesType = globalDependenciesTable.at(dependencyType).AsTable();
+				auto& globalDependenciesType = globalDependenciesTable.at(dependencyType).AsMutableTable();
 				auto& sharedStateDependenciesType = dependencyTypeValue.AsTable();
 				for (auto& [dependencyName, dependencySharedState] : sharedStateDependenciesType)
 				{
-					auto& globalDependency = globalDependenciesType.at(dependencyName).AsTable();
-					globalDependency.emplace("SharedState", std::move(dependencySharedState));
+					auto& globalDependency = globalDependenciesType.at(dependencyName).AsMutableTable();
+					globalDependency.emplace("SharedState", dependencySharedState);
 				}
 			}
 
@@ -134,15 +162,8 @@ namespace Soup::Core::Generate
 					Log::Info("Bundles: {}", buildExtension.second.value().ToString());
 				}
 
-				// Create a temporary Wren Host to discover all build extensions
-				auto host = std::make_unique<GenerateHost>(buildExtension.first, buildExtension.second);
-				host->InterpretMain();
-				auto extensions = host->DiscoverExtensions();
-
-				for (auto& extension : extensions)
-				{
-					extensionManager.RegisterExtensionTask(std::move(extension));
-				}
+				// Discover all build extensions, the Wren Host is kept to evaluate them
+				extensionManager.RegisterExtensionScript(buildExtension.first, buildExtension.second);
 			}
 
 			// Evaluate the build extensions
@@ -153,6 +174,9 @@ namespace Soup::Core::Generate
 				evaluateAllowedWriteAccess);
 			extensionManager.Execute(buildState);
 
+			auto loadedFiles = extensionManager.GetLoadedFiles();
+			_readFiles.insert(_readFiles.end(), loadedFiles.begin(), loadedFiles.end());
+
 			// Grab the build results
 			auto generateInfoTable = buildState.GetGenerateInfo();
 			auto evaluateGraph = buildState.BuildOperationGraph();
@@ -162,6 +186,7 @@ namespace Soup::Core::Generate
 			auto generateInfoStateFile = soupTargetDirectory + BuildConstants::GenerateInfoFileName();
 			Log::Info("Save Generate Info State: {}", generateInfoStateFile.ToString());
 			ValueTableManager::SaveState(generateInfoStateFile, generateInfoTable);
+			_writeFiles.push_back(generateInfoStateFile);
 
 			// Resolve macros before saving evaluate graph
 			Log::Diag("Resolve build macros in evaluate graph");
@@ -170,10 +195,12 @@ namespace Soup::Core::Generate
 			// Save the operation graph so the evaluate phase can load it
 			auto evaluateGraphFile = soupTargetDirectory + BuildConstants::EvaluateGraphFileName();
 			OperationGraphManager::SaveState(evaluateGraphFile, evaluateGraph, _fileSystemState);
+			_writeFiles.push_back(evaluateGraphFile);
 
 			// Save the shared state that is to be passed to the downstream builds
 			auto sharedStateFile = soupTargetDirectory + BuildConstants::GenerateSharedStateFileName();
 			ValueTableManager::SaveState(sharedStateFile, sharedState);
+			_writeFiles.push_back(sharedStateFile);
 
 			Log::Diag("Build generate end");
 		}
@@ -182,13 +209,18 @@ namespace Soup::Core::Generate
 		/// <summary>
 		/// Load Local User Config and process any known state
 		/// </summary>
-		static void LoadLocalUserConfig(
+		void LoadLocalUserConfig(
 			const Path& userDataPath,
 			ValueList& sdkParameters,
 			std::vector<Path>& sdkReadAccess)
 		{
-			// Load the local user config
+			// Reuse the config that an earlier request in this process already loaded
 			auto localUserConfigPath = userDataPath + BuildConstants::LocalUserConfigFileName();
+			_readFiles.push_back(localUserConfigPath);
+			if (_cache.TryGetLocalUserConfig(localUserConfigPath, sdkParameters, sdkReadAccess))
+				return;
+
+			// Load the local user config
 			LocalUserConfig localUserConfig = {};
 			if (!LocalUserConfigExtensions::TryLoadLocalUserConfigFromFile(localUserConfigPath, localUserConfig))
 			{
@@ -225,13 +257,15 @@ namespace Soup::Core::Generate
 					sdkParameters.push_back(std::move(sdkParameter));
 				}
 			}
+
+			_cache.SetLocalUserConfig(localUserConfigPath, sdkParameters, sdkReadAccess);
 		}
 
 		/// <summary>
 		/// Using the parameters to resolve the dependency output folders, load up the shared state table and
 		/// combine them into a single value table to be used as input the this generate phase.
 		/// </summary>
-		static ValueTable LoadDependenciesSharedState(
+		ValueTable LoadDependenciesSharedState(
 			MacroManager& generateSubGraphMacroManager,
 			const ValueTable& inputTable)
 		{
@@ -256,6 +290,7 @@ namespace Soup::Core::Generate
 						auto& dependency = dependencyValue.AsTable();
 						auto soupTargetDirectory = Path(dependency.at("SoupTargetDirectory").AsString());
 						auto sharedStateFile = soupTargetDirectory + BuildConstants::GenerateSharedStateFileName();
+						_readFiles.push_back(sharedStateFile);
 
 						// Load the shared state file
 						auto sharedStateTable = ValueTable();
@@ -292,12 +327,12 @@ namespace Soup::Core::Generate
 			auto findResult = table.find(key);
 			if (findResult != table.end())
 			{
-				return findResult->second.AsTable();
+				return findResult->second.AsMutableTable();
 			}
 			else
 			{
 				auto insertResult = table.emplace(key, Value(ValueTable()));
-				return insertResult.first->second.AsTable();
+				return insertResult.first->second.AsMutableTable();
 			}
 		}
 
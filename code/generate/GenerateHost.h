@@ -25,6 +25,9 @@ namespace Soup::Core::Generate
 		void SetState(GenerateState& state)
 		{
 			_state = &state;
+
+			// The host is reused for every task in the script, drop the state loaded by the previous task
+			ResetSoupState();
 		}
 
 		std::vector<ExtensionTaskDetails> DiscoverExtensions()
@@ -85,7 +88,7 @@ namespace Soup::Core::Generate
 			WrenHelpers::ThrowIfFailed(wrenCall(_vm, evaluateMethodHandle));
 		}
 
-		ValueTable GetUpdatedActiveState()
+		Value GetUpdatedActiveState()
 		{
 			Log::Diag("GetUpdatedActiveState");
 			wrenEnsureSlots(_vm, 1);
@@ -98,14 +101,19 @@ namespace Soup::Core::Generate
 
 			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
 
-			// Call ActiveState
-			auto activeStateGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "activeState"));
+			// Call ActiveState without loading it
+			auto activeStateGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "loadedActiveState_"));
 			wrenSetSlotHandle(_vm, 0, soupClassHandle);
 			WrenHelpers::ThrowIfFailed(wrenCall(_vm, activeStateGetterHandle));
 
+			// The task did not access the state, it is unchanged
+			const auto& previousState = _state->GetActiveStateValue();
+			if (wrenGetSlotType(_vm, 0) == WREN_TYPE_NULL)
+				return previousState;
+
 			try
 			{
-				auto result = WrenValueTable::GetSlotTable(_vm, 0);
+				auto result = WrenValueTable::GetSlotTable(_vm, 0, previousState);
 				return result;
 			}
 			catch(const InvalidTypeException& exception)
@@ -117,7 +125,7 @@ namespace Soup::Core::Generate
 			}
 		}
 
-		ValueTable GetUpdatedSharedState()
+		Value GetUpdatedSharedState()
 		{
 			Log::Diag("GetUpdatedSharedState");
 			wrenEnsureSlots(_vm, 1);
@@ -130,14 +138,19 @@ namespace Soup::Core::Generate
 
 			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
 
-			// Call SharedState
-			auto sharedStateGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "sharedState"));
+			// Call SharedState without loading it
+			auto sharedStateGetterHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "loadedSharedState_"));
 			wrenSetSlotHandle(_vm, 0, soupClassHandle);
 			WrenHelpers::ThrowIfFailed(wrenCall(_vm, sharedStateGetterHandle));
 
+			// The task did not access the state, it is unchanged
+			const auto& previousState = _state->GetSharedStateValue();
+			if (wrenGetSlotType(_vm, 0) == WREN_TYPE_NULL)
+				return previousState;
+
 			try
 			{
-				auto result = WrenValueTable::GetSlotTable(_vm, 0);
+				auto result = WrenValueTable::GetSlotTable(_vm, 0, previousState);
 				return result;
 			}
 			catch(const InvalidTypeException& exception)
@@ -150,6 +163,22 @@ namespace Soup::Core::Generate
 		}
 
 	private:
+		void ResetSoupState()
+		{
+			// Nothing to reset if the script never imported the soup module
+			if (!wrenHasModule(_vm, SoupModuleName))
+				return;
+
+			wrenEnsureSlots(_vm, 1);
+			wrenGetVariable(_vm, SoupModuleName, SoupClassName, 0);
+			auto soupClassHandle = SmartHandle(_vm, wrenGetSlotHandle(_vm, 0));
+
+			// Call ResetState
+			auto resetStateHandle = SmartHandle(_vm, wrenMakeCallHandle(_vm, "resetState_()"));
+			wrenSetSlotHandle(_vm, 0, soupClassHandle);
+			WrenHelpers::ThrowIfFailed(wrenCall(_vm, resetStateHandle));
+		}
+
 		virtual bool IsBuiltInModule(std::string_view moduleName) override final
 		{
 			if (moduleName == std::string_view(SoupModuleName))
@@ -441,6 +470,16 @@ namespace Soup::Core::Generate
 			"		createOperation_(title, executable, arguments, workingDirectory, declaredInput, declaredOutput)\n"
 			"	}\n"
 			"\n"
+			"	static loadedActiveState_ { __activeState }\n"
+			"\n"
+			"	static loadedSharedState_ { __sharedState }\n"
+			"\n"
+			"	static resetState_() {\n"
+			"		__globalState = null\n"
+			"		__activeState = null\n"
+			"		__sharedState = null\n"
+			"	}\n"
+			"\n"
 			"	static info(message) {\n"
 			"		if (!(message is String)) Fiber.abort(\"Message must be a string.\")\n"
 			"		info_(message)\n"
@@ -0,0 +1,99 @@
+// <copyright file="GenerateServer.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "GenerateEngine.h"
+
+namespace Soup::Core::Generate
+{
+	/// <summary>
+	/// Runs the generate requests of a build in a single long lived process so the loaded sdk config is shared by every
+	/// package. Each package still interprets its extension scripts in its own Wren hosts.
+	/// Each request is a soup target directory on its own line of the standard input. The log output is written to the
+	/// standard output as usual and is flushed before the response is written to the response handle, so the client
+	/// has all of the output of a request once its response arrives. The response lists the files the request read and
+	/// wrote, which replaces the monitor of a generate process.
+	/// </summary>
+	class GenerateServer
+	{
+	private:
+		int _responseHandle;
+		GenerateCache _cache;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref="GenerateServer"/> class.
+		/// </summary>
+		GenerateServer(int responseHandle) :
+			_responseHandle(responseHandle),
+			_cache()
+		{
+		}
+
+		/// <summary>
+		/// Run requests until the client closes the standard input
+		/// </summary>
+		void Run()
+		{
+			auto request = std::string();
+			while (std::getline(std::cin, request))
+			{
+				auto response = RunRequest(Path(request));
+
+				std::cout.flush();
+				std::cerr.flush();
+				fflush(stdout);
+				fflush(stderr);
+
+				WriteResponse(response);
+			}
+		}
+
+	private:
+		std::string RunRequest(const Path& soupTargetDirectory)
+		{
+			auto generateEngine = GenerateEngine(_cache);
+			int exitCode = 0;
+			try
+			{
+				generateEngine.Run(soupTargetDirectory);
+			}
+			catch (const std::exception& ex)
+			{
+				Log::Error(ex.what());
+				exitCode = -1;
+			}
+
+			auto response = std::stringstream();
+			response << "Exit: " << exitCode << "\n";
+			for (auto& file : generateEngine.GetReadFiles())
+			{
+				auto exists = System::IFileSystem::Current().Exists(file);
+				response << (exists ? "Input: " : "MissingInput: ") << file.ToString() << "\n";
+			}
+
+			for (auto& file : generateEngine.GetWriteFiles())
+				response << "Output: " << file.ToString() << "\n";
+
+			response << "End\n";
+			return response.str();
+		}
+
+		void WriteResponse(std::string_view response)
+		{
+			while (!response.empty())
+			{
+				auto writeCount = write(_responseHandle, response.data(), response.size());
+				if (writeCount < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					throw std::runtime_error(std::format("Failed to write generate response {}", errno));
+				}
+
+				response.remove_prefix(writeCount);
+			}
+		}
+	};
+}
@@ -13,9 +13,10 @@ namespace Soup::Core::Generate
 	class GenerateState
 	{
 	private:
-		ValueTable _globalState;
-		ValueTable _activeState;
-		ValueTable _sharedState;
+		// The states are held as values so they share their tables with the task info instead of copying them
+		Value _globalState;
+		Value _activeState;
+		Value _sharedState;
 		ValueTable _generateInfo;
 		OperationGraphGenerator _graphGenerator;
 
@@ -29,8 +30,8 @@ namespace Soup::Core::Generate
 			std::vector<Path> readAccessList,
 			std::vector<Path> writeAccessList) :
 			_globalState(std::move(globalState)),
-			_activeState(),
-			_sharedState(),
+			_activeState(ValueTable()),
+			_sharedState(ValueTable()),
 			_generateInfo(),
 			_graphGenerator(fileSystemState, std::move(readAccessList), std::move(writeAccessList))
 		{
@@ -40,6 +41,14 @@ namespace Soup::Core::Generate
 		/// Get a reference to the global state
 		/// </summary>
 		const ValueTable& GetGlobalState() const
+		{
+			return _globalState.AsTable();
+		}
+
+		/// <summary>
+		/// Get the global state as a value that shares the table
+		/// </summary>
+		const Value& GetGlobalStateValue() const
 		{
 			return _globalState;
 		}
@@ -48,6 +57,14 @@ namespace Soup::Core::Generate
 		/// Get a reference to the active state
 		/// </summary>
 		const ValueTable& GetActiveState() const
+		{
+			return _activeState.AsTable();
+		}
+
+		/// <summary>
+		/// Get the active state as a value that shares the table
+		/// </summary>
+		const Value& GetActiveStateValue() const
 		{
 			return _activeState;
 		}
@@ -57,6 +74,14 @@ namespace Soup::Core::Generate
 		/// moved into the active state of any parent build that has a direct reference to this build.
 		/// </summary>
 		const ValueTable& GetSharedState() const
+		{
+			return _sharedState.AsTable();
+		}
+
+		/// <summary>
+		/// Get the shared state as a value that shares the table
+		/// </summary>
+		const Value& GetSharedStateValue() const
 		{
 			return _sharedState;
 		}
@@ -102,7 +127,11 @@ namespace Soup::Core::Generate
 				std::move(declaredOutputPaths));
 		}
 
-		void Update(ValueTable activeState, ValueTable sharedState)
+		/// <summary>
+		/// Update the state with the values read back from Wren after a task ran
+		/// Note: The state only ever holds values read back from Wren so it can be compared directly with the next read
+		/// </summary>
+		void Update(Value activeState, Value sharedState)
 		{
 			_activeState = std::move(activeState);
 			_sharedState = std::move(sharedState);
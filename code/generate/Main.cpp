@@ -6,6 +6,7 @@
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <iostream>
 #include <map>
 #include <optional>
 #include <set>
@@ -14,6 +15,10 @@
 #include <sstream>
 #include <vector>
 
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
 #ifdef SOUP_BUILD
 
 // TODO import
@@ -84,6 +89,9 @@ using namespace Opal;
 #endif
 
 #include "GenerateEngine.h"
+#if defined(__linux__)
+#include "GenerateServer.h"
+#endif
 
 int main(int argc, char** argv)
 {
@@ -113,6 +121,20 @@ int main(int argc, char** argv)
 
 		Log::Diag("ProgramStart");
 
+		// Run every request of the build in this process when started as a generate server
+		if (argc == 3 && std::string_view(argv[1]) == "-server")
+		{
+#if defined(__linux__)
+			auto responseHandle = std::stoi(argv[2]);
+			auto server = Soup::Core::Generate::GenerateServer(responseHandle);
+			server.Run();
+			return 0;
+#else
+			Log::Error("The generate server is not supported on this platform.");
+			return -1;
+#endif
+		}
+
 		if (argc != 2)
 		{
 			Log::Error("Invalid parameters. Expected one parameter.");
@@ -120,7 +142,8 @@ int main(int argc, char** argv)
 		}
 
 		auto soupTargetDirectory = Path(argv[1]);
-		auto generateEngine = Soup::Core::Generate::GenerateEngine();
+		auto cache = Soup::Core::Generate::GenerateCache();
+		auto generateEngine = Soup::Core::Generate::GenerateEngine(cache);
 		generateEngine.Run(soupTargetDirectory);
 	}
 	catch (const std::exception& ex)
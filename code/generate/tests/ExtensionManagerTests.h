@@ -0,0 +1,70 @@
+// <copyright file="ExtensionManagerTests.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Soup::Core::Generate::UnitTests
+{
+	class ExtensionManagerTests
+	{
+	public:
+		// [[Fact]]
+		void Execute_SeparatePackages_DoNotShareStaticState()
+		{
+			// Register the test listener
+			auto testListener = std::make_shared<TestTraceListener>();
+			auto scopedTraceListener = ScopedTraceListenerRegister(testListener);
+
+			// Register the test file system
+			auto fileSystem = std::make_shared<MockFileSystem>();
+			auto scopedFileSystem = ScopedFileSystemRegister(fileSystem);
+
+			// The Wren host reads the script directly from disk
+			auto scriptDirectory = std::filesystem::temp_directory_path() / "SoupExtensionManagerTests";
+			std::filesystem::create_directories(scriptDirectory);
+			auto scriptFile = scriptDirectory / "Extension.wren";
+			{
+				auto file = std::ofstream(scriptFile);
+				file <<
+					"import \"soup\" for Soup, SoupTask\n"
+					"\n"
+					"class CountTask is SoupTask {\n"
+					"	static evaluate() {\n"
+					"		__count = __count == null ? 1 : __count + 1\n"
+					"		Soup.info(\"Count %(__count)\")\n"
+					"	}\n"
+					"}\n";
+			}
+
+			// Generate two packages that use the same extension script
+			auto fileSystemState = FileSystemState();
+			for (auto package = 0; package < 2; package++)
+			{
+				auto uut = ExtensionManager();
+				uut.RegisterExtensionScript(Path(scriptFile.generic_string()), std::nullopt);
+
+				auto state = GenerateState(ValueTable(), fileSystemState, {}, {});
+				uut.Execute(state);
+			}
+
+			std::filesystem::remove_all(scriptDirectory);
+
+			// Verify the static field set by the first package is not seen by the second
+			auto countMessages = std::vector<std::string>();
+			for (auto& message : testListener->GetMessages())
+			{
+				if (message.starts_with("INFO: Count"))
+					countMessages.push_back(message);
+			}
+
+			Assert::AreEqual(
+				std::vector<std::string>({
+					"INFO: Count 1",
+					"INFO: Count 1",
+				}),
+				countMessages,
+				"Verify log messages match expected.");
+		}
+	};
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "ExtensionManagerTests.h"
+
+TestState RunExtensionManagerTests() 
+ {
+	auto className = "ExtensionManagerTests";
+	auto testClass = std::make_shared<Soup::Core::Generate::UnitTests::ExtensionManagerTests>();
+	TestState state = { 0, 0 };
+	state += Soup::Test::RunTest(className, "Execute_SeparatePackages_DoNotShareStaticState", [&testClass]() { testClass->Execute_SeparatePackages_DoNotShareStaticState(); });
+
+	return state;
+}
@@ -0,0 +1,44 @@
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <map>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "wren/wren.h"
+
+import Opal;
+import Soup.Core;
+import Soup.Test.Assert;
+
+using namespace Opal;
+using namespace Opal::System;
+using namespace Soup::Test;
+
+#include "../../ExtensionManager.h"
+
+#include "ExtensionManagerTests.gen.h"
+
+int main()
+{
+	std::cout << "Running Tests..." << std::endl;
+
+	TestState state = { 0, 0 };
+
+	state += RunExtensionManagerTests();
+
+	std::cout << state.PassCount << " PASSED." << std::endl;
+	std::cout << state.FailCount << " FAILED." << std::endl;
+
+	if (state.FailCount > 0)
+		return 1;
+	else
+		return 0;
+}
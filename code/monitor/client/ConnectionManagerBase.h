@@ -8,13 +8,32 @@ namespace Monitor
 	class ConnectionManagerBase
 	{
 	private:
+		static constexpr uint32_t MaxPendingMessages = 32;
+
+		/// <summary>
+		/// The messages that were written before the connection exists
+		/// </summary>
+		struct PendingMessages
+		{
+			Message Messages[MaxPendingMessages];
+			uint32_t Count;
+			uint32_t DroppedCount;
+		};
+
+		// Constant initialized so the constructor, which may run after another library called an override, keeps them
+		static inline constinit PendingMessages pendingMessages = {};
+
 		std::mutex pipeMutex;
 		bool hadError;
 
+		// Zero before the static constructor runs, an override may be called from the constructor of another library
+		bool isConnected;
+
 	public:
 		ConnectionManagerBase() :
 			pipeMutex(),
-			hadError(false)
+			hadError(false),
+			isConnected(false)
 		{
 			DebugTrace("ConnectionManagerBase::ConnectionManagerBase");
 		}
@@ -25,6 +44,7 @@ namespace Monitor
 			{
 				auto lock = std::lock_guard<std::mutex>(pipeMutex);
 				Connect(traceProcessId);
+				isConnected = true;
 			}
 
 			// Notify that we are connected
@@ -32,6 +52,23 @@ namespace Monitor
 			message.Type = MessageType::Initialize;
 			message.ContentSize = 0;
 			WriteMessage(message);
+
+			// Send the events that happened before the connection existed
+			auto lock = std::lock_guard<std::mutex>(pipeMutex);
+			for (uint32_t i = 0; i < pendingMessages.Count; i++)
+			{
+				if (!TryUnsafeWriteMessage(pendingMessages.Messages[i]))
+					hadError = true;
+			}
+
+			if (pendingMessages.DroppedCount != 0)
+			{
+				DebugError("Dropped messages before connect", pendingMessages.DroppedCount);
+				hadError = true;
+			}
+
+			pendingMessages.Count = 0;
+			pendingMessages.DroppedCount = 0;
 		}
 
 		void Shutdown()
@@ -54,6 +91,17 @@ namespace Monitor
 		void WriteMessage(const Message& message)
 		{
 			auto lock = std::lock_guard<std::mutex>(pipeMutex);
+			if (!isConnected)
+			{
+				// Keep the message until the connection exists, the shutdown reports any that did not fit
+				if (pendingMessages.Count < MaxPendingMessages)
+					pendingMessages.Messages[pendingMessages.Count++] = message;
+				else
+					pendingMessages.DroppedCount++;
+
+				return;
+			}
+
 			if (!TryUnsafeWriteMessage(message))
 			{
 				// Save the failure for the final response
@@ -2,14 +2,18 @@
 // TODO: Warning unsafe method
 #define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <locale>
 #include <codecvt>
 #include <format>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <sstream>
+#include <unordered_set>
 #include <vector>
 #include <cctype>
 
@@ -31,8 +35,10 @@
 
 #include <dlfcn.h>
 #include <fcntl.h>
+#include <sched.h>
 #include <stdarg.h>
 #include <unistd.h>
+#include <sys/mman.h>
 
 #endif
 
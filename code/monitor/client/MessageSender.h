@@ -8,9 +8,11 @@ namespace Monitor
 	{
 	private:
 		Message message;
+		bool isCanceled;
 
 	public:
-		MessageSender(MessageType type)
+		MessageSender(MessageType type) :
+			isCanceled(false)
 		{
 			message.Type = type;
 			message.ContentSize = 0;
@@ -18,7 +20,14 @@ namespace Monitor
 
 		~MessageSender()
 		{
-			connectionManager.WriteMessage(message);
+			if (!isCanceled)
+				connectionManager.WriteMessage(message);
+		}
+
+		/// Drop the message when the event is already known to the host
+		void Cancel()
+		{
+			isCanceled = true;
 		}
 
 		void AppendValue(const char* value)
@@ -9,17 +9,21 @@ namespace Monitor::Linux
 	{
 		// FileApi
 		Functions::Cache::FileApi::open = (open_ptr)dlsym(RTLD_NEXT, "open");
+		Functions::Cache::FileApi::open64 = (open64_ptr)dlsym(RTLD_NEXT, "open64");
 		Functions::Cache::FileApi::creat = (creat_ptr)dlsym(RTLD_NEXT, "creat");
 		Functions::Cache::FileApi::openat = (openat_ptr)dlsym(RTLD_NEXT, "openat");
+		Functions::Cache::FileApi::openat64 = (openat64_ptr)dlsym(RTLD_NEXT, "openat64");
 		Functions::Cache::FileApi::link = (link_ptr)dlsym(RTLD_NEXT, "link");
 		Functions::Cache::FileApi::linkat = (linkat_ptr)dlsym(RTLD_NEXT, "linkat");
 		Functions::Cache::FileApi::rename = (rename_ptr)dlsym(RTLD_NEXT, "rename");
 		Functions::Cache::FileApi::unlink = (unlink_ptr)dlsym(RTLD_NEXT, "unlink");
 		Functions::Cache::FileApi::remove = (remove_ptr)dlsym(RTLD_NEXT, "remove");
 		Functions::Cache::FileApi::fopen = (fopen_ptr)dlsym(RTLD_NEXT, "fopen");
+		Functions::Cache::FileApi::fopen64 = (fopen64_ptr)dlsym(RTLD_NEXT, "fopen64");
 		Functions::Cache::FileApi::fdopen = (fdopen_ptr)dlsym(RTLD_NEXT, "fdopen");
 		Functions::Cache::FileApi::freopen = (freopen_ptr)dlsym(RTLD_NEXT, "freopen");
 		Functions::Cache::FileApi::mkdir = (mkdir_ptr)dlsym(RTLD_NEXT, "mkdir");
+		Functions::Cache::FileApi::rmdir = (rmdir_ptr)dlsym(RTLD_NEXT, "rmdir");
 
 		// ProcessApi
 		Functions::Cache::ProcessApi::system = (system_ptr)dlsym(RTLD_NEXT, "system");
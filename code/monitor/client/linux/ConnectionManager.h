@@ -10,54 +10,94 @@ namespace Monitor::Linux
 	public:
 		ConnectionManager() :
 		 	ConnectionManagerBase(),
-			pipeHandle()
+			ring(),
+			eventHandle(-1),
+			isRingLost(false),
+			immutableReadFilter()
 		{
 		}
 
+		/// <summary>
+		/// Check if a read only open of a file that cannot change during the build does not need to be reported
+		/// </summary>
+		bool CanSkipRead(const char* path, bool exists)
+		{
+			return path != nullptr && immutableReadFilter.CanSkipRead(path, exists);
+		}
+
 	protected:
 		virtual void Connect(int32_t traceProcessId)
 		{
 			DebugTrace("ConnectionManager::Connect");
 
-			auto pipeName = std::string("/tmp/soupbuildfifo");
-			pipeHandle = Functions::Cache::FileApi::open(pipeName.c_str(), O_WRONLY);
+			auto immutableDirectoriesValue = getenv(ImmutableReadFilter::DirectoriesVariable);
+			if (immutableDirectoriesValue != nullptr)
+				immutableReadFilter.Initialize(immutableDirectoriesValue);
+
+			// The host passes the shared memory ring down to every monitored process.
+			// Note: There is no other way to reach the host, an unmonitored process must not run silently.
+			auto memoryHandleValue = getenv(MessageRing::MemoryHandleVariable);
+			auto eventHandleValue = getenv(MessageRing::EventHandleVariable);
+			if (memoryHandleValue == nullptr || eventHandleValue == nullptr)
+				throw std::runtime_error("The monitor client was loaded without the message ring of a host");
+
+			auto memoryHandle = atoi(memoryHandleValue);
+			auto mapping = mmap(nullptr, MessageRing::MappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, memoryHandle, 0);
+			if (mapping == MAP_FAILED)
+				throw std::runtime_error("Failed to map the message ring");
+
+			ring = std::make_unique<MessageRing>(mapping);
+			eventHandle = atoi(eventHandleValue);
 		}
 
 		virtual void Disconnect()
 		{
 			DebugTrace("ConnectionManager::Disconnect");
-			close(pipeHandle);
+
+			// Keep the ring mapped, the process may still report events while it shuts down
 		}
 
 		virtual bool TryUnsafeWriteMessage(const Message& message)
 		{
 			DebugTrace("ConnectionManager::TryUnsafeWriteMessage");
 
-			// Write the message
-			size_t countBytesToWrite = message.ContentSize +
-				sizeof(Message::Type) +
-				sizeof(Message::ContentSize);
-			auto countBytesWritten = write(
-				pipeHandle,
-				&message,
-				countBytesToWrite);
-			if (countBytesWritten == -1)
-			{
-				DebugError("Failed write event logger");
+			if (ring == nullptr || isRingLost)
 				return false;
-			}
 
-			if (countBytesWritten != countBytesToWrite)
+			// Wait for the host to make room when the ring is full
+			while (!ring->TryWrite(message))
 			{
-				DebugError("Did not write the expected number of bytes");
-				return false;
+				// The host stopped reading, drop the message instead of waiting forever
+				if (ring->IsClosed())
+				{
+					DebugError("The message ring was closed by the host");
+					isRingLost = true;
+					return false;
+				}
+
+				WakeReader();
+				sched_yield();
 			}
 
+			if (ring->TakeReaderWake())
+				WakeReader();
+
 			return true;
 		}
 
 	private:
-		int pipeHandle;
+		void WakeReader()
+		{
+			uint64_t value = 1;
+			if (write(eventHandle, &value, sizeof(value)) != sizeof(value))
+				DebugError("Failed to signal the message ring event");
+		}
+
+	private:
+		std::unique_ptr<MessageRing> ring;
+		int eventHandle;
+		bool isRingLost;
+		ImmutableReadFilter immutableReadFilter;
 	};
 }
 
@@ -37,6 +37,8 @@ namespace Monitor::Linux
 			}
 			catch (const std::exception& ex)
 			{
+				// The host may never see the error message, make sure the failure is visible
+				fprintf(stderr, "Soup monitor client failed to start: %s\n", ex.what());
 				{
 					auto message = MessageSender(MessageType::Error);
 					message.AppendValue(ex.what());
@@ -46,6 +48,7 @@ namespace Monitor::Linux
 			}
 			catch (...)
 			{
+				fprintf(stderr, "Soup monitor client failed to start\n");
 				{
 					auto message = MessageSender(MessageType::Error);
 					message.AppendValue("Unknown error attaching detours");
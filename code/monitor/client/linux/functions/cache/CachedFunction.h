@@ -0,0 +1,41 @@
+#pragma once
+
+namespace Monitor::Linux::Functions::Cache
+{
+	/// <summary>
+	/// The next definition of an overridden function. It is resolved on first use, so an override that is called
+	/// from the constructor of another library before the monitor client has started can still forward the call.
+	/// </summary>
+	template<typename TFunction>
+	class CachedFunction
+	{
+	private:
+		const char* _name;
+		std::atomic<TFunction> _function;
+
+	public:
+		constexpr CachedFunction(const char* name) :
+			_name(name),
+			_function(nullptr)
+		{
+		}
+
+		CachedFunction& operator=(TFunction function)
+		{
+			_function.store(function, std::memory_order_relaxed);
+			return *this;
+		}
+
+		operator TFunction()
+		{
+			auto function = _function.load(std::memory_order_relaxed);
+			if (function == nullptr)
+			{
+				function = reinterpret_cast<TFunction>(dlsym(RTLD_NEXT, _name));
+				_function.store(function, std::memory_order_relaxed);
+			}
+
+			return function;
+		}
+	};
+}
@@ -1,10 +1,13 @@
 #pragma once
+#include "CachedFunction.h"
 
 extern "C"
 {
 	typedef int (*open_ptr) (const char *path, int oflag, ... /* mode_t mode */ );
+	typedef int (*open64_ptr) (const char *path, int oflag, ... /* mode_t mode */ );
 	typedef int (*creat_ptr) (const char *pathname, mode_t mode);
 	typedef int (*openat_ptr) (int dirfd, const char *pathname, int flags, ... /* mode_t mode */ );
+	typedef int (*openat64_ptr) (int dirfd, const char *pathname, int flags, ... /* mode_t mode */ );
 	typedef int (*link_ptr) (const char *oldpath, const char *newpath);
 	typedef int (*linkat_ptr) (int olddirfd, const char *oldpath, int newdirfd, const char *newpath, int flags);
 	typedef int (*rename_ptr) (const char *oldpath, const char *newpath); 
@@ -12,6 +15,7 @@ extern "C"
 	typedef int (*remove_ptr) (const char *pathname);
 
 	typedef FILE* (*fopen_ptr) (const char * pathname, const char * mode);
+	typedef FILE* (*fopen64_ptr) (const char * pathname, const char * mode);
 	typedef FILE* (*fdopen_ptr) (int fd, const char *mode);
 	typedef FILE* (*freopen_ptr) (const char * pathname, const char * mode, FILE* stream);
 
@@ -21,19 +25,22 @@ extern "C"
 
 namespace Monitor::Linux::Functions::Cache::FileApi
 {
-	open_ptr open;
-	creat_ptr creat;
-	openat_ptr openat;
-	link_ptr link;
-	linkat_ptr linkat;
-	rename_ptr rename;
-	unlink_ptr unlink;
-	remove_ptr remove;
+	CachedFunction<open_ptr> open("open");
+	CachedFunction<open64_ptr> open64("open64");
+	CachedFunction<creat_ptr> creat("creat");
+	CachedFunction<openat_ptr> openat("openat");
+	CachedFunction<openat64_ptr> openat64("openat64");
+	CachedFunction<link_ptr> link("link");
+	CachedFunction<linkat_ptr> linkat("linkat");
+	CachedFunction<rename_ptr> rename("rename");
+	CachedFunction<unlink_ptr> unlink("unlink");
+	CachedFunction<remove_ptr> remove("remove");
 
-	fopen_ptr fopen;
-	fdopen_ptr fdopen;
-	freopen_ptr freopen;
+	CachedFunction<fopen_ptr> fopen("fopen");
+	CachedFunction<fopen64_ptr> fopen64("fopen64");
+	CachedFunction<fdopen_ptr> fdopen("fdopen");
+	CachedFunction<freopen_ptr> freopen("freopen");
 
-	mkdir_ptr mkdir;
-	rmdir_ptr rmdir;
+	CachedFunction<mkdir_ptr> mkdir("mkdir");
+	CachedFunction<rmdir_ptr> rmdir("rmdir");
 }
\ No newline at end of file
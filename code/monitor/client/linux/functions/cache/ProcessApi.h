@@ -1,4 +1,5 @@
 #pragma once
+#include "CachedFunction.h"
 
 extern "C"
 {
@@ -25,23 +26,23 @@ extern "C"
 
 namespace Monitor::Linux::Functions::Cache::ProcessApi
 {
-	system_ptr system;
+	CachedFunction<system_ptr> system("system");
 
-	fork_ptr fork;
-	vfork_ptr vfork;
+	CachedFunction<fork_ptr> fork("fork");
+	CachedFunction<vfork_ptr> vfork("vfork");
 
-	clone_ptr clone;
-	__clone2_ptr __clone2;
-	clone3_ptr clone3;
+	CachedFunction<clone_ptr> clone("clone");
+	CachedFunction<__clone2_ptr> __clone2("__clone2");
+	CachedFunction<clone3_ptr> clone3("clone3");
 
-	execl_ptr execl;
-	execlp_ptr execlp;
-	execle_ptr execle;
-	execv_ptr execv;
-	execvp_ptr execvp;
-	execvpe_ptr execvpe;
+	CachedFunction<execl_ptr> execl("execl");
+	CachedFunction<execlp_ptr> execlp("execlp");
+	CachedFunction<execle_ptr> execle("execle");
+	CachedFunction<execv_ptr> execv("execv");
+	CachedFunction<execvp_ptr> execvp("execvp");
+	CachedFunction<execvpe_ptr> execvpe("execvpe");
 
-	execve_ptr execve;
-	execveat_ptr execveat;
-	fexecve_ptr fexecve;
+	CachedFunction<execve_ptr> execve("execve");
+	CachedFunction<execveat_ptr> execveat("execveat");
+	CachedFunction<fexecve_ptr> fexecve("fexecve");
 }
\ No newline at end of file
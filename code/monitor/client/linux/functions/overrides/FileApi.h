@@ -29,6 +29,44 @@ int open(const char* path, int oflag, ... /* mode_t mode */ )
 	message.AppendValue(oflag);
 	message.AppendValue(result);
 
+	// Reads of files that cannot change during the build are only reported when the host needs them
+	if ((oflag & O_ACCMODE) == O_RDONLY && connectionManager.CanSkipRead(path, result >= 0))
+		message.Cancel();
+
+	return result;
+}
+
+// The large file variants are separate symbols that are reported as the same event
+int open64(const char* path, int oflag, ... /* mode_t mode */ )
+{
+	connectionManager.DebugTrace("open64");
+	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
+	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::open));
+
+	// TODO: Bigly hack since Clang does not support __builtin_va_arg_pack
+	// To whomever thought variadic optional parameters were a good idea. Why?
+	bool requiresMode = (oflag & O_CREAT) != 0 || (oflag & __O_TMPFILE) == __O_TMPFILE;
+	int result;
+	if (requiresMode)
+	{
+		va_list args;
+		va_start(args, oflag);
+		auto mode = va_arg(args, mode_t);
+		va_end(args);
+		result = Monitor::Linux::Functions::Cache::FileApi::open64(path, oflag, mode);
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::open64(path, oflag);
+	}
+
+	message.AppendValue(path);
+	message.AppendValue(oflag);
+	message.AppendValue(result);
+
+	if ((oflag & O_ACCMODE) == O_RDONLY && connectionManager.CanSkipRead(path, result >= 0))
+		message.Cancel();
+
 	return result;
 }
 
@@ -74,6 +112,44 @@ int openat(int dirfd, const char *pathname, int flags, ... /* mode_t mode */ )
 	message.AppendValue(flags);
 	message.AppendValue(result);
 
+	if ((flags & O_ACCMODE) == O_RDONLY && connectionManager.CanSkipRead(pathname, result >= 0))
+		message.Cancel();
+
+	return result;
+}
+
+// The large file variants are separate symbols that are reported as the same event
+int openat64(int dirfd, const char *pathname, int flags, ... /* mode_t mode */ )
+{
+	connectionManager.DebugTrace("openat64");
+	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
+	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::openat));
+
+	// TODO: Bigly hack since Clang does not support __builtin_va_arg_pack
+	// To whomever thought variadic optional parameters were a good idea. Why?
+	bool requiresMode = (flags & O_CREAT) != 0 || (flags & __O_TMPFILE) == __O_TMPFILE;
+	int result;
+	if (requiresMode)
+	{
+		va_list args;
+		va_start(args, flags);
+		auto mode = va_arg(args, mode_t);
+		va_end(args);
+		result = Monitor::Linux::Functions::Cache::FileApi::openat64(dirfd, pathname, flags, mode);
+	}
+	else
+	{
+		result = Monitor::Linux::Functions::Cache::FileApi::openat64(dirfd, pathname, flags);
+	}
+
+	message.AppendValue(dirfd);
+	message.AppendValue(pathname);
+	message.AppendValue(flags);
+	message.AppendValue(result);
+
+	if ((flags & O_ACCMODE) == O_RDONLY && connectionManager.CanSkipRead(pathname, result >= 0))
+		message.Cancel();
+
 	return result;
 }
 
@@ -165,6 +241,28 @@ FILE* fopen(const char * pathname, const char * mode)
 	message.AppendValue(mode);
 	message.AppendValue((uint64_t)result);
 
+	if (mode[0] == 'r' && strchr(mode, '+') == nullptr && connectionManager.CanSkipRead(pathname, result != nullptr))
+		message.Cancel();
+
+	return result;
+}
+
+// The large file variants are separate symbols that are reported as the same event
+FILE* fopen64(const char * pathname, const char * mode)
+{
+	connectionManager.DebugTrace("fopen64");
+	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
+	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::fopen));
+
+	auto result = Monitor::Linux::Functions::Cache::FileApi::fopen64(pathname, mode);
+
+	message.AppendValue(pathname);
+	message.AppendValue(mode);
+	message.AppendValue((uint64_t)result);
+
+	if (mode[0] == 'r' && strchr(mode, '+') == nullptr && connectionManager.CanSkipRead(pathname, result != nullptr))
+		message.Cancel();
+
 	return result;
 }
 
@@ -196,6 +294,7 @@ FILE* freopen(
 
 	message.AppendValue(pathname);
 	message.AppendValue(mode);
+	message.AppendValue((uint64_t)result);
 
 	return result;
 }
@@ -210,6 +309,7 @@ int mkdir(const char *path, mode_t mode)
 
 	message.AppendValue(path);
 	message.AppendValue(mode);
+	message.AppendValue(result);
 
 	return result;
 }
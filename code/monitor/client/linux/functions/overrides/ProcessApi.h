@@ -35,7 +35,9 @@ pid_t vfork()
 	auto message = Monitor::MessageSender(Monitor::MessageType::Detour);
 	message.AppendValue(static_cast<uint32_t>(Monitor::Linux::DetourEventType::vfork));
 
-	auto result = Monitor::Linux::Functions::Cache::ProcessApi::vfork();
+	// The child of a real vfork runs on this stack frame and returning from the wrapper would corrupt the parent.
+	// Fork instead, a vfork caller may only exec or exit in the child so it cannot tell the difference.
+	auto result = Monitor::Linux::Functions::Cache::ProcessApi::fork();
 
 	message.AppendValue(result);
 
@@ -4,6 +4,7 @@
 
 #pragma once
 #include "ISystemAccessMonitor.h"
+#include "IProcessOutputListener.h"
 
 namespace Monitor
 {
@@ -38,6 +39,7 @@ namespace Monitor
 	public:
 		/// <summary>
 		/// Creates a process for the provided executable path
+		/// The optional output listener receives the output as it is written instead of the process keeping it for the result
 		/// </summary>
 		virtual std::shared_ptr<Opal::System::IProcess> CreateMonitorProcess(
 			const Path& executable,
@@ -48,7 +50,8 @@ namespace Monitor
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
-			std::vector<Path> allowedWriteAccess) = 0;
+			std::vector<Path> allowedWriteAccess,
+			std::shared_ptr<IProcessOutputListener> outputListener) = 0;
 
 	private:
 		static std::shared_ptr<IMonitorProcessManager> _current;
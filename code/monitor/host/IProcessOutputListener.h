@@ -0,0 +1,22 @@
+﻿// <copyright file="IProcessOutputListener.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor
+{
+	/// <summary>
+	/// Receives the output of a monitored process while it is still running
+	/// Note: The chunks are not split on line boundaries and may be delivered from a thread owned by the process
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class IProcessOutputListener
+	{
+	public:
+		virtual void OnStandardOutput(std::string_view value) = 0;
+		virtual void OnStandardError(std::string_view value) = 0;
+	};
+}
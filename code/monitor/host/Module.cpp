@@ -26,7 +26,16 @@ module;
 #include <sys/reg.h>
 #include <sys/syscall.h>
 #include <sys/uio.h>
+#include <sys/socket.h>
 #include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <sys/epoll.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sched.h>
+#include <signal.h>
+#include <linux/filter.h>
+#include <linux/seccomp.h>
 #include <poll.h>
 #include <fcntl.h>
 #include <cstring>
@@ -51,10 +60,13 @@ extern char **environ;
 #include <filesystem>
 #include <format>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <locale>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <string>
 #include <sstream>
 #include <thread>
@@ -7,6 +7,8 @@
 #include "LinuxSystemLoggerMonitor.h"
 #include "LinuxSystemMonitorFork.h"
 #include "LinuxTraceEventListener.h"
+#include "LinuxProcessLauncher.h"
+#include "LinuxProcessOutputReader.h"
 
 namespace Monitor::Linux
 {
@@ -22,21 +24,22 @@ namespace Monitor::Linux
 		Path m_workingDirectory;
 		LinuxTraceEventListener m_eventListener;
 		bool m_partialMonitor;
+		std::shared_ptr<IProcessOutputListener> m_outputListener;
 
 		// Runtime
 		pid_t m_processId;
-		int m_stdOutReadHandle;
-		int m_stdErrReadHandle;
+		int m_exitHandle;
+		std::unique_ptr<LinuxProcessOutputReader> m_outputReader;
 
+		// The trace loop runs on the thread that started the process, the output is read on a worker thread
 		std::thread m_workerThread;
-		std::atomic<bool> m_processRunning;
 		std::atomic<bool> m_workerFailed;
 		std::exception_ptr m_workerException = nullptr;
 
 		// Result
 		bool m_isFinished;
-		std::stringstream m_stdOut;
-		std::stringstream m_stdErr;
+		std::string m_stdOut;
+		std::string m_stdErr;
 		int m_exitCode;
 
 	public:
@@ -48,7 +51,8 @@ namespace Monitor::Linux
 			std::vector<std::string> arguments,
 			const Path& workingDirectory,
 			std::shared_ptr<ISystemAccessMonitor> monitor,
-			bool partialMonitor) :
+			bool partialMonitor,
+			std::shared_ptr<IProcessOutputListener> outputListener) :
 			m_executable(executable),
 			m_arguments(std::move(arguments)),
 			m_workingDirectory(workingDirectory),
@@ -60,11 +64,11 @@ namespace Monitor::Linux
 			m_eventListener(std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor))),
 	#endif
 			m_partialMonitor(partialMonitor),
+			m_outputListener(std::move(outputListener)),
 			m_processId(),
-			m_stdOutReadHandle(),
-			m_stdErrReadHandle(),
+			m_exitHandle(-1),
+			m_outputReader(),
 			m_workerThread(),
-			m_processRunning(),
 			m_workerFailed(),
 			m_isFinished(false),
 			m_exitCode(-1)
@@ -76,55 +80,55 @@ namespace Monitor::Linux
 		/// </summary>
 		void Start() override final
 		{
-			// Set current working directory that will be inherited by the child process
-			auto currentWorkingDirectory = std::filesystem::current_path();
-			if (chdir(m_workingDirectory.ToString().c_str()) == -1)
-				throw std::runtime_error("Failed to set working directory");
-
 			// Create a pipe to send stdout to parent
+			// Note: Only the read end is non blocking, the child must be able to block on a full pipe
 			int stdOutPipe[2];
-			if (pipe2(stdOutPipe, O_NONBLOCK) < 0)
+			if (pipe2(stdOutPipe, O_CLOEXEC) < 0 || fcntl(stdOutPipe[0], F_SETFL, O_NONBLOCK) < 0)
 				throw std::runtime_error("Failed to create stdOutPipe");
 
 			// Create a pipe to send stderr to parent
 			int stdErrPipe[2];
-			if (pipe2(stdErrPipe, O_NONBLOCK) < 0)
+			if (pipe2(stdErrPipe, O_CLOEXEC) < 0 || fcntl(stdErrPipe[0], F_SETFL, O_NONBLOCK) < 0)
 				throw std::runtime_error("Failed to create stdErrPipe");
 
+			// Signaled once the root process exits to stop reading output left open by a descendant
+			m_exitHandle = eventfd(0, EFD_CLOEXEC);
+			if (m_exitHandle < 0)
+				throw std::runtime_error("Failed to create exit event");
+
 			// Create a child process
-			DebugTrace("Fork");
-			pid_t processId = fork();
-			if (processId == 0)
+			DebugTrace("Spawn");
+			auto launcher = LinuxProcessLauncher(m_executable, m_arguments, m_workingDirectory, LinuxSystemCallFilter::Trace);
+			m_processId = launcher.Spawn(stdOutPipe[1], stdErrPipe[1], -1);
+
+			// Close our handle on the write end
+			close(stdOutPipe[1]);
+			close(stdErrPipe[1]);
+			m_outputReader = std::make_unique<LinuxProcessOutputReader>(
+				stdOutPipe[0],
+				stdErrPipe[0],
+				m_exitHandle,
+				m_outputListener);
+
+			// Create the worker thread that reads the output while this thread traces the child process
+			m_workerFailed = false;
+			DebugTrace("Thread");
+			m_workerThread = std::thread(&LinuxMonitorProcess::OutputThread, std::ref(*this));
+
+			try
 			{
-				SetupChildProcess(stdOutPipe, stdErrPipe);
+				WorkerThread();
 			}
-			else
+			catch (...)
 			{
-				// Parent process still
-				DebugTrace("Parent");
-
-				// Reset working directory
-				if (chdir(currentWorkingDirectory.string().c_str()) == -1)
-					throw std::runtime_error("Failed to reset working directory");
-
-				m_processId = processId;
-
-				// Close our handle on the write end
-				close(stdOutPipe[1]);
-				close(stdErrPipe[1]);
-				m_stdOutReadHandle = stdOutPipe[0];
-				m_stdErrReadHandle = stdErrPipe[0];
-
-				// Create the worker thread that will monitor the child process
-				m_processRunning = true;
-				m_workerFailed = false;
-				DebugTrace("Thread");
-				// m_workerThread = std::thread(&LinuxMonitorProcess::WorkerThread, std::ref(*this));
-				
-				WorkerThread();
-
-				DebugTrace("Parent done");
+				SignalExit();
+				m_workerThread.join();
+				throw;
 			}
+
+			SignalExit();
+
+			DebugTrace("Parent done");
 		}
 
 		/// <summary>
@@ -132,18 +136,13 @@ namespace Monitor::Linux
 		/// </summary>
 		void WaitForExit() override final
 		{
-			// Wait until child process exits.
-			// m_workerThread.join();
-
-			m_processRunning = false;
-
-			ReadAvailableStdOut();
-			m_stdOut << std::flush;
-			close(m_stdOutReadHandle);
+			// Wait until all output is read
+			m_workerThread.join();
 
-			ReadAvailableStdErr();
-			m_stdErr << std::flush;
-			close(m_stdErrReadHandle);
+			m_stdOut = m_outputReader->TakeStandardOutput();
+			m_stdErr = m_outputReader->TakeStandardError();
+			m_outputReader = nullptr;
+			close(m_exitHandle);
 
 			m_isFinished = true;
 
@@ -170,7 +169,7 @@ namespace Monitor::Linux
 		{
 			if (!m_isFinished)
 				throw std::runtime_error("Process has not finished.");
-			return m_stdOut.str();
+			return m_stdOut;
 		}
 
 		/// <summary>
@@ -180,170 +179,28 @@ namespace Monitor::Linux
 		{
 			if (!m_isFinished)
 				throw std::runtime_error("Process has not finished.");
-			return m_stdErr.str();
+			return m_stdErr;
 		}
 
 	private:
-		void ReadAvailableStdOut()
+		void OutputThread()
 		{
-			// Read all and write to stdout
-			int dwRead;
-			const int BufferSize = 256;
-			char buffer[BufferSize + 1];
-
-			// Read on output
-			while (true)
+			try
 			{
-				dwRead = read(m_stdOutReadHandle, buffer, BufferSize);
-				if(dwRead < 0)
-					break;
-				if (dwRead == 0)
-					break;
-
-				m_stdOut << std::string_view(buffer, dwRead);
+				m_outputReader->ReadUntilWake();
 			}
-		}
-
-		void ReadAvailableStdErr()
-		{
-			// Read all and write to stdout
-			int dwRead;
-			const int BufferSize = 256;
-			char buffer[BufferSize + 1];
-
-			// Read all errors
-			while (true)
+			catch (...)
 			{
-				dwRead = read(m_stdErrReadHandle, buffer, BufferSize);
-				if(dwRead < 0)
-					break;
-				if (dwRead == 0)
-					break;
-
-				// Make the string null terminated
-				m_stdErr << std::string_view(buffer, dwRead);
+				m_workerException = std::current_exception();
+				m_workerFailed = true;
 			}
 		}
 
-		void SetupChildProcess(int stdOutPipe[2], int stdErrPipe[2])
+		void SignalExit()
 		{
-			try
-			{
-				// We are the child process
-				DebugTrace("Child");
-
-				// Close the read pipe
-				close(stdOutPipe[0]);
-				close(stdErrPipe[0]);
-
-				// Redirect stdout to the pipe write
-				if (dup2(stdOutPipe[1], STDOUT_FILENO) != STDOUT_FILENO)
-					throw std::runtime_error("dup2 error to stdout");
-
-				// Redirect stderr to the pipe write
-				if (dup2(stdErrPipe[1], STDERR_FILENO) != STDERR_FILENO)
-					throw std::runtime_error("dup2 error to stderr");
-
-				// Close our handle on the write end
-				close(stdOutPipe[1]);
-				close(stdErrPipe[1]);
-
-				auto environment = std::vector<std::string>();
-
-				environment.push_back("HOME=/");
-				environment.push_back("USER=USERNAME");
-				environment.push_back("PAHT=/usr/bin");
-
-				scmp_filter_ctx ctx;
-				try
-				{
-					scmp_filter_ctx ctx = seccomp_init(SCMP_ACT_ALLOW);
-					if (ctx == NULL)
-						throw std::runtime_error("seccomp_init failed");
-
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(open), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(openat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(openat2), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(creat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(link), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(linkat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(rename), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(renameat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(renameat2), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(unlink), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(mkdir), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(mkdirat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(rmdir), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(fork), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(vfork), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(clone), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(clone3), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-					// TODO: Allow first execve when the parent has not connected yet to allow it
-					// Maybe try to filter to the known exe and only allow that and trace others
-					// https://lore.kernel.org/lkml/20201029075841.GB29881@ircssh-2.c.rugged-nimbus-611.internal/T/
-					// if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(execve), 0) < 0)
-					// 	throw std::runtime_error("seccomp_rule_add failed");
-					if (seccomp_rule_add(ctx, SCMP_ACT_TRACE(1), SCMP_SYS(execveat), 0) < 0)
-						throw std::runtime_error("seccomp_rule_add failed");
-
-					if (seccomp_load(ctx) < 0)
-						throw std::runtime_error("seccomp_load failed");
-
-					seccomp_release(ctx);
-				}
-				catch(const std::exception& e)
-				{
-					// Ensure we cleanup nicely
-					seccomp_release(ctx);
-					throw;
-				}
-
-				ptrace(PTRACE_TRACEME, 0, NULL, NULL);
-
-				std::vector<const char*> arguments;
-				arguments.push_back(m_executable.ToString().c_str());
-				for (auto& argument : m_arguments)
-					arguments.push_back(argument.c_str());
-				arguments.push_back(nullptr);
-
-				auto environmentArray = std::vector<const char*>();
-				for (auto& value : environment)
-					environmentArray.push_back(value.c_str());
-				environmentArray.push_back(nullptr);
-
-				// Replace runtime with child program
-				DebugTrace("child exec");
-				auto result = execve(
-					m_executable.ToString().c_str(),
-					const_cast<char**>(arguments.data()),
-					const_cast<char**>(environmentArray.data()));
-				if (result == -1)
-					throw std::runtime_error("Failed to start child");
-			}
-			catch(const std::exception& e)
-			{
-				std::cerr << e.what() << '\n';
-				exit(1234);
-			}
-
-			// Running in other program now
+			uint64_t value = 1;
+			if (write(m_exitHandle, &value, sizeof(value)) != sizeof(value))
+				Log::Error("Failed to signal process exit");
 		}
 
 		/// <summary>
@@ -392,7 +249,8 @@ namespace Monitor::Linux
 
 		void WorkerThread()
 		{
-			Log::Diag("WorkerThread Start");
+			// Note: The output thread is already logging the streamed output
+			DebugTrace("WorkerThread Start");
 
 			auto activeProcesses = std::vector<ProcessTraceState>();
 			InitializeProcess(activeProcesses, m_processId);
@@ -428,10 +286,8 @@ namespace Monitor::Linux
 			if (ptrace(PTRACE_CONT, m_processId, NULL, NULL) < 0)
 				throw std::runtime_error(std::format("ptrace PTRACE_CONT failed {0}", errno));
 
-			int eventCount = 0;
 			while (true)
 			{
-				eventCount++;
 				DebugTrace("Waiting...");
 				currentProcessId = waitpid(-1, &status, __WALL);
 				int wait_errno = errno;
@@ -621,28 +477,18 @@ namespace Monitor::Linux
 						if (ptrace(PTRACE_CONT, currentProcessId, 0, 0) < 0)
 							throw std::runtime_error(std::format("ptrace PTRACE_CONT failed {0}", errno));
 					}
-
-					if (eventCount > 100)
-					{
-						// Read std out so the child does not fill the buffer
-						// TODO: Move to background thread so we do not block the child
-						ReadAvailableStdOut();
-						ReadAvailableStdErr();
-
-						eventCount = 0;
-					}
 				}
 			}
 		}
 
-		void DebugTrace(std::string_view message, uint32_t value)
+		static void DebugTrace(std::string_view message, uint32_t value)
 		{
 #ifdef TRACE_MONITOR_HOST
 			std::cout << "Monitor-HOST: " << message << " " << value << std::endl;
 #endif
 		}
 
-		void DebugTrace(std::string_view message)
+		static void DebugTrace(std::string_view message)
 		{
 #ifdef TRACE_MONITOR_HOST
 			std::cout << "Monitor-HOST: " << message << std::endl;
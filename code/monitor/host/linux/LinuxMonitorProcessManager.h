@@ -5,9 +5,33 @@
 #pragma once
 #include "../IMonitorProcessManager.h"
 #include "LinuxMonitorProcess.h"
+#include "LinuxNotifyMonitorProcess.h"
+#include "LinuxPreloadMonitorProcess.h"
+#include "LinuxSharedMonitorProcess.h"
 
 namespace Monitor::Linux
 {
+	/// <summary>
+	/// The mechanism used to monitor the file system access of a process
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	enum class LinuxMonitorBackend
+	{
+		// ptrace from the thread that starts the process, runs the process to completion inside Start
+		Trace,
+
+		// ptrace from a single tracer thread shared by all processes, allows processes to run at the same time
+		SharedTrace,
+
+		// seccomp user notification descriptor
+		Notify,
+
+		// LD_PRELOAD monitor client that reports through a shared memory ring, dynamically linked executables only
+		Preload,
+	};
+
 	/// <summary>
 	/// A Linux platform specific process executable using system
 	/// </summary>
@@ -16,14 +40,57 @@ namespace Monitor::Linux
 	#endif
 	class LinuxMonitorProcessManager : public IMonitorProcessManager
 	{
+	private:
+		LinuxMonitorBackend m_backend;
+		std::shared_ptr<LinuxSharedTracer> m_sharedTracer;
+		std::string m_immutableReadDirectories;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref='LinuxMonitorProcessManager'/> class.
 		/// </summary>
-		LinuxMonitorProcessManager()
+		LinuxMonitorProcessManager() :
+			LinuxMonitorProcessManager(LinuxMonitorBackend::Trace)
 		{
 		}
 
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxMonitorProcessManager'/> class.
+		/// </summary>
+		LinuxMonitorProcessManager(LinuxMonitorBackend backend) :
+			LinuxMonitorProcessManager(backend, GetDefaultImmutableReadDirectories())
+		{
+		}
+
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxMonitorProcessManager'/> class with the directories
+		/// that do not change during a build, repeated reads from them are only reported once per process
+		/// </summary>
+		LinuxMonitorProcessManager(LinuxMonitorBackend backend, const std::vector<std::string>& immutableReadDirectories) :
+			m_backend(backend),
+			m_sharedTracer(backend == LinuxMonitorBackend::SharedTrace ? std::make_shared<LinuxSharedTracer>() : nullptr),
+			m_immutableReadDirectories(ImmutableReadFilter::CombineDirectories(immutableReadDirectories))
+		{
+		}
+
+		/// <summary>
+		/// The system toolchain and library directories
+		/// </summary>
+		static std::vector<std::string> GetDefaultImmutableReadDirectories()
+		{
+			return std::vector<std::string>({
+				"/usr/include/",
+				"/usr/lib/",
+				"/usr/lib64/",
+				"/usr/libexec/",
+				"/usr/local/include/",
+				"/usr/local/lib/",
+				"/usr/share/",
+				"/lib/",
+				"/lib64/",
+			});
+		}
+
 		/// <summary>
 		/// Creates a process for the provided executable path
 		/// </summary>
@@ -36,14 +103,47 @@ namespace Monitor::Linux
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
-			std::vector<Path> allowedWriteAccess) override final
+			std::vector<Path> allowedWriteAccess,
+			std::shared_ptr<IProcessOutputListener> outputListener) override final
 		{
+			switch (m_backend)
+			{
+				case LinuxMonitorBackend::SharedTrace:
+					return std::make_shared<LinuxSharedMonitorProcess>(
+						executable,
+						std::move(arguments),
+						workingDirectory,
+						m_sharedTracer,
+						std::move(monitor),
+						partialMonitor,
+						std::move(outputListener));
+				case LinuxMonitorBackend::Notify:
+					return std::make_shared<LinuxNotifyMonitorProcess>(
+						executable,
+						std::move(arguments),
+						workingDirectory,
+						std::move(monitor),
+						partialMonitor,
+						std::move(outputListener));
+				case LinuxMonitorBackend::Preload:
+					return std::make_shared<LinuxPreloadMonitorProcess>(
+						executable,
+						std::move(arguments),
+						workingDirectory,
+						std::move(monitor),
+						m_immutableReadDirectories,
+						std::move(outputListener));
+				default:
+					break;
+			}
+
 			return std::make_shared<LinuxMonitorProcess>(
 				executable,
 				std::move(arguments),
 				workingDirectory,
 				std::move(monitor),
-				partialMonitor);
+				partialMonitor,
+				std::move(outputListener));
 		}
 	};
 }
@@ -0,0 +1,385 @@
+﻿// <copyright file="LinuxNotifyMonitorProcess.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "LinuxSystemAccessMonitor.h"
+#include "LinuxSystemLoggerMonitor.h"
+#include "LinuxSystemMonitorFork.h"
+#include "LinuxTraceEventListener.h"
+#include "LinuxProcessLauncher.h"
+#include "LinuxProcessOutputReader.h"
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// A Linux platform specific process executable that monitors file system access through a seccomp user notification file descriptor.
+	/// The filter is inherited by every descendant process, so a single supervisor loop polls one descriptor for all of them and
+	/// lets each system call continue after it is recorded, without any ptrace stops.
+	/// The supervisor loop runs in WaitForExit so that starting the process never blocks on the process running.
+	/// Note: The notification is sent before the system call runs, the result of an open is predicted by checking if the file exists.
+	/// Requires Linux 5.5 or later for SECCOMP_USER_NOTIF_FLAG_CONTINUE.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxNotifyMonitorProcess : public Opal::System::IProcess
+	{
+	private:
+		// Input
+		Path m_executable;
+		std::vector<std::string> m_arguments;
+		Path m_workingDirectory;
+		LinuxTraceEventListener m_eventListener;
+		bool m_partialMonitor;
+		std::shared_ptr<IProcessOutputListener> m_outputListener;
+
+		// Runtime
+		pid_t m_processId;
+		int m_notifyHandle;
+		std::unique_ptr<LinuxProcessOutputReader> m_outputReader;
+
+		// Result
+		bool m_isFinished;
+		std::string m_stdOut;
+		std::string m_stdErr;
+		int m_exitCode;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxNotifyMonitorProcess'/> class.
+		/// </summary>
+		LinuxNotifyMonitorProcess(
+			const Path& executable,
+			std::vector<std::string> arguments,
+			const Path& workingDirectory,
+			std::shared_ptr<ISystemAccessMonitor> monitor,
+			bool partialMonitor,
+			std::shared_ptr<IProcessOutputListener> outputListener) :
+			m_executable(executable),
+			m_arguments(std::move(arguments)),
+			m_workingDirectory(workingDirectory),
+	#ifdef TRACE_DETOUR_SERVER
+			m_eventListener(std::make_shared<LinuxSystemMonitorFork>(
+				std::make_shared<LinuxSystemLoggerMonitor>(std::cout),
+				std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor)))),
+	#else
+			m_eventListener(std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor))),
+	#endif
+			m_partialMonitor(partialMonitor),
+			m_outputListener(std::move(outputListener)),
+			m_processId(),
+			m_notifyHandle(-1),
+			m_outputReader(),
+			m_isFinished(false),
+			m_exitCode(-1)
+		{
+		}
+
+		/// <summary>
+		/// Execute a process for the provided
+		/// </summary>
+		void Start() override final
+		{
+			// Create a pipe to send stdout to parent
+			// Note: Only the read end is non blocking, the child must be able to block on a full pipe
+			int stdOutPipe[2];
+			if (pipe2(stdOutPipe, O_CLOEXEC) < 0 || fcntl(stdOutPipe[0], F_SETFL, O_NONBLOCK) < 0)
+				throw std::runtime_error("Failed to create stdOutPipe");
+
+			// Create a pipe to send stderr to parent
+			int stdErrPipe[2];
+			if (pipe2(stdErrPipe, O_CLOEXEC) < 0 || fcntl(stdErrPipe[0], F_SETFL, O_NONBLOCK) < 0)
+				throw std::runtime_error("Failed to create stdErrPipe");
+
+			// Create a socket to pass the notification file descriptor from the child that installs the filter
+			int notifySocket[2];
+			if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, notifySocket) < 0)
+				throw std::runtime_error("Failed to create notifySocket");
+
+			// Create a child process
+			DebugTrace("Spawn");
+			auto launcher = LinuxProcessLauncher(m_executable, m_arguments, m_workingDirectory, LinuxSystemCallFilter::Notify);
+			m_processId = launcher.Spawn(stdOutPipe[1], stdErrPipe[1], notifySocket[1]);
+
+			// Close our handle on the write end
+			close(stdOutPipe[1]);
+			close(stdErrPipe[1]);
+			close(notifySocket[1]);
+			m_outputReader = std::make_unique<LinuxProcessOutputReader>(
+				stdOutPipe[0],
+				stdErrPipe[0],
+				-1,
+				m_outputListener);
+
+			// A child that failed before the filter was loaded exits without sending a descriptor
+			m_notifyHandle = ReceiveFileDescriptor(notifySocket[0]);
+			close(notifySocket[0]);
+		}
+
+		/// <summary>
+		/// Wait for the process to exit
+		/// </summary>
+		void WaitForExit() override final
+		{
+			RunSupervisor();
+			DebugTrace("Parent done");
+
+			m_outputReader->ReadAvailable();
+			m_stdOut = m_outputReader->TakeStandardOutput();
+			m_stdErr = m_outputReader->TakeStandardError();
+			m_outputReader = nullptr;
+
+			m_isFinished = true;
+		}
+
+		/// <summary>
+		/// Get the exit code
+		/// </summary>
+		int GetExitCode() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_exitCode;
+		}
+
+		/// <summary>
+		/// Get the standard output
+		/// </summary>
+		std::string GetStandardOutput() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_stdOut;
+		}
+
+		/// <summary>
+		/// Get the standard error output
+		/// </summary>
+		std::string GetStandardError() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_stdErr;
+		}
+
+	private:
+		/// <summary>
+		/// The supervisor loop that services notifications from the process and all of its descendants
+		/// until the root process exits
+		/// </summary>
+		void RunSupervisor()
+		{
+			DebugTrace("Supervisor Start");
+
+			auto processHandle = static_cast<int>(syscall(SYS_pidfd_open, m_processId, 0));
+			if (processHandle < 0)
+				throw std::runtime_error(std::format("pidfd_open failed {0}", errno));
+
+			struct seccomp_notif* request = nullptr;
+			struct seccomp_notif_resp* response = nullptr;
+			if (seccomp_notify_alloc(&request, &response) != 0)
+			{
+				close(processHandle);
+				throw std::runtime_error("seccomp_notify_alloc failed");
+			}
+
+			enum PollIndex { Notify = 0, Process = 1, Output = 2 };
+			auto pollHandles = std::array<pollfd, 3>({
+				pollfd { m_notifyHandle, POLLIN, 0 },
+				pollfd { processHandle, POLLIN, 0 },
+				pollfd { m_outputReader->GetHandle(), POLLIN, 0 },
+			});
+
+			while (true)
+			{
+				if (poll(pollHandles.data(), pollHandles.size(), -1) < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					throw std::runtime_error(std::format("poll failed {0}", errno));
+				}
+
+				// Keep the output pipes drained so the children never block on a full buffer
+				if (pollHandles[Output].revents != 0)
+					m_outputReader->Wait(0);
+
+				if ((pollHandles[Notify].revents & POLLIN) != 0)
+				{
+					ProcessNotification(request, response);
+				}
+				else if ((pollHandles[Notify].revents & (POLLHUP | POLLERR)) != 0)
+				{
+					// Every filtered process has exited
+					pollHandles[Notify].fd = -1;
+				}
+
+				if ((pollHandles[Process].revents & POLLIN) != 0)
+				{
+					int status;
+					if (waitpid(m_processId, &status, 0) == -1)
+						throw std::runtime_error(std::format("Wait failed {0}", errno));
+
+					if (WIFEXITED(status))
+						m_exitCode = WEXITSTATUS(status);
+
+					DebugTrace("Main exit:", m_exitCode);
+					break;
+				}
+			}
+
+			// Any descendant that is still running will see its monitored calls fail once the descriptor is closed
+			seccomp_notify_free(request, response);
+			close(processHandle);
+			if (m_notifyHandle >= 0)
+				close(m_notifyHandle);
+			m_notifyHandle = -1;
+		}
+
+		void ProcessNotification(struct seccomp_notif* request, struct seccomp_notif_resp* response)
+		{
+			memset(request, 0, sizeof(struct seccomp_notif));
+			if (seccomp_notify_receive(m_notifyHandle, request) != 0)
+			{
+				// The calling process was killed before the notification was read
+				return;
+			}
+
+			// Ignore all messages if partial monitor is enabled
+			if (!m_partialMonitor)
+			{
+				try
+				{
+					auto status = SysCallStatus(
+						{
+							static_cast<long>(request->data.nr),
+							PredictResult(request),
+							0,
+							std::array<long, 6>({
+								static_cast<long>(request->data.args[0]),
+								static_cast<long>(request->data.args[1]),
+								static_cast<long>(request->data.args[2]),
+								static_cast<long>(request->data.args[3]),
+								static_cast<long>(request->data.args[4]),
+								static_cast<long>(request->data.args[5]),
+							})
+						});
+					auto sysCall = m_eventListener.ReadSysCall(request->pid, status);
+
+					// Only trust the memory that was read while the notification is still pending, otherwise the caller
+					// may have exited and the process id reused before the paths were read
+					if (seccomp_notify_id_valid(m_notifyHandle, request->id) == 0)
+						m_eventListener.ReportSysCall(sysCall);
+				}
+				catch (const std::exception& ex)
+				{
+					// Never leave the caller blocked, a read fails as expected once the caller is gone
+					if (seccomp_notify_id_valid(m_notifyHandle, request->id) == 0)
+						m_eventListener.LogError(ex.what());
+				}
+			}
+
+			// Let the kernel run the original system call
+			response->id = request->id;
+			response->val = 0;
+			response->error = 0;
+			response->flags = SECCOMP_USER_NOTIF_FLAG_CONTINUE;
+			if (seccomp_notify_respond(m_notifyHandle, response) != 0)
+			{
+				DebugTrace("Respond failed");
+			}
+		}
+
+		/// <summary>
+		/// Predict the result of a system call that has not run yet. An open succeeds when it creates
+		/// the file or the file already exists, all other calls are assumed to succeed.
+		/// </summary>
+		long PredictResult(struct seccomp_notif* request)
+		{
+			auto systemCall = static_cast<long>(request->data.nr);
+			int32_t dirfd = AT_FDCWD;
+			long pathAddress = 0;
+			int32_t flags = 0;
+			if (systemCall == SCMP_SYS(open))
+			{
+				pathAddress = static_cast<long>(request->data.args[0]);
+				flags = static_cast<int32_t>(request->data.args[1]);
+			}
+			else if (systemCall == SCMP_SYS(openat))
+			{
+				dirfd = static_cast<int32_t>(request->data.args[0]);
+				pathAddress = static_cast<long>(request->data.args[1]);
+				flags = static_cast<int32_t>(request->data.args[2]);
+			}
+			else if (systemCall == SCMP_SYS(openat2))
+			{
+				// The flags are inside the open_how structure, only check if the file exists
+				dirfd = static_cast<int32_t>(request->data.args[0]);
+				pathAddress = static_cast<long>(request->data.args[1]);
+			}
+			else
+			{
+				return 0;
+			}
+
+			if ((flags & O_CREAT) != 0)
+				return 0;
+
+			// Resolve the path against the working directory or directory descriptor of the caller
+			auto memoryReader = LinuxTraceeMemoryReader();
+			auto path = memoryReader.ReadNullTerminatedString(request->pid, pathAddress);
+			if (!path.starts_with('/'))
+			{
+				auto directory = dirfd == AT_FDCWD ?
+					std::format("/proc/{}/cwd/", request->pid) :
+					std::format("/proc/{}/fd/{}/", request->pid, dirfd);
+				path = directory + path;
+			}
+
+			return faccessat(AT_FDCWD, path.c_str(), F_OK, 0) == 0 ? 0 : -1;
+		}
+
+		static int ReceiveFileDescriptor(int socketHandle)
+		{
+			char data = 0;
+			iovec io = { &data, sizeof(data) };
+
+			alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+			msghdr message = {};
+			message.msg_iov = &io;
+			message.msg_iovlen = 1;
+			message.msg_control = control;
+			message.msg_controllen = sizeof(control);
+
+			if (recvmsg(socketHandle, &message, MSG_CMSG_CLOEXEC) <= 0)
+				return -1;
+
+			auto controlMessage = CMSG_FIRSTHDR(&message);
+			if (controlMessage == nullptr ||
+				controlMessage->cmsg_level != SOL_SOCKET ||
+				controlMessage->cmsg_type != SCM_RIGHTS)
+			{
+				return -1;
+			}
+
+			int fileDescriptor;
+			memcpy(&fileDescriptor, CMSG_DATA(controlMessage), sizeof(int));
+			return fileDescriptor;
+		}
+
+		void DebugTrace(std::string_view message, uint32_t value)
+		{
+#ifdef TRACE_MONITOR_HOST
+			std::cout << "Monitor-HOST: " << message << " " << value << std::endl;
+#endif
+		}
+
+		void DebugTrace(std::string_view message)
+		{
+#ifdef TRACE_MONITOR_HOST
+			std::cout << "Monitor-HOST: " << message << std::endl;
+#endif
+		}
+	};
+}
@@ -0,0 +1,340 @@
+﻿// <copyright file="LinuxPreloadMonitorProcess.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "LinuxSystemAccessMonitor.h"
+#include "LinuxSystemLoggerMonitor.h"
+#include "LinuxSystemMonitorFork.h"
+#include "LinuxDetourEventListener.h"
+#include "LinuxProcessLauncher.h"
+#include "LinuxProcessOutputReader.h"
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// A Linux platform specific process executable that loads the monitor client into every dynamically linked process
+	/// with LD_PRELOAD. The client writes its events into a ring buffer in shared memory that is inherited by all descendants
+	/// and the waiting thread reads them in batches, so the monitored processes never stop for the host.
+	/// Note: Statically linked executables and processes that replace their environment are not monitored.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxPreloadMonitorProcess : public Opal::System::IProcess
+	{
+	private:
+		// A writer that has not committed its reserved record for this long was killed in the middle of the write
+		static constexpr auto StallTimeout = std::chrono::seconds(5);
+		static constexpr int StallPollMilliseconds = 100;
+
+		// Input
+		Path m_executable;
+		std::vector<std::string> m_arguments;
+		Path m_workingDirectory;
+		std::string m_immutableReadDirectories;
+		LinuxDetourEventListener m_eventListener;
+		std::shared_ptr<IProcessOutputListener> m_outputListener;
+
+		// Runtime
+		pid_t m_processId;
+		int m_processHandle;
+		int m_ringHandle;
+		int m_eventHandle;
+		void* m_ringMapping;
+		std::unique_ptr<MessageRing> m_ring;
+		std::unique_ptr<LinuxProcessOutputReader> m_outputReader;
+
+		// Result
+		bool m_isFinished;
+		bool m_isIncomplete;
+		std::string m_stdOut;
+		std::string m_stdErr;
+		int m_exitCode;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxPreloadMonitorProcess'/> class.
+		/// </summary>
+		LinuxPreloadMonitorProcess(
+			const Path& executable,
+			std::vector<std::string> arguments,
+			const Path& workingDirectory,
+			std::shared_ptr<ISystemAccessMonitor> monitor,
+			std::string immutableReadDirectories,
+			std::shared_ptr<IProcessOutputListener> outputListener) :
+			m_executable(executable),
+			m_arguments(std::move(arguments)),
+			m_workingDirectory(workingDirectory),
+			m_immutableReadDirectories(std::move(immutableReadDirectories)),
+	#ifdef TRACE_DETOUR_SERVER
+			m_eventListener(std::make_shared<LinuxSystemMonitorFork>(
+				std::make_shared<LinuxSystemLoggerMonitor>(std::cout),
+				std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor)))),
+	#else
+			m_eventListener(std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor))),
+	#endif
+			m_outputListener(std::move(outputListener)),
+			m_processId(),
+			m_processHandle(-1),
+			m_ringHandle(-1),
+			m_eventHandle(-1),
+			m_ringMapping(MAP_FAILED),
+			m_ring(),
+			m_outputReader(),
+			m_isFinished(false),
+			m_isIncomplete(false),
+			m_exitCode(-1)
+		{
+		}
+
+		LinuxPreloadMonitorProcess(const LinuxPreloadMonitorProcess&) = delete;
+		LinuxPreloadMonitorProcess& operator=(const LinuxPreloadMonitorProcess&) = delete;
+
+		~LinuxPreloadMonitorProcess()
+		{
+			CloseRing();
+		}
+
+		/// <summary>
+		/// Execute a process for the provided
+		/// </summary>
+		void Start() override final
+		{
+			// The monitor client library is deployed next to the host executable
+			auto moduleName = Opal::System::IProcessManager::Current().GetCurrentProcessFileName();
+			auto clientLibraryPath = moduleName.GetParent() + Path("./libMonitor.Client.so");
+
+			// Create a pipe to send stdout to parent
+			// Note: Only the read end is non blocking, the child must be able to block on a full pipe
+			int stdOutPipe[2];
+			if (pipe2(stdOutPipe, O_CLOEXEC) < 0 || fcntl(stdOutPipe[0], F_SETFL, O_NONBLOCK) < 0)
+				throw std::runtime_error("Failed to create stdOutPipe");
+
+			// Create a pipe to send stderr to parent
+			int stdErrPipe[2];
+			if (pipe2(stdErrPipe, O_CLOEXEC) < 0 || fcntl(stdErrPipe[0], F_SETFL, O_NONBLOCK) < 0)
+				throw std::runtime_error("Failed to create stdErrPipe");
+
+			OpenRing();
+
+			// Create a child process that loads the monitor client and inherits the ring
+			DebugTrace("Spawn");
+			auto launcher = LinuxProcessLauncher(m_executable, m_arguments, m_workingDirectory, LinuxSystemCallFilter::None);
+			launcher.AddEnvironmentVariable("LD_PRELOAD", clientLibraryPath.ToString());
+			launcher.AddEnvironmentVariable(MessageRing::MemoryHandleVariable, std::to_string(m_ringHandle));
+			launcher.AddEnvironmentVariable(MessageRing::EventHandleVariable, std::to_string(m_eventHandle));
+			if (!m_immutableReadDirectories.empty())
+				launcher.AddEnvironmentVariable(ImmutableReadFilter::DirectoriesVariable, m_immutableReadDirectories);
+			launcher.InheritHandle(m_ringHandle);
+			launcher.InheritHandle(m_eventHandle);
+			m_processId = launcher.Spawn(stdOutPipe[1], stdErrPipe[1], -1);
+
+			// Close our handle on the write end
+			close(stdOutPipe[1]);
+			close(stdErrPipe[1]);
+			m_outputReader = std::make_unique<LinuxProcessOutputReader>(
+				stdOutPipe[0],
+				stdErrPipe[0],
+				-1,
+				m_outputListener);
+
+			m_processHandle = static_cast<int>(syscall(SYS_pidfd_open, m_processId, 0));
+			if (m_processHandle < 0)
+				throw std::runtime_error(std::format("pidfd_open failed {}", errno));
+
+			DebugTrace("Parent done");
+		}
+
+		/// <summary>
+		/// Wait for the process to exit
+		/// </summary>
+		void WaitForExit() override final
+		{
+			enum PollIndex { Event = 0, Process = 1, Output = 2 };
+			auto pollHandles = std::array<pollfd, 3>({
+				pollfd { m_eventHandle, POLLIN, 0 },
+				pollfd { m_processHandle, POLLIN, 0 },
+				pollfd { m_outputReader->GetHandle(), POLLIN, 0 },
+			});
+
+			bool hasExited = false;
+			uint64_t exitWritePosition = 0;
+			uint64_t stalledPosition = m_ring->GetReadPosition();
+			std::optional<std::chrono::steady_clock::time_point> stallStart = std::nullopt;
+			while (true)
+			{
+				if (!m_isIncomplete)
+				{
+					m_ring->Read([this](Message& message) { m_eventListener.SafeLogMessage(message); });
+
+					// A record that stays reserved but uncommitted blocks every record after it, stop reading and
+					// let the writers drop their messages instead of waiting for space forever
+					auto readPosition = m_ring->GetReadPosition();
+					if (readPosition != stalledPosition || readPosition == m_ring->GetWritePosition())
+					{
+						stalledPosition = readPosition;
+						stallStart = std::nullopt;
+					}
+					else if (!stallStart.has_value())
+					{
+						stallStart = std::chrono::steady_clock::now();
+					}
+					else if (std::chrono::steady_clock::now() - stallStart.value() > StallTimeout)
+					{
+						DebugTrace("Message ring stalled at:", static_cast<uint32_t>(readPosition));
+						m_ring->Close();
+						m_isIncomplete = true;
+					}
+				}
+
+				// The events of the root process are all reserved before it exits, descendants that are
+				// still running are no longer monitored
+				if (hasExited && (m_isIncomplete || m_ring->GetReadPosition() >= exitWritePosition))
+					break;
+
+				// Only block when no message was committed while the reader was busy
+				if (!m_isIncomplete && !m_ring->TryBeginWait())
+					continue;
+
+				// Check the reserved record again soon when the reader is waiting on a writer that has not committed it
+				auto timeout = !m_isIncomplete && m_ring->GetReadPosition() != m_ring->GetWritePosition() ?
+					StallPollMilliseconds :
+					-1;
+				if (poll(pollHandles.data(), pollHandles.size(), timeout) < 0)
+				{
+					if (errno == EINTR)
+						continue;
+
+					throw std::runtime_error(std::format("poll failed {}", errno));
+				}
+
+				if ((pollHandles[Event].revents & POLLIN) != 0)
+				{
+					uint64_t value;
+					if (read(m_eventHandle, &value, sizeof(value)) < 0 && errno != EAGAIN)
+						throw std::runtime_error(std::format("Failed to read ring event {}", errno));
+				}
+
+				// Keep the output pipes drained so the children never block on a full buffer
+				if (pollHandles[Output].revents != 0)
+					m_outputReader->Wait(0);
+
+				if ((pollHandles[Process].revents & POLLIN) != 0)
+				{
+					int status;
+					if (waitpid(m_processId, &status, 0) == -1)
+						throw std::runtime_error(std::format("Wait failed {}", errno));
+
+					m_exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+					DebugTrace("Main exit:", m_exitCode);
+					hasExited = true;
+					exitWritePosition = m_ring->GetWritePosition();
+
+					// Only wait for the records that were reserved before the exit from here on
+					pollHandles[Process].fd = -1;
+					pollHandles[Output].fd = -1;
+				}
+			}
+
+			m_outputReader->ReadAvailable();
+			m_stdOut = m_outputReader->TakeStandardOutput();
+			m_stdErr = m_outputReader->TakeStandardError();
+			m_outputReader = nullptr;
+
+			CloseRing();
+			m_isFinished = true;
+
+			// The accesses after the lost record were never observed, the operation cannot be trusted
+			if (m_isIncomplete)
+				throw std::runtime_error("A monitored process was killed while it was writing an event, the observed accesses are incomplete");
+		}
+
+		/// <summary>
+		/// Get the exit code
+		/// </summary>
+		int GetExitCode() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_exitCode;
+		}
+
+		/// <summary>
+		/// Get the standard output
+		/// </summary>
+		std::string GetStandardOutput() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_stdOut;
+		}
+
+		/// <summary>
+		/// Get the standard error output
+		/// </summary>
+		std::string GetStandardError() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_stdErr;
+		}
+
+	private:
+		/// <summary>
+		/// Create the shared memory for the ring and the event that wakes this reader
+		/// </summary>
+		void OpenRing()
+		{
+			m_ringHandle = memfd_create("soup-monitor-ring", MFD_CLOEXEC);
+			if (m_ringHandle < 0)
+				throw std::runtime_error("memfd_create failed");
+
+			if (ftruncate(m_ringHandle, MessageRing::MappingSize) < 0)
+				throw std::runtime_error("Failed to size the message ring");
+
+			m_ringMapping = mmap(nullptr, MessageRing::MappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_ringHandle, 0);
+			if (m_ringMapping == MAP_FAILED)
+				throw std::runtime_error("Failed to map the message ring");
+
+			m_ring = std::make_unique<MessageRing>(m_ringMapping);
+
+			m_eventHandle = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+			if (m_eventHandle < 0)
+				throw std::runtime_error("Failed to create ring event");
+		}
+
+		void CloseRing()
+		{
+			// Descendants that are still running must not wait for this reader to make room
+			if (m_ring != nullptr)
+				m_ring->Close();
+
+			m_ring = nullptr;
+			if (m_ringMapping != MAP_FAILED)
+				munmap(m_ringMapping, MessageRing::MappingSize);
+			m_ringMapping = MAP_FAILED;
+
+			for (auto handle : { &m_ringHandle, &m_eventHandle, &m_processHandle })
+			{
+				if (*handle >= 0)
+					close(*handle);
+				*handle = -1;
+			}
+		}
+
+		void DebugTrace(std::string_view message, uint32_t value)
+		{
+#ifdef TRACE_MONITOR_HOST
+			std::cout << "Monitor-HOST: " << message << " " << value << std::endl;
+#endif
+		}
+
+		void DebugTrace(std::string_view message)
+		{
+#ifdef TRACE_MONITOR_HOST
+			std::cout << "Monitor-HOST: " << message << std::endl;
+#endif
+		}
+	};
+}
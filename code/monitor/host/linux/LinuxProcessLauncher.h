@@ -0,0 +1,344 @@
+﻿// <copyright file="LinuxProcessLauncher.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// The way the system calls of a launched process and all of its descendants are reported
+	/// </summary>
+	enum class LinuxSystemCallFilter
+	{
+		// Stop for the parent tracer with PTRACE_EVENT_SECCOMP
+		Trace,
+
+		// Send a seccomp user notification, the listener descriptor is passed back over a socket
+		Notify,
+
+		// No filter, the preloaded monitor client reports the calls itself
+		None,
+	};
+
+	/// <summary>
+	/// Launches a monitored child process without copying the page tables of the parent.
+	/// Everything the child needs is prepared up front, including the compiled system call filter, so the child
+	/// can share the memory of the suspended parent (CLONE_VM | CLONE_VFORK) and only make raw system calls until
+	/// execve. The cost of a launch does not grow with the resident size of the build process.
+	/// </summary>
+	class LinuxProcessLauncher
+	{
+	private:
+		static const size_t ChildStackSize = 64 * 1024;
+
+		// Prepared
+		std::string m_executable;
+		std::vector<std::string> m_argumentValues;
+		std::vector<const char*> m_arguments;
+		std::vector<std::string> m_environmentValues;
+		std::vector<const char*> m_environment;
+		std::string m_workingDirectory;
+		LinuxSystemCallFilter m_filter;
+		sock_fprog m_filterProgram;
+
+		std::vector<int> m_inheritedHandles;
+
+		// Child
+		int m_stdOutHandle;
+		int m_stdErrHandle;
+		int m_notifySocket;
+		sigset_t m_signalMask;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxProcessLauncher'/> class.
+		/// </summary>
+		LinuxProcessLauncher(
+			const Path& executable,
+			const std::vector<std::string>& arguments,
+			const Path& workingDirectory,
+			LinuxSystemCallFilter filter) :
+			m_executable(executable.ToString()),
+			m_argumentValues(arguments),
+			m_arguments(),
+			m_environmentValues({
+				"HOME=/",
+				"USER=USERNAME",
+				"PAHT=/usr/bin",
+			}),
+			m_environment(),
+			m_workingDirectory(workingDirectory.ToString()),
+			m_filter(filter),
+			m_filterProgram(),
+			m_inheritedHandles(),
+			m_stdOutHandle(-1),
+			m_stdErrHandle(-1),
+			m_notifySocket(-1),
+			m_signalMask()
+		{
+			m_arguments.push_back(m_executable.c_str());
+			for (auto& argument : m_argumentValues)
+				m_arguments.push_back(argument.c_str());
+			m_arguments.push_back(nullptr);
+
+			if (filter != LinuxSystemCallFilter::None)
+			{
+				auto& filterProgram = GetFilterProgram(filter);
+				m_filterProgram.len = static_cast<unsigned short>(filterProgram.size());
+				m_filterProgram.filter = const_cast<sock_filter*>(filterProgram.data());
+			}
+		}
+
+		LinuxProcessLauncher(const LinuxProcessLauncher&) = delete;
+		LinuxProcessLauncher& operator=(const LinuxProcessLauncher&) = delete;
+
+		/// <summary>
+		/// Add a variable to the environment of the child
+		/// </summary>
+		void AddEnvironmentVariable(std::string_view name, std::string_view value)
+		{
+			m_environmentValues.push_back(std::format("{}={}", name, value));
+		}
+
+		/// <summary>
+		/// Keep a close on exec handle open in the child, it stays at the same number after execve
+		/// </summary>
+		void InheritHandle(int handle)
+		{
+			m_inheritedHandles.push_back(handle);
+		}
+
+		/// <summary>
+		/// Start the child process and return once it has replaced itself with the executable.
+		/// A child that fails before execve writes the reason to its standard error and exits with 1234.
+		/// The output handles are duplicated as the standard output and error of the child, for the Notify filter the
+		/// listener descriptor is sent over the notify socket.
+		/// </summary>
+		pid_t Spawn(int stdOutHandle, int stdErrHandle, int notifySocket)
+		{
+			m_stdOutHandle = stdOutHandle;
+			m_stdErrHandle = stdErrHandle;
+			m_notifySocket = notifySocket;
+
+			m_environment.clear();
+			for (auto& value : m_environmentValues)
+				m_environment.push_back(value.c_str());
+			m_environment.push_back(nullptr);
+
+			auto stack = std::make_unique<char[]>(ChildStackSize);
+
+			// Block all signals so a handler of the parent can never run on the shared memory of the child
+			sigset_t allSignals;
+			sigfillset(&allSignals);
+			pthread_sigmask(SIG_SETMASK, &allSignals, &m_signalMask);
+
+			auto processId = clone(
+				&LinuxProcessLauncher::ChildMain,
+				stack.get() + ChildStackSize,
+				CLONE_VM | CLONE_VFORK | SIGCHLD,
+				this);
+			auto cloneError = errno;
+
+			pthread_sigmask(SIG_SETMASK, &m_signalMask, nullptr);
+
+			if (processId == -1)
+				throw std::runtime_error(std::format("Failed to clone child process {}", cloneError));
+
+			return processId;
+		}
+
+	private:
+		/// <summary>
+		/// The entry point of the child, it runs on the memory of the parent so it must not allocate, throw or
+		/// change any state other than its own descriptors and signal handlers
+		/// </summary>
+		static int ChildMain(void* argument)
+		{
+			auto& launcher = *static_cast<LinuxProcessLauncher*>(argument);
+
+			// Restore the default signal handlers, the handlers of the parent reference its memory
+			struct sigaction defaultAction = {};
+			defaultAction.sa_handler = SIG_DFL;
+			for (int signal = 1; signal < NSIG; signal++)
+			{
+				struct sigaction currentAction;
+				if (sigaction(signal, nullptr, &currentAction) == 0 &&
+					currentAction.sa_handler != SIG_DFL &&
+					currentAction.sa_handler != SIG_IGN)
+				{
+					sigaction(signal, &defaultAction, nullptr);
+				}
+			}
+
+			pthread_sigmask(SIG_SETMASK, &launcher.m_signalMask, nullptr);
+
+			// Redirect stdout and stderr to the pipe write, the parent handles are all close on exec
+			if (dup2(launcher.m_stdOutHandle, STDOUT_FILENO) != STDOUT_FILENO)
+				ExitChild("dup2 error to stdout");
+			if (dup2(launcher.m_stdErrHandle, STDERR_FILENO) != STDERR_FILENO)
+				ExitChild("dup2 error to stderr");
+
+			for (auto handle : launcher.m_inheritedHandles)
+			{
+				if (fcntl(handle, F_SETFD, 0) == -1)
+					ExitChild("Failed to inherit handle");
+			}
+
+			// Set the working directory in the child only so the parent is not affected
+			if (chdir(launcher.m_workingDirectory.c_str()) == -1)
+				ExitChild("Failed to set working directory");
+
+			// Load the system call filter that is inherited by every descendant
+			if (launcher.m_filter != LinuxSystemCallFilter::None &&
+				prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) != 0)
+			{
+				ExitChild("seccomp_load failed");
+			}
+
+			if (launcher.m_filter == LinuxSystemCallFilter::Notify)
+			{
+				// Hand the notification descriptor to the supervisor before any monitored call is made
+				auto notifyHandle = static_cast<int>(syscall(
+					SYS_seccomp, SECCOMP_SET_MODE_FILTER, SECCOMP_FILTER_FLAG_NEW_LISTENER, &launcher.m_filterProgram));
+				if (notifyHandle < 0)
+					ExitChild("seccomp_load failed");
+
+				if (!SendFileDescriptor(launcher.m_notifySocket, notifyHandle))
+					ExitChild("Failed to send notify descriptor");
+
+				close(notifyHandle);
+			}
+			else if (launcher.m_filter == LinuxSystemCallFilter::Trace)
+			{
+				if (syscall(SYS_seccomp, SECCOMP_SET_MODE_FILTER, 0, &launcher.m_filterProgram) != 0)
+					ExitChild("seccomp_load failed");
+
+				ptrace(PTRACE_TRACEME, 0, nullptr, nullptr);
+			}
+
+			// Replace runtime with child program
+			execve(
+				launcher.m_executable.c_str(),
+				const_cast<char**>(launcher.m_arguments.data()),
+				const_cast<char**>(launcher.m_environment.data()));
+			ExitChild("Failed to start child");
+			return 0;
+		}
+
+		static void ExitChild(std::string_view message)
+		{
+			// Only use system calls, the stream buffers belong to the parent
+			[[maybe_unused]] auto result = write(STDERR_FILENO, message.data(), message.size());
+			result = write(STDERR_FILENO, "\n", 1);
+			_exit(1234);
+		}
+
+		static bool SendFileDescriptor(int socketHandle, int fileDescriptor)
+		{
+			char data = 0;
+			iovec io = { &data, sizeof(data) };
+
+			alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int))] = {};
+			msghdr message = {};
+			message.msg_iov = &io;
+			message.msg_iovlen = 1;
+			message.msg_control = control;
+			message.msg_controllen = sizeof(control);
+
+			auto controlMessage = CMSG_FIRSTHDR(&message);
+			controlMessage->cmsg_level = SOL_SOCKET;
+			controlMessage->cmsg_type = SCM_RIGHTS;
+			controlMessage->cmsg_len = CMSG_LEN(sizeof(int));
+			memcpy(CMSG_DATA(controlMessage), &fileDescriptor, sizeof(int));
+
+			return sendmsg(socketHandle, &message, 0) == sizeof(data);
+		}
+
+		/// <summary>
+		/// Compile the filter once with libseccomp and keep the program for every later launch
+		/// </summary>
+		static const std::vector<sock_filter>& GetFilterProgram(LinuxSystemCallFilter filter)
+		{
+			static const auto traceProgram = CompileFilterProgram(LinuxSystemCallFilter::Trace);
+			static const auto notifyProgram = CompileFilterProgram(LinuxSystemCallFilter::Notify);
+			return filter == LinuxSystemCallFilter::Notify ? notifyProgram : traceProgram;
+		}
+
+		static std::vector<sock_filter> CompileFilterProgram(LinuxSystemCallFilter filter)
+		{
+			auto systemCalls = std::vector<int>({
+				SCMP_SYS(open),
+				SCMP_SYS(openat),
+				SCMP_SYS(openat2),
+				SCMP_SYS(creat),
+				SCMP_SYS(link),
+				SCMP_SYS(linkat),
+				SCMP_SYS(rename),
+				SCMP_SYS(renameat),
+				SCMP_SYS(renameat2),
+				SCMP_SYS(unlink),
+				SCMP_SYS(mkdir),
+				SCMP_SYS(mkdirat),
+				SCMP_SYS(rmdir),
+				// TODO: Allow first execve when the parent has not connected yet to allow it
+				// Maybe try to filter to the known exe and only allow that and trace others
+				// https://lore.kernel.org/lkml/20201029075841.GB29881@ircssh-2.c.rugged-nimbus-611.internal/T/
+				SCMP_SYS(execveat),
+			});
+
+			// The tracer follows new processes through ptrace events, a notification cannot see the new process id
+			if (filter == LinuxSystemCallFilter::Trace)
+			{
+				systemCalls.push_back(SCMP_SYS(fork));
+				systemCalls.push_back(SCMP_SYS(vfork));
+				systemCalls.push_back(SCMP_SYS(clone));
+				systemCalls.push_back(SCMP_SYS(clone3));
+			}
+
+			auto action = filter == LinuxSystemCallFilter::Notify ? SCMP_ACT_NOTIFY : SCMP_ACT_TRACE(1);
+
+			scmp_filter_ctx ctx = seccomp_init(SCMP_ACT_ALLOW);
+			if (ctx == NULL)
+				throw std::runtime_error("seccomp_init failed");
+
+			auto programHandle = -1;
+			try
+			{
+				for (auto systemCall : systemCalls)
+				{
+					if (seccomp_rule_add(ctx, action, systemCall, 0) < 0)
+						throw std::runtime_error("seccomp_rule_add failed");
+				}
+
+				// Export the raw program through an in memory file
+				programHandle = memfd_create("soup-seccomp", MFD_CLOEXEC);
+				if (programHandle < 0)
+					throw std::runtime_error("memfd_create failed");
+
+				if (seccomp_export_bpf(ctx, programHandle) < 0)
+					throw std::runtime_error("seccomp_export_bpf failed");
+
+				auto programSize = lseek(programHandle, 0, SEEK_END);
+				if (programSize <= 0 || programSize % sizeof(sock_filter) != 0)
+					throw std::runtime_error("Invalid seccomp program");
+
+				auto program = std::vector<sock_filter>(programSize / sizeof(sock_filter));
+				if (pread(programHandle, program.data(), programSize, 0) != programSize)
+					throw std::runtime_error("Failed to read seccomp program");
+
+				close(programHandle);
+				seccomp_release(ctx);
+				return program;
+			}
+			catch (const std::exception&)
+			{
+				// Ensure we cleanup nicely
+				if (programHandle >= 0)
+					close(programHandle);
+				seccomp_release(ctx);
+				throw;
+			}
+		}
+	};
+}
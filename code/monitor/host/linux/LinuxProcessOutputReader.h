@@ -0,0 +1,181 @@
+﻿// <copyright file="LinuxProcessOutputReader.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "../IProcessOutputListener.h"
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// Reads the standard output and error pipes of a child process as the data arrives so the child never blocks on a full pipe.
+	/// Each chunk is passed to the output listener when one is registered, otherwise it is kept for the result.
+	/// A wake handle, for example an eventfd that is signaled when the root process exits, ends the wait without requiring
+	/// every descendant that inherited the pipes to close them.
+	/// </summary>
+	class LinuxProcessOutputReader
+	{
+	private:
+		static const size_t BufferSize = 64 * 1024;
+
+		int m_pollHandle;
+		int m_stdOutHandle;
+		int m_stdErrHandle;
+		int m_wakeHandle;
+		std::shared_ptr<IProcessOutputListener> m_listener;
+		std::unique_ptr<char[]> m_buffer;
+
+		// Result
+		std::string m_stdOut;
+		std::string m_stdErr;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxProcessOutputReader'/> class that owns the non blocking read handles
+		/// </summary>
+		LinuxProcessOutputReader(
+			int stdOutHandle,
+			int stdErrHandle,
+			int wakeHandle,
+			std::shared_ptr<IProcessOutputListener> listener) :
+			m_pollHandle(epoll_create1(EPOLL_CLOEXEC)),
+			m_stdOutHandle(stdOutHandle),
+			m_stdErrHandle(stdErrHandle),
+			m_wakeHandle(wakeHandle),
+			m_listener(std::move(listener)),
+			m_buffer(std::make_unique<char[]>(BufferSize)),
+			m_stdOut(),
+			m_stdErr()
+		{
+			if (m_pollHandle < 0)
+				throw std::runtime_error("epoll_create1 failed");
+
+			for (auto handle : { m_stdOutHandle, m_stdErrHandle, m_wakeHandle })
+			{
+				// The wake handle is optional
+				if (handle < 0)
+					continue;
+
+				epoll_event event = {};
+				event.events = EPOLLIN;
+				event.data.fd = handle;
+				if (epoll_ctl(m_pollHandle, EPOLL_CTL_ADD, handle, &event) < 0)
+					throw std::runtime_error("epoll_ctl failed");
+			}
+		}
+
+		LinuxProcessOutputReader(const LinuxProcessOutputReader&) = delete;
+		LinuxProcessOutputReader& operator=(const LinuxProcessOutputReader&) = delete;
+
+		~LinuxProcessOutputReader()
+		{
+			close(m_pollHandle);
+			close(m_stdOutHandle);
+			close(m_stdErrHandle);
+		}
+
+		/// <summary>
+		/// Get the epoll handle that is readable when there is output, allows the reader to be part of another event loop
+		/// </summary>
+		int GetHandle() const
+		{
+			return m_pollHandle;
+		}
+
+		/// <summary>
+		/// Read all output until the wake handle is signaled, followed by anything still left in the pipes
+		/// </summary>
+		void ReadUntilWake()
+		{
+			while (!Wait(-1))
+			{
+			}
+
+			ReadAvailable();
+		}
+
+		/// <summary>
+		/// Wait for output or the wake handle and read everything that is available.
+		/// Returns true once the wake handle is signaled.
+		/// </summary>
+		bool Wait(int timeout)
+		{
+			auto events = std::array<epoll_event, 3>();
+			auto eventCount = epoll_wait(m_pollHandle, events.data(), static_cast<int>(events.size()), timeout);
+			if (eventCount < 0)
+			{
+				if (errno == EINTR)
+					return false;
+
+				throw std::runtime_error(std::format("epoll_wait failed {}", errno));
+			}
+
+			bool isWake = false;
+			for (int i = 0; i < eventCount; i++)
+			{
+				auto handle = events[i].data.fd;
+				if (handle == m_wakeHandle)
+				{
+					isWake = true;
+				}
+				else if (!Read(handle))
+				{
+					// Every writer has closed the pipe
+					epoll_ctl(m_pollHandle, EPOLL_CTL_DEL, handle, nullptr);
+				}
+			}
+
+			return isWake;
+		}
+
+		/// <summary>
+		/// Read everything that is currently available in both pipes without waiting
+		/// </summary>
+		void ReadAvailable()
+		{
+			Read(m_stdOutHandle);
+			Read(m_stdErrHandle);
+		}
+
+		/// <summary>
+		/// Take the standard output that was not passed to the listener
+		/// </summary>
+		std::string TakeStandardOutput()
+		{
+			return std::move(m_stdOut);
+		}
+
+		/// <summary>
+		/// Take the standard error output that was not passed to the listener
+		/// </summary>
+		std::string TakeStandardError()
+		{
+			return std::move(m_stdErr);
+		}
+
+	private:
+		/// <summary>
+		/// Read until the pipe is empty, returns false once the pipe is closed by every writer
+		/// </summary>
+		bool Read(int handle)
+		{
+			bool isStdOut = handle == m_stdOutHandle;
+			while (true)
+			{
+				auto readCount = read(handle, m_buffer.get(), BufferSize);
+				if (readCount == 0)
+					return false;
+				if (readCount < 0)
+					return errno == EAGAIN || errno == EINTR;
+
+				auto value = std::string_view(m_buffer.get(), readCount);
+				if (m_listener == nullptr)
+					(isStdOut ? m_stdOut : m_stdErr).append(value);
+				else if (isStdOut)
+					m_listener->OnStandardOutput(value);
+				else
+					m_listener->OnStandardError(value);
+			}
+		}
+	};
+}
@@ -0,0 +1,181 @@
+﻿// <copyright file="LinuxSharedMonitorProcess.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "LinuxSystemAccessMonitor.h"
+#include "LinuxSystemLoggerMonitor.h"
+#include "LinuxSystemMonitorFork.h"
+#include "LinuxSharedTracer.h"
+#include "LinuxProcessOutputReader.h"
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// A Linux platform specific process executable that is traced by a tracer thread shared with all other monitored processes.
+	/// Start only waits for the process to be created, the calling thread reads the output until the tracer reports the exit,
+	/// so any number of monitored processes can run at the same time.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxSharedMonitorProcess : public Opal::System::IProcess
+	{
+	private:
+		// Input
+		Path m_executable;
+		std::vector<std::string> m_arguments;
+		Path m_workingDirectory;
+		std::shared_ptr<LinuxSharedTracer> m_tracer;
+		std::shared_ptr<LinuxTracedOperation> m_operation;
+		std::shared_ptr<IProcessOutputListener> m_outputListener;
+
+		// Runtime
+		std::unique_ptr<LinuxProcessOutputReader> m_outputReader;
+
+		// Result
+		bool m_isFinished;
+		std::string m_stdOut;
+		std::string m_stdErr;
+		int m_exitCode;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxSharedMonitorProcess'/> class.
+		/// </summary>
+		LinuxSharedMonitorProcess(
+			const Path& executable,
+			std::vector<std::string> arguments,
+			const Path& workingDirectory,
+			std::shared_ptr<LinuxSharedTracer> tracer,
+			std::shared_ptr<ISystemAccessMonitor> monitor,
+			bool partialMonitor,
+			std::shared_ptr<IProcessOutputListener> outputListener) :
+			m_executable(executable),
+			m_arguments(std::move(arguments)),
+			m_workingDirectory(workingDirectory),
+			m_tracer(std::move(tracer)),
+	#ifdef TRACE_DETOUR_SERVER
+			m_operation(std::make_shared<LinuxTracedOperation>(
+				std::make_shared<LinuxSystemMonitorFork>(
+					std::make_shared<LinuxSystemLoggerMonitor>(std::cout),
+					std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor))),
+				partialMonitor)),
+	#else
+			m_operation(std::make_shared<LinuxTracedOperation>(
+				std::make_shared<LinuxSystemAccessMonitor>(std::move(monitor)),
+				partialMonitor)),
+	#endif
+			m_outputListener(std::move(outputListener)),
+			m_outputReader(),
+			m_isFinished(false),
+			m_exitCode(-1)
+		{
+		}
+
+		/// <summary>
+		/// Execute a process for the provided
+		/// </summary>
+		void Start() override final
+		{
+			// Create a pipe to send stdout to parent
+			// Note: Only the read end is non blocking, the child must be able to block on a full pipe
+			int stdOutPipe[2];
+			if (pipe2(stdOutPipe, O_CLOEXEC) < 0 || fcntl(stdOutPipe[0], F_SETFL, O_NONBLOCK) < 0)
+				throw std::runtime_error("Failed to create stdOutPipe");
+
+			// Create a pipe to send stderr to parent
+			int stdErrPipe[2];
+			if (pipe2(stdErrPipe, O_CLOEXEC) < 0 || fcntl(stdErrPipe[0], F_SETFL, O_NONBLOCK) < 0)
+				throw std::runtime_error("Failed to create stdErrPipe");
+
+			m_operation->ExitHandle = eventfd(0, EFD_CLOEXEC);
+			if (m_operation->ExitHandle < 0)
+				throw std::runtime_error("Failed to create exit event");
+
+			try
+			{
+				m_tracer->Launch(
+					m_operation,
+					m_executable,
+					m_arguments,
+					m_workingDirectory,
+					stdOutPipe[1],
+					stdErrPipe[1]);
+			}
+			catch (...)
+			{
+				close(stdOutPipe[0]);
+				close(stdOutPipe[1]);
+				close(stdErrPipe[0]);
+				close(stdErrPipe[1]);
+				throw;
+			}
+
+			// Close our handle on the write end
+			close(stdOutPipe[1]);
+			close(stdErrPipe[1]);
+			m_outputReader = std::make_unique<LinuxProcessOutputReader>(
+				stdOutPipe[0],
+				stdErrPipe[0],
+				m_operation->ExitHandle,
+				m_outputListener);
+		}
+
+		/// <summary>
+		/// Wait for the process to exit
+		/// </summary>
+		void WaitForExit() override final
+		{
+			// Keep reading the output while the tracer thread services the process
+			while (!m_operation->IsFinished.load(std::memory_order_acquire))
+			{
+				m_outputReader->Wait(-1);
+			}
+
+			m_outputReader->ReadAvailable();
+			m_stdOut = m_outputReader->TakeStandardOutput();
+			m_stdErr = m_outputReader->TakeStandardError();
+			m_outputReader = nullptr;
+
+			// The exit handle is owned by the operation, the tracer thread may still hold a reference
+			m_exitCode = m_operation->ExitCode;
+			m_isFinished = true;
+
+			if (m_operation->Exception != nullptr)
+			{
+				std::rethrow_exception(m_operation->Exception);
+			}
+		}
+
+		/// <summary>
+		/// Get the exit code
+		/// </summary>
+		int GetExitCode() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_exitCode;
+		}
+
+		/// <summary>
+		/// Get the standard output
+		/// </summary>
+		std::string GetStandardOutput() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_stdOut;
+		}
+
+		/// <summary>
+		/// Get the standard error output
+		/// </summary>
+		std::string GetStandardError() override final
+		{
+			if (!m_isFinished)
+				throw std::runtime_error("Process has not finished.");
+			return m_stdErr;
+		}
+	};
+}
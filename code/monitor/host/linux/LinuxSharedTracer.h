@@ -0,0 +1,534 @@
+﻿// <copyright file="LinuxSharedTracer.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+#include "LinuxProcessLauncher.h"
+#include "LinuxTraceEventListener.h"
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// The state for a single monitored process tree that is traced by the <see cref='LinuxSharedTracer'/>
+	/// The event listener is only used from the tracer thread, the result is published once the root process exits
+	/// </summary>
+	struct LinuxTracedOperation
+	{
+		LinuxTracedOperation(
+			std::shared_ptr<ILinuxSystemMonitor> monitor,
+			bool partialMonitor) :
+			EventListener(std::move(monitor)),
+			PartialMonitor(partialMonitor),
+			ProcessId(-1),
+			ExitHandle(-1),
+			IsFinished(false),
+			ExitCode(-1),
+			Exception(nullptr)
+		{
+		}
+
+		LinuxTracedOperation(const LinuxTracedOperation&) = delete;
+		LinuxTracedOperation& operator=(const LinuxTracedOperation&) = delete;
+
+		/// <summary>
+		/// The exit handle is closed with the last reference, the tracer thread may still signal it after the
+		/// waiting thread observed the exit
+		/// </summary>
+		~LinuxTracedOperation()
+		{
+			if (ExitHandle >= 0)
+				close(ExitHandle);
+		}
+
+		LinuxTraceEventListener EventListener;
+		bool PartialMonitor;
+		pid_t ProcessId;
+
+		// Signaled by the tracer thread when the root process exits
+		int ExitHandle;
+		std::atomic<bool> IsFinished;
+		int ExitCode;
+		std::exception_ptr Exception;
+	};
+
+	/// <summary>
+	/// A single tracer thread that launches and traces the process trees of all concurrently running operations.
+	/// ptrace requires every request for a tracee to come from the thread that is attached to it, so the tracer
+	/// thread forks each root process itself and routes the events of every descendant to the operation that owns
+	/// the process tree. No process wide state is changed, the working directory is set in the child process and
+	/// only children of the tracer thread are waited on.
+	/// The tracer thread sleeps in waitpid, to wake it for a new launch request a small doorbell child process
+	/// stops itself for each byte written to a pipe. The stop is reported to the tracer thread like any other event.
+	/// </summary>
+	class LinuxSharedTracer
+	{
+	private:
+		struct LaunchRequest
+		{
+			std::shared_ptr<LinuxTracedOperation> Operation;
+			std::unique_ptr<LinuxProcessLauncher> Launcher;
+			int StdOutHandle;
+			int StdErrHandle;
+			std::promise<pid_t> Result;
+		};
+
+		struct TraceeState
+		{
+			std::shared_ptr<LinuxTracedOperation> Operation;
+			bool IsAttached;
+			bool InSystemCall;
+		};
+
+		// Shared
+		std::mutex m_requestMutex;
+		std::queue<std::shared_ptr<LaunchRequest>> m_requests;
+		std::exception_ptr m_failure;
+		bool m_isShutdown;
+		int m_doorbellReadHandle;
+		int m_doorbellWriteHandle;
+
+		// Tracer thread
+		pid_t m_doorbellProcessId;
+		std::map<pid_t, std::shared_ptr<LinuxTracedOperation>> m_operations;
+		std::map<pid_t, TraceeState> m_tracees;
+		std::vector<pid_t> m_unknownTracees;
+		std::thread m_tracerThread;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxSharedTracer'/> class.
+		/// </summary>
+		LinuxSharedTracer() :
+			m_requestMutex(),
+			m_requests(),
+			m_failure(nullptr),
+			m_isShutdown(false),
+			m_doorbellReadHandle(-1),
+			m_doorbellWriteHandle(-1),
+			m_doorbellProcessId(-1),
+			m_operations(),
+			m_tracees(),
+			m_unknownTracees(),
+			m_tracerThread()
+		{
+			int doorbellPipe[2];
+			if (pipe2(doorbellPipe, O_CLOEXEC) < 0)
+				throw std::runtime_error("Failed to create doorbellPipe");
+
+			m_doorbellReadHandle = doorbellPipe[0];
+			m_doorbellWriteHandle = doorbellPipe[1];
+			m_tracerThread = std::thread(&LinuxSharedTracer::TracerThread, this);
+		}
+
+		LinuxSharedTracer(const LinuxSharedTracer&) = delete;
+		LinuxSharedTracer& operator=(const LinuxSharedTracer&) = delete;
+
+		/// <summary>
+		/// Stop the tracer thread, the doorbell process exits once the write end of its pipe is closed
+		/// </summary>
+		~LinuxSharedTracer()
+		{
+			{
+				auto lock = std::lock_guard<std::mutex>(m_requestMutex);
+				m_isShutdown = true;
+			}
+
+			close(m_doorbellWriteHandle);
+			m_tracerThread.join();
+			close(m_doorbellReadHandle);
+		}
+
+		/// <summary>
+		/// Start a traced process from the tracer thread and wait for it to be created
+		/// The output handles are duplicated for the child, the caller still owns all of the handles
+		/// </summary>
+		pid_t Launch(
+			std::shared_ptr<LinuxTracedOperation> operation,
+			const Path& executable,
+			const std::vector<std::string>& arguments,
+			const Path& workingDirectory,
+			int stdOutHandle,
+			int stdErrHandle)
+		{
+			// Prepare the launch on this thread so the tracer thread only has to clone the child
+			auto request = std::make_shared<LaunchRequest>();
+			request->Operation = std::move(operation);
+			request->Launcher = std::make_unique<LinuxProcessLauncher>(
+				executable, arguments, workingDirectory, LinuxSystemCallFilter::Trace);
+			request->StdOutHandle = stdOutHandle;
+			request->StdErrHandle = stdErrHandle;
+			auto result = request->Result.get_future();
+
+			{
+				auto lock = std::lock_guard<std::mutex>(m_requestMutex);
+				if (m_failure != nullptr)
+					std::rethrow_exception(m_failure);
+
+				m_requests.push(request);
+			}
+
+			// Ring the doorbell to wake the tracer thread
+			char value = 1;
+			if (write(m_doorbellWriteHandle, &value, 1) != 1)
+				throw std::runtime_error("Failed to wake the tracer thread");
+
+			return result.get();
+		}
+
+	private:
+		void TracerThread()
+		{
+			try
+			{
+				Log::Diag("TracerThread Start");
+				StartDoorbell();
+				RunEventLoop();
+			}
+			catch (...)
+			{
+				Fail(std::current_exception());
+				if (m_doorbellProcessId > 0)
+					kill(m_doorbellProcessId, SIGKILL);
+			}
+		}
+
+		/// <summary>
+		/// Fork the doorbell process that stops itself for each byte written to the doorbell pipe
+		/// </summary>
+		void StartDoorbell()
+		{
+			pid_t processId = fork();
+			if (processId == 0)
+			{
+				// Only keep the read end of the doorbell pipe, any other inherited descriptor would stay open for the
+				// lifetime of the tracer. Only async signal safe calls are allowed in the forked child.
+				if (dup2(m_doorbellReadHandle, STDIN_FILENO) != STDIN_FILENO)
+					_exit(1);
+
+				if (syscall(SYS_close_range, STDOUT_FILENO, ~0U, 0) != 0)
+				{
+					auto maxHandle = sysconf(_SC_OPEN_MAX);
+					for (int handle = STDOUT_FILENO; handle < maxHandle; handle++)
+						close(handle);
+				}
+
+				char buffer[64];
+				while (read(STDIN_FILENO, buffer, sizeof(buffer)) > 0)
+					raise(SIGSTOP);
+
+				_exit(0);
+			}
+			else if (processId == -1)
+			{
+				throw std::runtime_error("Failed to fork doorbell");
+			}
+
+			m_doorbellProcessId = processId;
+		}
+
+		void RunEventLoop()
+		{
+			while (true)
+			{
+				// Only wait on the children of this thread so other threads can still wait on their own processes
+				int status;
+				auto processId = waitpid(-1, &status, __WALL | __WNOTHREAD | WUNTRACED);
+				if (processId == -1)
+				{
+					if (errno == EINTR)
+						continue;
+
+					throw std::runtime_error(std::format("Wait failed {}", errno));
+				}
+
+				if (processId == m_doorbellProcessId)
+				{
+					if (WIFSTOPPED(status))
+					{
+						StartRequestedProcesses();
+						kill(m_doorbellProcessId, SIGCONT);
+						continue;
+					}
+					else if (WIFEXITED(status) || WIFSIGNALED(status))
+					{
+						auto lock = std::lock_guard<std::mutex>(m_requestMutex);
+						if (!m_isShutdown)
+							throw std::runtime_error("Doorbell process exited unexpectedly");
+
+						DebugTrace("Tracer shutdown");
+						return;
+					}
+
+					continue;
+				}
+
+				if (WIFEXITED(status) || WIFSIGNALED(status))
+				{
+					OnTraceeExit(processId, WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status));
+				}
+				else if (WIFSTOPPED(status))
+				{
+					// A failure while servicing one tracee only fails the operation that owns it
+					try
+					{
+						OnTraceeStop(processId, status);
+					}
+					catch (...)
+					{
+						FailTracee(processId, std::current_exception());
+					}
+				}
+			}
+		}
+
+		void StartRequestedProcesses()
+		{
+			while (true)
+			{
+				std::shared_ptr<LaunchRequest> request;
+				{
+					auto lock = std::lock_guard<std::mutex>(m_requestMutex);
+					if (m_requests.empty())
+						return;
+
+					request = std::move(m_requests.front());
+					m_requests.pop();
+				}
+
+				// The child must be created from this thread so it is traced by it
+				DebugTrace("Spawn");
+				pid_t processId;
+				try
+				{
+					processId = request->Launcher->Spawn(request->StdOutHandle, request->StdErrHandle, -1);
+				}
+				catch (...)
+				{
+					request->Result.set_exception(std::current_exception());
+					continue;
+				}
+
+				request->Operation->ProcessId = processId;
+				m_operations.emplace(processId, request->Operation);
+				m_tracees.emplace(processId, TraceeState({ request->Operation, false, false }));
+				request->Result.set_value(processId);
+			}
+		}
+
+		void OnTraceeExit(pid_t processId, int exitCode)
+		{
+			DebugTrace("Exit:", processId);
+			m_tracees.erase(processId);
+			std::erase(m_unknownTracees, processId);
+
+			// The operation is complete when the root process exits, any remaining descendant is still
+			// serviced but no longer reported
+			auto operation = m_operations.find(processId);
+			if (operation != m_operations.end())
+			{
+				operation->second->ExitCode = exitCode;
+				Finish(*operation->second, nullptr);
+				m_operations.erase(operation);
+			}
+		}
+
+		void OnTraceeStop(pid_t processId, int status)
+		{
+			auto findTracee = m_tracees.find(processId);
+			if (findTracee == m_tracees.end())
+			{
+				// The first stop of an auto attached child can arrive before the event for its parent,
+				// leave it stopped until the owner is known
+				DebugTrace("Unknown tracee:", processId);
+				m_unknownTracees.push_back(processId);
+				return;
+			}
+
+			auto& tracee = findTracee->second;
+			auto& operation = *tracee.Operation;
+			auto signal = WSTOPSIG(status);
+			auto event = (unsigned int)status >> 16;
+			bool continueSysCall = false;
+			int deliverSignal = 0;
+
+			if (!tracee.IsAttached)
+			{
+				// The root process stops with SIGTRAP after execve and an auto attached child stops with SIGSTOP
+				if (processId == operation.ProcessId)
+					SetTraceOptions(processId);
+
+				tracee.IsAttached = true;
+			}
+			else if (signal == (SIGTRAP | 0x80))
+			{
+				// Complete system call, skip processes that belong to an operation that has already finished
+				if (tracee.InSystemCall && !operation.IsFinished)
+					operation.EventListener.ProcessSysCall(processId);
+
+				tracee.InSystemCall = false;
+			}
+			else if (signal == SIGTRAP && event != 0)
+			{
+				switch (event)
+				{
+					case PTRACE_EVENT_SECCOMP:
+					{
+						// Ignore all messages if partial monitor is enabled
+						if (!operation.PartialMonitor && !operation.IsFinished)
+						{
+							// Signal the system call to continue so we can monitor the return result
+							continueSysCall = true;
+							tracee.InSystemCall = true;
+						}
+
+						break;
+					}
+					case PTRACE_EVENT_FORK:
+					case PTRACE_EVENT_VFORK:
+					case PTRACE_EVENT_CLONE:
+					{
+						tracee.InSystemCall = false;
+						unsigned long childProcessId = 0;
+						if (ptrace(PTRACE_GETEVENTMSG, processId, 0, &childProcessId) < 0)
+							throw std::runtime_error(std::format("ptrace PTRACE_GETEVENTMSG failed {}", errno));
+
+						AddChildTracee(static_cast<pid_t>(childProcessId), tracee.Operation);
+						break;
+					}
+					case PTRACE_EVENT_EXEC:
+					case PTRACE_EVENT_EXIT:
+					{
+						break;
+					}
+					default:
+					{
+						throw std::runtime_error(std::format("UNKNOWN PTRACE EVENT: {}", event));
+					}
+				}
+			}
+			else
+			{
+				// Forward a real signal, a group stop has no signal information and must not be forwarded
+				siginfo_t signalInfo;
+				if (ptrace(PTRACE_GETSIGINFO, processId, 0, &signalInfo) == 0)
+					deliverSignal = signal;
+			}
+
+			Resume(processId, continueSysCall ? PTRACE_SYSCALL : PTRACE_CONT, deliverSignal);
+		}
+
+		void AddChildTracee(pid_t processId, const std::shared_ptr<LinuxTracedOperation>& operation)
+		{
+			auto [child, inserted] = m_tracees.emplace(processId, TraceeState({ operation, false, false }));
+			if (!inserted)
+				return;
+
+			// Resume the child if its first stop was already reported
+			auto unknownTracee = std::find(m_unknownTracees.begin(), m_unknownTracees.end(), processId);
+			if (unknownTracee != m_unknownTracees.end())
+			{
+				m_unknownTracees.erase(unknownTracee);
+				child->second.IsAttached = true;
+				Resume(processId, PTRACE_CONT, 0);
+			}
+		}
+
+		static void SetTraceOptions(pid_t processId)
+		{
+			unsigned int ptraceOptions =
+				// Make it easier to track our SIGTRAP events
+				PTRACE_O_TRACESYSGOOD |
+				// Trace Secure Compute
+				PTRACE_O_TRACESECCOMP |
+				// Auto attach to children
+				PTRACE_O_TRACECLONE |
+				PTRACE_O_TRACEFORK |
+				PTRACE_O_TRACEVFORK |
+				// Prevent children from running beyond our lifetime
+				PTRACE_O_EXITKILL |
+				// Monitor execve
+				PTRACE_O_TRACEEXEC;
+
+			if (ptrace(PTRACE_SETOPTIONS, processId, 0, ptraceOptions) < 0)
+				throw std::runtime_error(std::format("ptrace PTRACE_SETOPTIONS failed {}", errno));
+		}
+
+		static void Resume(pid_t processId, __ptrace_request request, int signal)
+		{
+			// A tracee that was killed while stopped reports its exit next
+			if (ptrace(request, processId, 0, signal) < 0 && errno != ESRCH)
+				throw std::runtime_error(std::format("ptrace resume failed {}", errno));
+		}
+
+		/// <summary>
+		/// Fail the operation that owns a tracee and kill its entire process tree, the other operations keep running.
+		/// The killed tracees are still reaped by the event loop.
+		/// </summary>
+		void FailTracee(pid_t processId, std::exception_ptr exception)
+		{
+			auto findTracee = m_tracees.find(processId);
+			if (findTracee == m_tracees.end())
+			{
+				kill(processId, SIGKILL);
+				return;
+			}
+
+			auto operation = findTracee->second.Operation;
+			for (auto& [traceeProcessId, tracee] : m_tracees)
+			{
+				if (tracee.Operation == operation)
+					kill(traceeProcessId, SIGKILL);
+			}
+
+			auto findOperation = m_operations.find(operation->ProcessId);
+			if (findOperation != m_operations.end())
+			{
+				Finish(*operation, exception);
+				m_operations.erase(findOperation);
+			}
+		}
+
+		void Finish(LinuxTracedOperation& operation, std::exception_ptr exception)
+		{
+			operation.Exception = exception;
+			operation.IsFinished.store(true, std::memory_order_release);
+
+			uint64_t value = 1;
+			if (write(operation.ExitHandle, &value, sizeof(value)) != sizeof(value))
+				Log::Error("Failed to signal operation exit");
+		}
+
+		/// <summary>
+		/// Fail every active operation and reject new requests, the tracees are killed when this thread exits
+		/// </summary>
+		void Fail(std::exception_ptr exception)
+		{
+			auto lock = std::lock_guard<std::mutex>(m_requestMutex);
+			m_failure = exception;
+
+			for (auto& [processId, operation] : m_operations)
+				Finish(*operation, exception);
+			m_operations.clear();
+
+			while (!m_requests.empty())
+			{
+				m_requests.front()->Result.set_exception(exception);
+				m_requests.pop();
+			}
+		}
+
+		static void DebugTrace(std::string_view message, uint32_t value)
+		{
+	#ifdef TRACE_MONITOR_HOST
+			std::cout << "Monitor-HOST: " << message << " " << value << std::endl;
+	#endif
+		}
+
+		static void DebugTrace(std::string_view message)
+		{
+	#ifdef TRACE_MONITOR_HOST
+			std::cout << "Monitor-HOST: " << message << std::endl;
+	#endif
+		}
+	};
+}
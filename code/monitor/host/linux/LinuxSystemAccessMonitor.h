@@ -214,7 +214,7 @@ namespace Monitor::Linux
 			// Verify not a special file
 			if (!IsSpecialFile(fileName))
 			{
-				_monitor->TouchFileRead(Path::Parse(fileName), exists, wasBlocked);
+				_monitor->TouchFileRead(fileName, exists, wasBlocked);
 			}
 		}
 
@@ -229,7 +229,7 @@ namespace Monitor::Linux
 			// Verify not a special file
 			if (!IsSpecialFile(fileName))
 			{
-				_monitor->TouchFileWrite(Path::Parse(fileName), wasBlocked);
+				_monitor->TouchFileWrite(fileName, wasBlocked);
 			}
 		}
 
@@ -241,7 +241,7 @@ namespace Monitor::Linux
 
 		void TouchFileDelete(std::string_view fileName, bool wasBlocked)
 		{
-			_monitor->TouchFileDelete(Path::Parse(fileName), wasBlocked);
+			_monitor->TouchFileDelete(fileName, wasBlocked);
 		}
 
 		void TouchFileDeleteOnClose(std::wstring_view fileName)
@@ -252,7 +252,7 @@ namespace Monitor::Linux
 
 		void TouchFileDeleteOnClose(std::string_view fileName)
 		{
-			_monitor->TouchFileDeleteOnClose(Path::Parse(fileName));
+			_monitor->TouchFileDeleteOnClose(fileName);
 		}
 
 		bool IsSpecialFile(std::string_view fileName)
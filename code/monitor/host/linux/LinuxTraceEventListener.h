@@ -4,6 +4,7 @@
 
 #pragma once
 #include "ILinuxSystemMonitor.h"
+#include "LinuxTraceeMemoryReader.h"
 
 namespace Monitor::Linux
 {
@@ -15,12 +16,15 @@ namespace Monitor::Linux
 		std::array<long, 6> Arguments;
 	};
 
-	typedef union {
-		long val;
-		int32_t intData[sizeof(long) / sizeof(int32_t)];
-		char data[sizeof(long)];
-	} dissected_long_t;
-	
+	/// <summary>
+	/// A system call with the path arguments read from the memory of the calling process
+	/// </summary>
+	struct SysCallRecord
+	{
+		SysCallStatus Status;
+		std::array<std::string, 2> Paths;
+	};
+
 	/// <summary>
 	/// The event listener knows how to parse an incoming message and pass it along to the
 	/// registered monitor.
@@ -31,13 +35,17 @@ namespace Monitor::Linux
 		// Input
 		std::shared_ptr<ILinuxSystemMonitor> m_monitor;
 
+		// Runtime
+		LinuxTraceeMemoryReader m_memoryReader;
+
 	public:
 		/// <summary>
 		/// Initializes a new instance of the <see cref='LinuxTraceEventListener'/> class.
 		/// </summary>
 		LinuxTraceEventListener(
 			std::shared_ptr<ILinuxSystemMonitor> monitor) :
-			m_monitor(std::move(monitor))
+			m_monitor(std::move(monitor)),
+			m_memoryReader()
 		{
 		}
 
@@ -46,40 +54,76 @@ namespace Monitor::Linux
 			m_monitor->OnError(message);
 		}
 
+		/// <summary>
+		/// Process the completed system call for a stopped traced process
+		/// </summary>
 		void ProcessSysCall(pid_t pid)
 		{
-			auto registers = GetSysCallArgs(pid);
-			auto args = registers.Arguments;
-			auto result = registers.Return;
-			switch (registers.Command)
+			ProcessSysCall(pid, GetSysCallArgs(pid));
+		}
+
+		/// <summary>
+		/// Process a system call with the provided arguments, the string arguments are read from the process memory
+		/// </summary>
+		void ProcessSysCall(pid_t pid, const SysCallStatus& registers)
+		{
+			ReportSysCall(ReadSysCall(pid, registers));
+		}
+
+		/// <summary>
+		/// Read the path arguments of a system call from the process memory without reporting it, so the caller can
+		/// check that the memory was still owned by the system call once it has been read
+		/// </summary>
+		SysCallRecord ReadSysCall(pid_t pid, const SysCallStatus& registers)
+		{
+			auto sysCall = SysCallRecord({ registers, {} });
+			auto& args = registers.Arguments;
+			auto pathArguments = GetPathArguments(registers.Command);
+			for (size_t i = 0; i < pathArguments.size(); i++)
+			{
+				if (pathArguments[i] >= 0)
+					sysCall.Paths[i] = ReadNullTerminatedStringValue(pid, args[pathArguments[i]]);
+			}
+
+			return sysCall;
+		}
+
+		/// <summary>
+		/// Report a system call that was read to the monitor
+		/// </summary>
+		void ReportSysCall(const SysCallRecord& sysCall)
+		{
+			auto& args = sysCall.Status.Arguments;
+			auto result = sysCall.Status.Return;
+			switch (sysCall.Status.Command)
 			{
 				// FileApi
 				case SCMP_SYS(creat):
 				{
-					auto path = ReadNullTerminatedStringValue(pid, args[0]);
+					auto& path = sysCall.Paths[0];
 					m_monitor->OnCreat(path, result);
 					break;
 				}
 				case SCMP_SYS(link):
 				{
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[0]);
-					auto newpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto& oldpath = sysCall.Paths[0];
+					auto& newpath = sysCall.Paths[1];
 					m_monitor->OnLink(oldpath, newpath, result);
 					break;
 				}
 				case SCMP_SYS(linkat):
 				{
 					auto olddirfd = (int32_t)args[0];
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto& oldpath = sysCall.Paths[0];
 					auto newdirfd = (int32_t)args[2];
-					auto newpath = ReadNullTerminatedStringValue(pid, args[3]);
+					auto& newpath = sysCall.Paths[1];
 					auto flags = (int32_t)args[4];
 					m_monitor->OnLinkAt(olddirfd, oldpath, newdirfd, newpath, flags, result);
 					break;
 				}
 				case SCMP_SYS(mkdir):
 				{
-					auto path = ReadNullTerminatedStringValue(pid, args[0]);
+					auto& path = sysCall.Paths[0];
 					auto mode = (uint32_t)args[1];
 					m_monitor->OnMkdir(path, mode, result);
 					break;
@@ -87,14 +131,14 @@ namespace Monitor::Linux
 				case SCMP_SYS(mkdirat):
 				{
 					auto dirfd = (int32_t)args[0];
-					auto path = ReadNullTerminatedStringValue(pid, args[1]);
+					auto& path = sysCall.Paths[0];
 					auto mode = (uint32_t)args[2];
 					m_monitor->OnMkdirAt(dirfd, path, mode, result);
 					break;
 				}
 				case SCMP_SYS(open):
 				{
-					auto path = ReadNullTerminatedStringValue(pid, args[0]);
+					auto& path = sysCall.Paths[0];
 					auto oflag = (int32_t)args[1];
 					m_monitor->OnOpen(path, oflag, result);
 					break;
@@ -102,7 +146,7 @@ namespace Monitor::Linux
 				case SCMP_SYS(openat):
 				{
 					auto dirfd = (int32_t)args[0];
-					auto path = ReadNullTerminatedStringValue(pid, args[1]);
+					auto& path = sysCall.Paths[0];
 					auto oflag = (int32_t)args[2];
 					m_monitor->OnOpenAt(dirfd, path, oflag, result);
 					break;
@@ -110,45 +154,45 @@ namespace Monitor::Linux
 				case SCMP_SYS(openat2):
 				{
 					auto dirfd = (int32_t)args[0];
-					auto path = ReadNullTerminatedStringValue(pid, args[1]);
+					auto& path = sysCall.Paths[0];
 					auto oflag = (int32_t)args[2];
 					m_monitor->OnOpenAt2(dirfd, path, oflag, result);
 					break;
 				}
 				case SCMP_SYS(rename):
 				{
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[0]);
-					auto newpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto& oldpath = sysCall.Paths[0];
+					auto& newpath = sysCall.Paths[1];
 					m_monitor->OnRename(oldpath, newpath, result);
 					break;
 				}
 				case SCMP_SYS(renameat):
 				{
 					auto oldfd = (int32_t)args[0];
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto& oldpath = sysCall.Paths[0];
 					auto newfd = (int32_t)args[2];
-					auto newpath = ReadNullTerminatedStringValue(pid, args[3]);
+					auto& newpath = sysCall.Paths[1];
 					m_monitor->OnRenameAt(oldfd, oldpath, newfd, newpath, result);
 					break;
 				}
 				case SCMP_SYS(renameat2):
 				{
 					auto oldfd = (int32_t)args[0];
-					auto oldpath = ReadNullTerminatedStringValue(pid, args[1]);
+					auto& oldpath = sysCall.Paths[0];
 					auto newfd = (int32_t)args[2];
-					auto newpath = ReadNullTerminatedStringValue(pid, args[3]);
+					auto& newpath = sysCall.Paths[1];
 					m_monitor->OnRenameAt2(oldfd, oldpath, newfd, newpath, result);
 					break;
 				}
 				case SCMP_SYS(rmdir):
 				{
-					auto pathname = ReadNullTerminatedStringValue(pid, args[0]);
+					auto& pathname = sysCall.Paths[0];
 					m_monitor->OnRmdir(pathname, result);
 					break;
 				}
 				case SCMP_SYS(unlink):
 				{
-					auto pathname = ReadNullTerminatedStringValue(pid, args[0]);
+					auto& pathname = sysCall.Paths[0];
 					m_monitor->OnUnlink(pathname, result);
 					break;
 				}
@@ -166,13 +210,13 @@ namespace Monitor::Linux
 				}
 				case SCMP_SYS(execve):
 				{
-					auto file = ReadNullTerminatedStringValue(pid, args[0]);
+					auto& file = sysCall.Paths[0];
 					m_monitor->OnExecve(file, result);
 					break;
 				}
 				case SCMP_SYS(execveat):
 				{
-					auto file = ReadNullTerminatedStringValue(pid, args[0]);
+					auto& file = sysCall.Paths[0];
 					m_monitor->OnExecveAt(file, result);
 					break;
 				}
@@ -188,12 +232,43 @@ namespace Monitor::Linux
 				}
 				default:
 				{
-					throw std::runtime_error(std::format("Unknown system call type {0}", registers.Command));
+					throw std::runtime_error(std::format("Unknown system call type {0}", sysCall.Status.Command));
 				}
 			}
 		}
 
 	private:
+		/// <summary>
+		/// Get the indices of the arguments that hold a path for a system call, -1 for an unused path
+		/// </summary>
+		static std::array<int, 2> GetPathArguments(long command)
+		{
+			switch (command)
+			{
+				case SCMP_SYS(creat):
+				case SCMP_SYS(mkdir):
+				case SCMP_SYS(open):
+				case SCMP_SYS(rmdir):
+				case SCMP_SYS(unlink):
+				case SCMP_SYS(execve):
+				case SCMP_SYS(execveat):
+					return { 0, -1 };
+				case SCMP_SYS(mkdirat):
+				case SCMP_SYS(openat):
+				case SCMP_SYS(openat2):
+					return { 1, -1 };
+				case SCMP_SYS(link):
+				case SCMP_SYS(rename):
+					return { 0, 1 };
+				case SCMP_SYS(linkat):
+				case SCMP_SYS(renameat):
+				case SCMP_SYS(renameat2):
+					return { 1, 3 };
+				default:
+					return { -1, -1 };
+			}
+		}
+
 		SysCallStatus GetSysCallArgs(pid_t pid)
 		{
 			user_regs_struct regs;
@@ -229,59 +304,7 @@ namespace Monitor::Linux
 
 		std::string ReadNullTerminatedStringValue(pid_t pid, long addr)
 		{
-			auto result = std::string(1024, '\0');
-
-			char *laddr = result.data();
-
-			unsigned long len = 1024;
-			unsigned int nread = 0;
-			unsigned int residue = addr & (sizeof(long) - 1);
-			void *const orig_addr = laddr;
-
-			// aligned address
-			addr &= -sizeof(long);
-
-			while (len)
-			{
-				errno = 0;
-				dissected_long_t u = {
-					.val = ptrace(PTRACE_PEEKDATA, pid, addr, 0)
-				};
-
-				switch (errno)
-				{
-					case 0:
-						break;
-					case ESRCH:
-					case EINVAL:
-						throw std::runtime_error("Could be seen if the process is gone");
-					case EFAULT:
-					case EIO:
-					case EPERM:
-						throw std::runtime_error("address space is inaccessible");
-					default:
-						throw std::runtime_error("all the rest is strange and should be reported");
-				}
-
-				unsigned long m = std::min(sizeof(long) - residue, len);
-				memcpy(laddr, &u.data[residue], m);
-				while (residue < sizeof(long))
-				{
-					if (u.data[residue++] == '\0')
-					{
-						result.resize(nread + residue - 1);
-						return result;
-					}
-				}
-
-				residue = 0;
-				addr += sizeof(long);
-				laddr += m;
-				nread += m;
-				len -= m;
-			}
-
-			return result;
+			return m_memoryReader.ReadNullTerminatedString(pid, addr);
 		}
 	};
 }
@@ -0,0 +1,158 @@
+﻿// <copyright file="LinuxTraceeMemoryReader.h" company="Soup">
+// Copyright (c) Soup. All rights reserved.
+// </copyright>
+
+#pragma once
+
+namespace Monitor::Linux
+{
+	typedef union {
+		long val;
+		int32_t intData[sizeof(long) / sizeof(int32_t)];
+		char data[sizeof(long)];
+	} dissected_long_t;
+
+	/// <summary>
+	/// Reads values out of the memory of a stopped traced process.
+	/// Strings are copied with a single process_vm_readv call per page so the common short path costs one
+	/// system call instead of one PTRACE_PEEKDATA call per machine word. A read is never allowed to cross
+	/// a page boundary in one call, a string that ends right before an unmapped page would otherwise fail.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class LinuxTraceeMemoryReader
+	{
+	private:
+		// The longest string that will be read, matches the system path limit
+		static constexpr size_t MaxStringLength = 4096;
+
+		size_t m_pageSize;
+
+		// Cleared when the kernel does not allow process_vm_readv for the tracee
+		bool m_useBulkRead;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='LinuxTraceeMemoryReader'/> class.
+		/// </summary>
+		LinuxTraceeMemoryReader() :
+			m_pageSize(static_cast<size_t>(sysconf(_SC_PAGESIZE))),
+			m_useBulkRead(true)
+		{
+		}
+
+		/// <summary>
+		/// Read a null terminated string from the tracee
+		/// </summary>
+		std::string ReadNullTerminatedString(pid_t pid, long address)
+		{
+			if (m_useBulkRead)
+			{
+				auto result = std::string();
+				if (TryReadNullTerminatedStringBulk(pid, address, result))
+					return result;
+			}
+
+			return ReadNullTerminatedStringPeekData(pid, address);
+		}
+
+		/// <summary>
+		/// Read a null terminated string from the tracee one machine word at a time
+		/// </summary>
+		std::string ReadNullTerminatedStringPeekData(pid_t pid, long address)
+		{
+			auto result = std::string(MaxStringLength, '\0');
+
+			char *laddr = result.data();
+
+			unsigned long len = MaxStringLength;
+			unsigned int nread = 0;
+			unsigned int residue = address & (sizeof(long) - 1);
+
+			// aligned address
+			address &= -sizeof(long);
+
+			while (len)
+			{
+				errno = 0;
+				dissected_long_t u = {
+					.val = ptrace(PTRACE_PEEKDATA, pid, address, 0)
+				};
+
+				switch (errno)
+				{
+					case 0:
+						break;
+					case ESRCH:
+					case EINVAL:
+						throw std::runtime_error("Could be seen if the process is gone");
+					case EFAULT:
+					case EIO:
+					case EPERM:
+						throw std::runtime_error("address space is inaccessible");
+					default:
+						throw std::runtime_error("all the rest is strange and should be reported");
+				}
+
+				unsigned long m = std::min(sizeof(long) - residue, len);
+				memcpy(laddr, &u.data[residue], m);
+				while (residue < sizeof(long))
+				{
+					if (u.data[residue++] == '\0')
+					{
+						result.resize(nread + residue - 1);
+						return result;
+					}
+				}
+
+				residue = 0;
+				address += sizeof(long);
+				laddr += m;
+				nread += m;
+				len -= m;
+			}
+
+			return result;
+		}
+
+	private:
+		bool TryReadNullTerminatedStringBulk(pid_t pid, long address, std::string& result)
+		{
+			result.resize(MaxStringLength);
+
+			size_t nread = 0;
+			auto current = static_cast<uintptr_t>(address);
+			while (nread < MaxStringLength)
+			{
+				// Read up to the end of the current page
+				auto pageRemaining = m_pageSize - (current & (m_pageSize - 1));
+				auto length = std::min(pageRemaining, MaxStringLength - nread);
+
+				iovec local = { result.data() + nread, length };
+				iovec remote = { reinterpret_cast<void*>(current), length };
+				auto readResult = process_vm_readv(pid, &local, 1, &remote, 1, 0);
+				if (readResult <= 0)
+				{
+					// Not allowed at all, stop trying for the rest of the session
+					if (readResult < 0 && (errno == ENOSYS || errno == EPERM))
+						m_useBulkRead = false;
+
+					return false;
+				}
+
+				auto terminator = memchr(result.data() + nread, '\0', static_cast<size_t>(readResult));
+				if (terminator != nullptr)
+				{
+					result.resize(static_cast<const char*>(terminator) - result.data());
+					return true;
+				}
+
+				nread += static_cast<size_t>(readResult);
+				current += static_cast<uintptr_t>(readResult);
+			}
+
+			return true;
+		}
+	};
+}
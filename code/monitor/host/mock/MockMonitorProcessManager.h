@@ -77,7 +77,8 @@ namespace Monitor
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
-			std::vector<Path> allowedWriteAccess) override final
+			std::vector<Path> allowedWriteAccess,
+			std::shared_ptr<IProcessOutputListener> outputListener) override final
 		{
 			std::stringstream message;
 			auto id = m_uniqueId++;
@@ -33,8 +33,10 @@ namespace Monitor::Windows
 			bool enableAccessChecks,
 			bool partialMonitor,
 			std::vector<Path> allowedReadAccess,
-			std::vector<Path> allowedWriteAccess) override final
+			std::vector<Path> allowedWriteAccess,
+			std::shared_ptr<IProcessOutputListener> outputListener) override final
 		{
+			// TODO: Stream the output, it is still collected for the result
 			return std::make_shared<WindowsMonitorProcess>(
 				executable,
 				std::move(arguments),
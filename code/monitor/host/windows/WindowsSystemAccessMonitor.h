@@ -1188,7 +1188,7 @@ namespace Monitor::Windows
 			// Verify not a special file
 			if (!IsSpecialFile(fileName))
 			{
-				_monitor->TouchFileRead(Path::Parse(fileName), exists, wasBlocked);
+				_monitor->TouchFileRead(fileName, exists, wasBlocked);
 			}
 		}
 
@@ -1203,7 +1203,7 @@ namespace Monitor::Windows
 			// Verify not a special file
 			if (!IsSpecialFile(fileName))
 			{
-				_monitor->TouchFileWrite(Path::Parse(fileName), wasBlocked);
+				_monitor->TouchFileWrite(fileName, wasBlocked);
 			}
 		}
 
@@ -1215,7 +1215,7 @@ namespace Monitor::Windows
 
 		void TouchFileDelete(std::string_view fileName, bool wasBlocked)
 		{
-			_monitor->TouchFileDelete(Path::Parse(fileName), wasBlocked);
+			_monitor->TouchFileDelete(fileName, wasBlocked);
 		}
 
 		void TouchFileDeleteOnClose(std::wstring_view fileName)
@@ -1226,7 +1226,7 @@ namespace Monitor::Windows
 
 		void TouchFileDeleteOnClose(std::string_view fileName)
 		{
-			_monitor->TouchFileDeleteOnClose(Path::Parse(fileName));
+			_monitor->TouchFileDeleteOnClose(fileName);
 		}
 
 		bool IsSpecialFile(std::string_view fileName)
@@ -22,8 +22,10 @@ module;
 #include <stdio.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <cstring>
 
 #define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+#include <algorithm>
 #include <atomic>
 #include <array>
 #include <codecvt>
@@ -57,4 +59,9 @@ export void ThrowIfFailed(int32_t result, std::string_view message)
 
 #endif
 
-#include "Message.h"
\ No newline at end of file
+#include "Message.h"
+
+#if defined(__linux__)
+#include "linux/MessageRing.h"
+#include "linux/ImmutableReadFilter.h"
+#endif
\ No newline at end of file
@@ -0,0 +1,163 @@
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// Skips reads of files in directories that do not change while a build runs, for example the toolchain headers
+	/// and libraries. Most events of a compile are the include search probing for headers that do not exist in these
+	/// directories, a missing file that cannot be created during the build is never an input so it is not reported.
+	/// The host records every file only once, so a file that does exist is only reported the first time it is read.
+	/// Relative paths and paths with a ".." component are always reported.
+	/// The filter runs inside the intercepted functions, so the reported files are tracked by the hash of their path in a
+	/// preallocated lock free table and a file is simply reported again once the table is full.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class ImmutableReadFilter
+	{
+	public:
+		// The inherited list of immutable directories, separated the same way as PATH
+		static constexpr const char* DirectoriesVariable = "SOUP_MONITOR_IMMUTABLE_READ";
+		static constexpr char DirectorySeparator = ':';
+
+	private:
+		static constexpr size_t ReportedReadCapacity = 16384;
+		static constexpr size_t MaxProbeCount = 32;
+		static constexpr uint64_t EmptySlot = 0;
+
+		std::vector<std::string> m_directories;
+		std::array<std::atomic<uint64_t>, ReportedReadCapacity> m_reportedReads;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='ImmutableReadFilter'/> class that does not filter anything
+		/// </summary>
+		ImmutableReadFilter() :
+			m_directories(),
+			m_reportedReads()
+		{
+		}
+
+		/// <summary>
+		/// Combine the directories into the value that is passed to the monitored process
+		/// </summary>
+		static std::string CombineDirectories(const std::vector<std::string>& directories)
+		{
+			auto result = std::string();
+			for (auto& directory : directories)
+			{
+				if (!result.empty())
+					result.push_back(DirectorySeparator);
+				result.append(directory);
+			}
+
+			return result;
+		}
+
+		/// <summary>
+		/// Set the absolute directories whose content is treated as immutable
+		/// </summary>
+		void Initialize(std::string_view directories)
+		{
+			m_directories.clear();
+			while (!directories.empty())
+			{
+				auto end = directories.find(DirectorySeparator);
+				auto directory = directories.substr(0, end);
+				directories = end == std::string_view::npos ? std::string_view() : directories.substr(end + 1);
+
+				if (directory.empty() || directory[0] != '/')
+					continue;
+
+				auto value = std::string(directory);
+				if (value.back() != '/')
+					value.push_back('/');
+				m_directories.push_back(std::move(value));
+			}
+		}
+
+		/// <summary>
+		/// Check if a read only open of the file does not need to be reported
+		/// </summary>
+		bool CanSkipRead(std::string_view path, bool exists)
+		{
+			if (m_directories.empty() || !IsImmutable(path))
+				return false;
+
+			if (!exists)
+				return true;
+
+			return !TryAddReportedRead(path);
+		}
+
+	private:
+		/// <summary>
+		/// Record the file as reported, returns false if it was already reported
+		/// </summary>
+		bool TryAddReportedRead(std::string_view path)
+		{
+			auto hash = HashPath(path);
+			auto index = static_cast<size_t>(hash % ReportedReadCapacity);
+			for (size_t probe = 0; probe < MaxProbeCount; probe++)
+			{
+				auto& slot = m_reportedReads[(index + probe) % ReportedReadCapacity];
+				auto current = slot.load(std::memory_order_relaxed);
+				if (current == EmptySlot &&
+					slot.compare_exchange_strong(current, hash, std::memory_order_relaxed))
+				{
+					return true;
+				}
+
+				if (current == hash)
+					return false;
+			}
+
+			// The table is full, reporting the file again is always safe
+			return true;
+		}
+
+		/// <summary>
+		/// 64 bit FNV-1a, the empty slot value is never returned
+		/// </summary>
+		static uint64_t HashPath(std::string_view path)
+		{
+			uint64_t hash = 14695981039346656037ull;
+			for (auto value : path)
+			{
+				hash ^= static_cast<unsigned char>(value);
+				hash *= 1099511628211ull;
+			}
+
+			return hash == EmptySlot ? 1 : hash;
+		}
+
+		bool IsImmutable(std::string_view path) const
+		{
+			for (auto& directory : m_directories)
+			{
+				if (path.starts_with(directory) && !HasParentReference(path.substr(directory.size())))
+					return true;
+			}
+
+			return false;
+		}
+
+		/// <summary>
+		/// Check for a ".." component, a symbolic link in front of it can resolve to any other directory
+		/// </summary>
+		static bool HasParentReference(std::string_view relativePath)
+		{
+			while (!relativePath.empty())
+			{
+				auto end = relativePath.find('/');
+				if (relativePath.substr(0, end) == "..")
+					return true;
+
+				relativePath = end == std::string_view::npos ? std::string_view() : relativePath.substr(end + 1);
+			}
+
+			return false;
+		}
+	};
+}
@@ -0,0 +1,228 @@
+#pragma once
+
+namespace Monitor::Linux
+{
+	/// <summary>
+	/// The state at the start of the shared memory that is used by every writer and the single reader
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	struct MessageRingHeader
+	{
+		// The end of the space that has been reserved by a writer
+		alignas(64) std::atomic<uint64_t> WritePosition;
+
+		// The start of the space that has not been read yet
+		alignas(64) std::atomic<uint64_t> ReadPosition;
+
+		// Set by the reader before it blocks on the event handle
+		alignas(64) std::atomic<uint32_t> IsReaderWaiting;
+
+		// Set by the reader once it stops reading, a writer must not wait for space after that
+		alignas(64) std::atomic<uint32_t> IsClosed;
+	};
+
+	/// <summary>
+	/// A lock free ring buffer of messages in memory that is shared between the preloaded monitor client in every
+	/// monitored process and the host. Writers reserve space with a compare exchange on the write position, copy the
+	/// message and then commit it by stamping the record with its position. The single reader consumes committed
+	/// records in order and clears them before releasing the space.
+	/// The event handle is only signaled when the reader is waiting, so a busy reader takes a whole batch of
+	/// messages without a system call per message.
+	/// </summary>
+	#ifdef SOUP_BUILD
+	export
+	#endif
+	class MessageRing
+	{
+	public:
+		// The inherited handles of the shared memory and the event that wakes the reader
+		static constexpr const char* MemoryHandleVariable = "SOUP_MONITOR_RING_HANDLE";
+		static constexpr const char* EventHandleVariable = "SOUP_MONITOR_EVENT_HANDLE";
+
+		static constexpr uint64_t Capacity = 1024 * 1024;
+		static constexpr size_t MappingSize = sizeof(MessageRingHeader) + Capacity;
+
+	private:
+		struct Record
+		{
+			// The position of the record plus one once it is committed, zero until then
+			std::atomic<uint64_t> Stamp;
+			uint32_t Size;
+			uint32_t IsPadding;
+		};
+
+		static constexpr uint64_t RecordAlignment = 16;
+		static_assert(sizeof(Record) == RecordAlignment, "A padding record must fit in any remaining space");
+
+		MessageRingHeader* m_header;
+		uint8_t* m_data;
+
+	public:
+		/// <summary>
+		/// Initializes a new instance of the <see cref='MessageRing'/> class over a zero initialized mapping of MappingSize
+		/// </summary>
+		MessageRing(void* mapping) :
+			m_header(static_cast<MessageRingHeader*>(mapping)),
+			m_data(static_cast<uint8_t*>(mapping) + sizeof(MessageRingHeader))
+		{
+		}
+
+		/// <summary>
+		/// Copy the message into the ring, returns false when there is not enough space for it
+		/// </summary>
+		bool TryWrite(const Message& message)
+		{
+			auto size = static_cast<uint32_t>(offsetof(Message, Content) + message.ContentSize);
+			auto recordSize = AlignRecordSize(sizeof(Record) + size);
+
+			// Reserve the space for the record, a record never wraps around the end so the remaining space is padded
+			uint64_t position = m_header->WritePosition.load(std::memory_order_relaxed);
+			uint64_t padding;
+			while (true)
+			{
+				auto offset = position % Capacity;
+				padding = offset + recordSize > Capacity ? Capacity - offset : 0;
+				auto readPosition = m_header->ReadPosition.load(std::memory_order_acquire);
+				if (position + padding + recordSize - readPosition > Capacity)
+					return false;
+
+				if (m_header->WritePosition.compare_exchange_weak(
+					position,
+					position + padding + recordSize,
+					std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+
+			if (padding != 0)
+			{
+				auto& paddingRecord = GetRecord(position);
+				paddingRecord.Size = 0;
+				paddingRecord.IsPadding = 1;
+				paddingRecord.Stamp.store(position + 1, std::memory_order_release);
+				position += padding;
+			}
+
+			auto& record = GetRecord(position);
+			record.Size = size;
+			record.IsPadding = 0;
+			std::memcpy(reinterpret_cast<uint8_t*>(&record + 1), &message, size);
+
+			// Sequentially consistent to pair with the reader that checks for more records after it starts waiting
+			record.Stamp.store(position + 1, std::memory_order_seq_cst);
+			return true;
+		}
+
+		/// <summary>
+		/// Check if the reader must be woken up for the messages that were written, only the first writer after
+		/// the reader started waiting is told to signal the event
+		/// </summary>
+		bool TakeReaderWake()
+		{
+			return m_header->IsReaderWaiting.load(std::memory_order_seq_cst) != 0 &&
+				m_header->IsReaderWaiting.exchange(0, std::memory_order_seq_cst) != 0;
+		}
+
+		/// <summary>
+		/// Pass every committed message to the callback in order, returns the number of messages read.
+		/// Only a single reader may call this.
+		/// </summary>
+		template<typename TCallback>
+		uint32_t Read(TCallback&& callback)
+		{
+			auto message = Message();
+			uint32_t count = 0;
+			auto position = m_header->ReadPosition.load(std::memory_order_relaxed);
+			while (true)
+			{
+				auto& record = GetRecord(position);
+				if (record.Stamp.load(std::memory_order_acquire) != position + 1)
+					break;
+
+				uint64_t recordSize;
+				if (record.IsPadding != 0)
+				{
+					recordSize = Capacity - (position % Capacity);
+				}
+				else
+				{
+					recordSize = AlignRecordSize(sizeof(Record) + record.Size);
+					std::memcpy(static_cast<void*>(&message), &record + 1, std::min<size_t>(record.Size, sizeof(Message)));
+					callback(message);
+					count++;
+				}
+
+				// Clear the record so no stale stamp remains for a later record at the same location
+				std::memset(static_cast<void*>(&record), 0, recordSize);
+				position += recordSize;
+				m_header->ReadPosition.store(position, std::memory_order_release);
+			}
+
+			return count;
+		}
+
+		/// <summary>
+		/// Get the position of the next record the reader will consume
+		/// </summary>
+		uint64_t GetReadPosition() const
+		{
+			return m_header->ReadPosition.load(std::memory_order_acquire);
+		}
+
+		/// <summary>
+		/// Get the end of the space that has been reserved by the writers, a record between the read position and here
+		/// may not be committed yet
+		/// </summary>
+		uint64_t GetWritePosition() const
+		{
+			return m_header->WritePosition.load(std::memory_order_acquire);
+		}
+
+		/// <summary>
+		/// Mark the ring as closed when the reader stops reading, writers stop waiting for space
+		/// </summary>
+		void Close()
+		{
+			m_header->IsClosed.store(1, std::memory_order_release);
+		}
+
+		/// <summary>
+		/// Check if the reader has stopped reading
+		/// </summary>
+		bool IsClosed() const
+		{
+			return m_header->IsClosed.load(std::memory_order_acquire) != 0;
+		}
+
+		/// <summary>
+		/// Mark the reader as waiting, returns false if a message was committed in the meantime and the reader must
+		/// read again instead of blocking on the event handle
+		/// </summary>
+		bool TryBeginWait()
+		{
+			m_header->IsReaderWaiting.store(1, std::memory_order_seq_cst);
+			auto position = m_header->ReadPosition.load(std::memory_order_relaxed);
+			if (GetRecord(position).Stamp.load(std::memory_order_seq_cst) == position + 1)
+			{
+				m_header->IsReaderWaiting.store(0, std::memory_order_relaxed);
+				return false;
+			}
+
+			return true;
+		}
+
+	private:
+		static uint64_t AlignRecordSize(uint64_t size)
+		{
+			return (size + RecordAlignment - 1) & ~(RecordAlignment - 1);
+		}
+
+		Record& GetRecord(uint64_t position)
+		{
+			return *reinterpret_cast<Record*>(m_data + (position % Capacity));
+		}
+	};
+}
@@ -0,0 +1,278 @@
+#if defined(__linux__)
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#else
+#error "Unsupported platform"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <string>
+
+/// <summary>
+/// A reference remote build cache server that stores every entry as a file in a single directory.
+/// Only listens on the local loopback address, it is intended for tests and as a protocol example.
+///   HEAD /[name] returns 200 when the entry exists and 404 when it does not
+///   GET /[name] returns 200 with the entry content or 404 when it does not exist
+///   PUT /[name] stores the request body as the entry content and returns 201
+/// The entry name must be "operations/[key].bcm" or "content/[digest]" and may follow any base path, where the key
+/// and digest are unpadded base64url as sent by the client.
+/// </summary>
+
+struct HttpRequest
+{
+	std::string Method;
+	std::string Target;
+	std::string Body;
+};
+
+void PrintUsage()
+{
+	std::cout << "cacheserver [directory] [port]" << std::endl;
+}
+
+bool IsValidEntryName(std::string_view name)
+{
+	auto separator = name.find('/');
+	if (separator == std::string_view::npos)
+		return false;
+
+	auto folder = name.substr(0, separator);
+	auto fileName = name.substr(separator + 1);
+	if (folder == "operations")
+	{
+		if (!fileName.ends_with(".bcm"))
+			return false;
+
+		fileName.remove_suffix(4);
+	}
+	else if (folder != "content")
+	{
+		return false;
+	}
+
+	// Only allow the base64url alphabet so a name can never escape the cache directory
+	return !fileName.empty() && std::all_of(
+		fileName.begin(),
+		fileName.end(),
+		[](char value)
+		{
+			return std::isalnum(static_cast<unsigned char>(value)) || value == '-' || value == '_';
+		});
+}
+
+std::optional<HttpRequest> ReadRequest(int socketHandle)
+{
+	auto data = std::string();
+	auto buffer = std::array<char, 64 * 1024>();
+	size_t headerEnd = std::string::npos;
+	std::optional<size_t> contentLength = std::nullopt;
+	while (true)
+	{
+		if (headerEnd == std::string::npos)
+		{
+			headerEnd = data.find("\r\n\r\n");
+			if (headerEnd != std::string::npos)
+			{
+				// Find the body length, header names are case insensitive
+				auto headers = std::string(data, 0, headerEnd);
+				std::transform(headers.begin(), headers.end(), headers.begin(), [](unsigned char value) { return std::tolower(value); });
+				auto lengthHeader = headers.find("\r\ncontent-length:");
+				contentLength = 0;
+				if (lengthHeader != std::string::npos)
+				{
+					auto valueStart = headers.find_first_not_of(' ', lengthHeader + 17);
+					size_t length = 0;
+					if (valueStart == std::string::npos ||
+						std::from_chars(headers.data() + valueStart, headers.data() + headers.size(), length).ec != std::errc())
+					{
+						return std::nullopt;
+					}
+
+					contentLength = length;
+				}
+			}
+		}
+
+		if (contentLength.has_value() && data.size() - (headerEnd + 4) >= contentLength.value())
+			break;
+
+		auto received = recv(socketHandle, buffer.data(), buffer.size(), 0);
+		if (received <= 0)
+			return std::nullopt;
+
+		data.append(buffer.data(), static_cast<size_t>(received));
+	}
+
+	// Parse the request line "PUT /content/digest HTTP/1.1"
+	auto requestLineEnd = data.find("\r\n");
+	auto requestLine = std::string_view(data).substr(0, requestLineEnd);
+	auto methodEnd = requestLine.find(' ');
+	auto targetEnd = requestLine.find(' ', methodEnd + 1);
+	if (methodEnd == std::string_view::npos || targetEnd == std::string_view::npos)
+		return std::nullopt;
+
+	auto request = HttpRequest();
+	request.Method = requestLine.substr(0, methodEnd);
+	request.Target = requestLine.substr(methodEnd + 1, targetEnd - methodEnd - 1);
+	request.Body = data.substr(headerEnd + 4, contentLength.value());
+	return request;
+}
+
+void SendResponse(int socketHandle, int statusCode, std::string_view status, size_t contentLength, std::string_view body)
+{
+	auto response = std::stringstream();
+	response << "HTTP/1.1 " << statusCode << " " << status << "\r\n";
+	response << "Content-Length: " << contentLength << "\r\n";
+	response << "Connection: close\r\n";
+	response << "\r\n";
+	response << body;
+
+	auto data = response.str();
+	auto remaining = std::string_view(data);
+	while (!remaining.empty())
+	{
+		auto sent = send(socketHandle, remaining.data(), remaining.size(), MSG_NOSIGNAL);
+		if (sent <= 0)
+			return;
+
+		remaining.remove_prefix(static_cast<size_t>(sent));
+	}
+}
+
+void HandleRequest(int socketHandle, const std::filesystem::path& directory)
+{
+	auto request = ReadRequest(socketHandle);
+	if (!request.has_value())
+	{
+		SendResponse(socketHandle, 400, "Bad Request", 0, {});
+		return;
+	}
+
+	std::cout << request->Method << " " << request->Target << std::endl;
+
+	// Clients may use any base path for the cache, the entry is always the last two segments
+	auto name = std::string_view(request->Target);
+	auto folderEnd = name.rfind('/');
+	auto folderStart = folderEnd == std::string_view::npos || folderEnd == 0 ?
+		std::string_view::npos :
+		name.rfind('/', folderEnd - 1);
+	if (folderStart != std::string_view::npos)
+		name.remove_prefix(folderStart + 1);
+
+	if (!IsValidEntryName(name))
+	{
+		SendResponse(socketHandle, 400, "Bad Request", 0, {});
+		return;
+	}
+
+	auto entryFile = directory / name;
+	if (request->Method == "HEAD" || request->Method == "GET")
+	{
+		auto file = std::ifstream(entryFile, std::ios::binary);
+		if (!file.is_open())
+		{
+			SendResponse(socketHandle, 404, "Not Found", 0, {});
+			return;
+		}
+
+		auto content = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+		auto body = request->Method == "GET" ? std::string_view(content) : std::string_view();
+		SendResponse(socketHandle, 200, "OK", content.size(), body);
+	}
+	else if (request->Method == "PUT")
+	{
+		// Write to a temporary file first so a reader never sees a partial entry
+		std::filesystem::create_directories(entryFile.parent_path());
+		auto temporaryFile = entryFile;
+		temporaryFile += ".tmp";
+		{
+			auto file = std::ofstream(temporaryFile, std::ios::binary | std::ios::trunc);
+			file.write(request->Body.data(), request->Body.size());
+			if (!file.good())
+			{
+				SendResponse(socketHandle, 500, "Internal Server Error", 0, {});
+				return;
+			}
+		}
+
+		std::filesystem::rename(temporaryFile, entryFile);
+		SendResponse(socketHandle, 201, "Created", 0, {});
+	}
+	else
+	{
+		SendResponse(socketHandle, 405, "Method Not Allowed", 0, {});
+	}
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 3)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	try
+	{
+		auto directory = std::filesystem::path(argv[1]);
+		auto portValue = std::string_view(argv[2]);
+		uint16_t port = 0;
+		if (std::from_chars(portValue.data(), portValue.data() + portValue.size(), port).ec != std::errc())
+			throw std::runtime_error("Invalid port");
+
+		std::filesystem::create_directories(directory);
+
+		auto listenHandle = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (listenHandle < 0)
+			throw std::runtime_error("Failed to create socket");
+
+		int reuseAddress = 1;
+		setsockopt(listenHandle, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+		sockaddr_in address = {};
+		address.sin_family = AF_INET;
+		address.sin_port = htons(port);
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		if (bind(listenHandle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+			throw std::runtime_error("Failed to bind to port");
+
+		if (listen(listenHandle, SOMAXCONN) != 0)
+			throw std::runtime_error("Failed to listen");
+
+		std::cout << "Listening on http://127.0.0.1:" << port << "/" << std::endl;
+		while (true)
+		{
+			auto socketHandle = accept4(listenHandle, nullptr, nullptr, SOCK_CLOEXEC);
+			if (socketHandle < 0)
+				continue;
+
+			try
+			{
+				HandleRequest(socketHandle, directory);
+			}
+			catch (const std::exception& e)
+			{
+				std::cerr << e.what() << std::endl;
+				SendResponse(socketHandle, 500, "Internal Server Error", 0, {});
+			}
+
+			close(socketHandle);
+		}
+	}
+	catch(const std::exception& e)
+	{
+		std::cerr << e.what() << std::endl;
+		return 2;
+	}
+
+	return 0;
+}
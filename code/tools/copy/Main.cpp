@@ -1,18 +1,91 @@
 #if defined(_WIN32)
 #include <Windows.h>
 #elif defined(__linux__)
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #else
 #error "Unknown platform"
 #endif
 
+#include <algorithm>
+#include <array>
 #include <filesystem>
+#include <format>
+#include <fstream>
 #include <iostream>
 #include <string_view>
 #include <string>
 
 void PrintUsage()
 {
-	std::cout << "copy [source] [destination]" << std::endl;
+	std::cout << "copy [-hardlink] [source] [destination]" << std::endl;
+}
+
+/// <summary>
+/// Check if the destination already has the same content as the source, the copy can then be skipped
+/// and the destination keeps its last write time so nothing that reads it looks outdated
+/// </summary>
+bool HasIdenticalContent(const std::filesystem::path& sourcePath, const std::filesystem::path& destinationPath)
+{
+	auto errorCode = std::error_code();
+	if (std::filesystem::equivalent(sourcePath, destinationPath, errorCode))
+		return true;
+
+	auto sourceSize = std::filesystem::file_size(sourcePath, errorCode);
+	if (errorCode)
+		return false;
+	auto destinationSize = std::filesystem::file_size(destinationPath, errorCode);
+	if (errorCode || sourceSize != destinationSize)
+		return false;
+
+	auto source = std::ifstream(sourcePath, std::ios::binary);
+	auto destination = std::ifstream(destinationPath, std::ios::binary);
+	if (!source || !destination)
+		return false;
+
+	auto sourceBuffer = std::array<char, 64 * 1024>();
+	auto destinationBuffer = std::array<char, 64 * 1024>();
+	while (source && destination)
+	{
+		source.read(sourceBuffer.data(), sourceBuffer.size());
+		destination.read(destinationBuffer.data(), destinationBuffer.size());
+		if (source.gcount() != destination.gcount() ||
+			!std::equal(sourceBuffer.data(), sourceBuffer.data() + source.gcount(), destinationBuffer.data()))
+		{
+			return false;
+		}
+	}
+
+	return source.eof() && destination.eof();
+}
+
+/// <summary>
+/// Open the identical destination for writing without changing it, so the monitor still records the destination
+/// as an output of the copy and a later build reruns the copy if the destination is deleted
+/// </summary>
+void TouchOutput(const std::filesystem::path& destinationPath)
+{
+	// Append mode never truncates the file, a destination that cannot be opened for writing such as a running
+	// executable is left as is
+	auto destination = std::ofstream(destinationPath, std::ios::binary | std::ios::app);
+}
+
+/// <summary>
+/// Replace the destination with a hard link to the source, returns false if the file system cannot link them
+/// </summary>
+bool TryLinkFile(const std::filesystem::path& sourcePath, const std::filesystem::path& destinationPath)
+{
+	auto errorCode = std::error_code();
+	std::filesystem::remove(destinationPath, errorCode);
+	if (errorCode)
+		throw std::runtime_error(std::format("Failed to remove destination: {}", errorCode.message()));
+
+	std::filesystem::create_hard_link(sourcePath, destinationPath, errorCode);
+	return !errorCode;
 }
 
 #if defined(_WIN32)
@@ -33,13 +106,126 @@ void CopyFile(std::string_view sourcePath, std::string_view destinationPath)
 	}
 }
 #elif defined(__linux__)
+/// <summary>
+/// Copy the content with the kernel, returns false if neither a reflink nor copy_file_range is supported
+/// between the two files and nothing has been written yet
+/// </summary>
+bool TryCopyFileContent(int sourceFile, int destinationFile, off_t size)
+{
+	// Share the extents on file systems that support it, the data is not copied at all
+	if (ioctl(destinationFile, FICLONE, sourceFile) == 0)
+		return true;
+
+	off_t copied = 0;
+	while (copied < size)
+	{
+		auto result = copy_file_range(sourceFile, nullptr, destinationFile, nullptr, size - copied, 0);
+		if (result < 0)
+		{
+			if (errno == EINTR)
+				continue;
+
+			// Older kernels do not support copies between different file systems
+			if (copied == 0 && (errno == EXDEV || errno == ENOSYS || errno == EOPNOTSUPP || errno == EINVAL))
+				return false;
+
+			throw std::runtime_error(std::format("copy_file_range failed: {}", errno));
+		}
+
+		// The source was truncated while it was copied
+		if (result == 0)
+			break;
+
+		copied += result;
+	}
+
+	return true;
+}
+
+void CopyFileContentSlow(int sourceFile, int destinationFile)
+{
+	auto buffer = std::array<char, 64 * 1024>();
+	while (true)
+	{
+		auto readCount = read(sourceFile, buffer.data(), buffer.size());
+		if (readCount < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			throw std::runtime_error(std::format("Read failed: {}", errno));
+		}
+
+		if (readCount == 0)
+			break;
+
+		ssize_t written = 0;
+		while (written < readCount)
+		{
+			auto writeCount = write(destinationFile, buffer.data() + written, readCount - written);
+			if (writeCount < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				throw std::runtime_error(std::format("Write failed: {}", errno));
+			}
+
+			written += writeCount;
+		}
+	}
+}
+
 void CopyFile(std::string_view sourcePath, std::string_view destinationPath)
 {
-	auto options = std::filesystem::copy_options::overwrite_existing;
-	if (!std::filesystem::copy_file(sourcePath, destinationPath, options))
+	auto sourceFile = open(sourcePath.data(), O_RDONLY | O_CLOEXEC);
+	if (sourceFile < 0)
+	{
+		if (errno == ENOENT)
+			throw std::runtime_error("File does not exist");
+		throw std::runtime_error(std::format("Failed to open source: {}", errno));
+	}
+
+	struct stat sourceStatus;
+	if (fstat(sourceFile, &sourceStatus) < 0)
+	{
+		close(sourceFile);
+		throw std::runtime_error(std::format("Failed to read source status: {}", errno));
+	}
+
+	// Write a new file instead of truncating the existing one, the destination may be a hard link that
+	// shares its content with another file or an executable that is still running
+	if (unlink(destinationPath.data()) < 0 && errno != ENOENT)
+	{
+		close(sourceFile);
+		throw std::runtime_error(std::format("Failed to remove destination: {}", errno));
+	}
+
+	auto mode = sourceStatus.st_mode & 07777;
+	auto destinationFile = open(destinationPath.data(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, mode);
+	if (destinationFile < 0)
+	{
+		close(sourceFile);
+		throw std::runtime_error(std::format("Failed to create destination: {}", errno));
+	}
+
+	try
 	{
-		throw std::runtime_error("Copy failed");
+		if (!TryCopyFileContent(sourceFile, destinationFile, sourceStatus.st_size))
+			CopyFileContentSlow(sourceFile, destinationFile);
+
+		// Keep the file permissions without the umask, a copied executable must still be executable
+		if (fchmod(destinationFile, mode) < 0)
+			throw std::runtime_error(std::format("Failed to set permissions: {}", errno));
+	}
+	catch (...)
+	{
+		close(sourceFile);
+		close(destinationFile);
+		throw;
 	}
+
+	close(sourceFile);
+	if (close(destinationFile) < 0)
+		throw std::runtime_error(std::format("Failed to close destination: {}", errno));
 }
 #else
 #error "Unknown platform"
@@ -47,7 +233,8 @@ void CopyFile(std::string_view sourcePath, std::string_view destinationPath)
 
 int main(int argc, char** argv)
 {
-	if (argc != 3)
+	auto useHardLink = argc == 4 && std::string_view(argv[1]) == "-hardlink";
+	if (argc != 3 && !useHardLink)
 	{
 		PrintUsage();
 		return 1;
@@ -55,9 +242,16 @@ int main(int argc, char** argv)
 
 	try
 	{
-		auto sourcePath = std::string_view(argv[1]);
-		auto destinationPath = std::string_view(argv[2]);
-		CopyFile(sourcePath, destinationPath);
+		auto sourcePath = std::string_view(argv[argc - 2]);
+		auto destinationPath = std::string_view(argv[argc - 1]);
+		if (HasIdenticalContent(sourcePath, destinationPath))
+		{
+			TouchOutput(destinationPath);
+			return 0;
+		}
+
+		if (!useHardLink || !TryLinkFile(sourcePath, destinationPath))
+			CopyFile(sourcePath, destinationPath);
 	}
 	catch(const std::exception& e)
 	{
@@ -66,4 +260,4 @@ int main(int argc, char** argv)
 	}
 
 	return 0;
-}
\ No newline at end of file
+}
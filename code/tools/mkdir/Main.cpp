@@ -1,4 +1,3 @@
-#include <chrono>
 #include <iostream>
 #include <filesystem>
 
@@ -22,17 +21,9 @@ int main(int argc, char** argv)
 		auto directory = Opal::Path::Parse(argv[1]);
 		auto fileSystem = Opal::System::STLFileSystem();
 
-		if (fileSystem.Exists(directory))
-		{
-			auto now = std::chrono::system_clock::now();
-			#ifdef _WIN32
-			auto nowFileTime = std::chrono::clock_cast<std::chrono::file_clock>(now);
-			#else
-			auto nowFileTime = std::chrono::file_clock::from_sys(now);
-			#endif
-			fileSystem.SetLastWriteTime(directory, nowFileTime);
-		}
-		else
+		// Leave an existing directory untouched, the same as the build engine does when it runs the tool in process,
+		// touching it would only make every operation that reads the directory look outdated
+		if (!fileSystem.Exists(directory))
 		{
 			fileSystem.CreateDirectory(directory);
 		}